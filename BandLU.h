@@ -0,0 +1,180 @@
+#pragma once
+#include <vector>
+#include <cmath>
+#include <cstddef>
+#include <utility>
+#include <algorithm>
+#include "BandMatrix.h"
+#include "SimdKernels.h"
+
+// LU em banda com pivoteamento parcial (como o dgbtrf do LAPACK): P·A = L·U em
+// O(n·lower·(lower + upper)) operações e O(n·(2·lower + upper + 1)) de memória.
+// As trocas de linha alargam U para lower + upper diagonais, por isso cada
+// linha guarda lower colunas extras à direita. L fica abaixo da diagonal, sem
+// ser permutada pelas trocas posteriores (elas são aplicadas em sequência na
+// substituição progressiva).
+class BandLU {
+private:
+    int n = 0;
+    int lower = 0;
+    int upper = 0; // Banda superior de U (lower + upper da matriz original)
+    int width = 0;
+    std::vector<double> factors; // (i, j) em i·width + (j - i + lower)
+    std::vector<int> pivots;
+
+    double& At(int i, int j) { return factors[static_cast<std::size_t>(i) * width + (j - i + lower)]; }
+    double At(int i, int j) const { return factors[static_cast<std::size_t>(i) * width + (j - i + lower)]; }
+
+public:
+    int Size() const { return n; }
+
+    // Após Factor: linha trocada com k no passo k e o pivô k (diagonal de U)
+    const std::vector<int>& Pivots() const { return pivots; }
+    double Diagonal(int k) const { return At(k, k); }
+
+    // Fatorar a matriz; retorna false se alguma coluna não tiver pivô acima de tolerance
+    bool Factor(const BandMatrix& matrix, double tolerance) {
+        return Factor(matrix, matrix.Size(), matrix.Lower(), matrix.Upper(), tolerance);
+    }
+
+    // Fatorar a banda [-matrixLower, +matrixUpper] de qualquer matriz com acesso
+    // (i, j), p. ex. uma DenseMatrix sem a cópia intermediária para BandMatrix.
+    // Os vetores internos são reaproveitados quando o objeto é fatorado de novo.
+    template <typename Source>
+    bool Factor(const Source& matrix, int size, int matrixLower, int matrixUpper, double tolerance) {
+        n = size;
+        lower = matrixLower;
+        upper = matrixLower + matrixUpper;
+        width = lower + upper + 1;
+        factors.assign(static_cast<std::size_t>(n) * width, 0.0);
+        pivots.resize(n);
+
+        for (int i = 0; i < n; i++) {
+            const int begin = std::max(0, i - matrixLower);
+            const int end = std::min(n - 1, i + matrixUpper);
+            for (int j = begin; j <= end; j++) {
+                At(i, j) = matrix(i, j);
+            }
+        }
+
+        for (int k = 0; k < n; k++) {
+            const int lastRow = std::min(n - 1, k + lower);
+            const int lastCol = std::min(n - 1, k + upper);
+
+            int pivotRow = k;
+            double maxAbs = std::abs(At(k, k));
+            for (int i = k + 1; i <= lastRow; i++) {
+                if (std::abs(At(i, k)) > maxAbs) {
+                    maxAbs = std::abs(At(i, k));
+                    pivotRow = i;
+                }
+            }
+            if (!(maxAbs > tolerance)) {
+                return false;
+            }
+
+            pivots[k] = pivotRow;
+            if (pivotRow != k) {
+                // Linhas com deslocamentos diferentes na banda: troca elemento a elemento
+                for (int j = k; j <= lastCol; j++) {
+                    std::swap(At(k, j), At(pivotRow, j));
+                }
+            }
+
+            const double inversePivot = 1.0 / At(k, k);
+            for (int i = k + 1; i <= lastRow; i++) {
+                const double factor = At(i, k) * inversePivot;
+                At(i, k) = factor;
+                if (factor != 0.0) {
+                    SimdAxpy(lastCol - k, -factor, &At(k, k + 1), &At(i, k + 1));
+                }
+            }
+        }
+        return true;
+    }
+
+    // Resolver A·x = b sobrescrevendo b
+    void SolveInPlace(double* b) const {
+        for (int k = 0; k < n; k++) {
+            if (pivots[k] != k) {
+                std::swap(b[k], b[pivots[k]]);
+            }
+            const double value = b[k];
+            const int lastRow = std::min(n - 1, k + lower);
+            for (int i = k + 1; i <= lastRow; i++) {
+                b[i] -= At(i, k) * value;
+            }
+        }
+
+        for (int i = n - 1; i >= 0; i--) {
+            const int lastCol = std::min(n - 1, i + upper);
+            double sum = b[i];
+            for (int j = i + 1; j <= lastCol; j++) {
+                sum -= At(i, j) * b[j];
+            }
+            b[i] = sum / At(i, i);
+        }
+    }
+
+    // Resolver Aᵀ·x = b sobrescrevendo b (Uᵀ, depois Lᵀ e as trocas em ordem inversa)
+    void SolveTransposeInPlace(double* b) const {
+        for (int i = 0; i < n; i++) {
+            const int firstCol = std::max(0, i - upper);
+            double sum = b[i];
+            for (int j = firstCol; j < i; j++) {
+                sum -= At(j, i) * b[j];
+            }
+            b[i] = sum / At(i, i);
+        }
+
+        for (int k = n - 1; k >= 0; k--) {
+            const int lastRow = std::min(n - 1, k + lower);
+            double sum = b[k];
+            for (int i = k + 1; i <= lastRow; i++) {
+                sum -= At(i, k) * b[i];
+            }
+            b[k] = sum;
+            if (pivots[k] != k) {
+                std::swap(b[k], b[pivots[k]]);
+            }
+        }
+    }
+
+    // Algoritmo de Thomas para sistemas tridiagonais, sem pivoteamento (estável
+    // para matrizes diagonalmente dominantes ou SPD): O(n) e um vetor auxiliar.
+    // Como no dgtsv do LAPACK, lower[i] = a(i + 1, i) e upper[i] = a(i, i + 1)
+    // têm n - 1 posições. Retorna false se algum pivô não passar de tolerance.
+    static bool SolveTridiagonal(int n, const double* lower, const double* diagonal,
+                                 const double* upper, double* b, double tolerance) {
+        std::vector<double> modifiedUpper(std::max(0, n));
+        return SolveTridiagonal(n, lower, diagonal, upper, b, tolerance, modifiedUpper.data());
+    }
+
+    // Mesma coisa com o vetor auxiliar (n posições) fornecido pelo chamador
+    static bool SolveTridiagonal(int n, const double* lower, const double* diagonal,
+                                 const double* upper, double* b, double tolerance,
+                                 double* modifiedUpper) {
+        if (n <= 0) {
+            return true;
+        }
+        double pivot = diagonal[0];
+        for (int i = 0; ; i++) {
+            if (!(std::abs(pivot) > tolerance)) {
+                return false;
+            }
+            const double inversePivot = 1.0 / pivot;
+            b[i] *= inversePivot;
+            if (i == n - 1) {
+                break;
+            }
+            modifiedUpper[i] = upper[i] * inversePivot;
+            pivot = diagonal[i + 1] - lower[i] * modifiedUpper[i];
+            b[i + 1] -= lower[i] * b[i];
+        }
+
+        for (int i = n - 2; i >= 0; i--) {
+            b[i] -= modifiedUpper[i] * b[i + 1];
+        }
+        return true;
+    }
+};
@@ -0,0 +1,113 @@
+#pragma once
+#include <vector>
+#include <cstddef>
+#include <algorithm>
+#include "DenseMatrix.h"
+
+// Matriz quadrada em banda: só as diagonais de -lower a +upper são guardadas,
+// linha a linha (memória O(n·(lower + upper + 1))). O elemento (i, j) fica na
+// posição i·largura + (j - i + lower), então cada linha da banda é contígua.
+class BandMatrix {
+private:
+    int size;
+    int lower;
+    int upper;
+    std::vector<double> data;
+
+public:
+    BandMatrix() : size(0), lower(0), upper(0) {}
+
+    BandMatrix(int size, int lower, int upper)
+        : size(size), lower(std::max(0, lower)), upper(std::max(0, upper)),
+          data(static_cast<std::size_t>(size) * (this->lower + this->upper + 1), 0.0) {}
+
+    // Copiar a banda de uma matriz densa (entradas fora dela são ignoradas)
+    static BandMatrix FromDense(const DenseMatrix& dense, int lower, int upper) {
+        BandMatrix result(dense.Rows(), lower, upper);
+        for (int i = 0; i < result.size; i++) {
+            const int begin = std::max(0, i - result.lower);
+            const int end = std::min(result.size - 1, i + result.upper);
+            for (int j = begin; j <= end; j++) {
+                result(i, j) = dense(i, j);
+            }
+        }
+        return result;
+    }
+
+    // Larguras de banda inferior e superior de uma matriz densa quadrada.
+    // Retorna false (com a busca interrompida) assim que lower + upper + 1
+    // passar de maxWidth; matrizes cheias são rejeitadas já na primeira linha.
+    static bool DetectBandwidth(const DenseMatrix& dense, int maxWidth, int& lower, int& upper) {
+        const int n = dense.Rows();
+        lower = 0;
+        upper = 0;
+        for (int i = 0; i < n; i++) {
+            const double* rowData = dense.Row(i);
+            // Só colunas fora da banda atual podem aumentá-la
+            for (int j = 0; j < i - lower; j++) {
+                if (rowData[j] != 0.0) {
+                    lower = i - j;
+                    break;
+                }
+            }
+            for (int j = n - 1; j > i + upper; j--) {
+                if (rowData[j] != 0.0) {
+                    upper = j - i;
+                    break;
+                }
+            }
+            if (lower + upper + 1 > maxWidth) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    int Size() const { return size; }
+    int Lower() const { return lower; }
+    int Upper() const { return upper; }
+    int Width() const { return lower + upper + 1; }
+
+    // Acesso a (i, j) dentro da banda (|j - i| fora da banda não é verificado)
+    double& operator()(int i, int j) {
+        return data[static_cast<std::size_t>(i) * Width() + (j - i + lower)];
+    }
+    double operator()(int i, int j) const {
+        return data[static_cast<std::size_t>(i) * Width() + (j - i + lower)];
+    }
+
+    // Valor de (i, j), 0 fora da banda
+    double At(int i, int j) const {
+        return (j < i - lower || j > i + upper) ? 0.0 : (*this)(i, j);
+    }
+
+    // Linha i da banda: coluna i - lower na posição 0 (pode ser negativa)
+    const double* Row(int i) const { return data.data() + static_cast<std::size_t>(i) * Width(); }
+    double* Row(int i) { return data.data() + static_cast<std::size_t>(i) * Width(); }
+
+    // y = A·x
+    void Multiply(const double* x, double* y) const {
+        for (int i = 0; i < size; i++) {
+            const double* rowData = Row(i);
+            const int begin = std::max(0, i - lower);
+            const int end = std::min(size - 1, i + upper);
+            double sum = 0.0;
+            for (int j = begin; j <= end; j++) {
+                sum += rowData[j - i + lower] * x[j];
+            }
+            y[i] = sum;
+        }
+    }
+
+    DenseMatrix ToDense() const {
+        DenseMatrix result(size, size);
+        for (int i = 0; i < size; i++) {
+            const int begin = std::max(0, i - lower);
+            const int end = std::min(size - 1, i + upper);
+            for (int j = begin; j <= end; j++) {
+                result(i, j) = (*this)(i, j);
+            }
+        }
+        return result;
+    }
+};
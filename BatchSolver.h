@@ -0,0 +1,302 @@
+#pragma once
+#include <vector>
+#include <cmath>
+#include <memory>
+#include <algorithm>
+#include "LinearSolver.h"
+#include "ThreadPool.h"
+
+// Lote de sistemas independentes do mesmo tamanho em layout SoA
+// (structure-of-arrays): o elemento (i, j) de todos os sistemas fica contíguo,
+// de modo que cada operação da eliminação é aplicada a vários sistemas por
+// instrução SIMD.
+struct SystemBatch {
+    int size;   // Número de variáveis de cada sistema
+    int count;  // Número de sistemas
+    std::vector<double> coefficients; // [(i * size + j) * count + sistema]
+    std::vector<double> constants;    // [i * count + sistema]
+
+    SystemBatch() : size(0), count(0) {}
+
+    SystemBatch(int size, int count)
+        : size(size), count(count),
+          coefficients(static_cast<std::size_t>(size) * size * count, 0.0),
+          constants(static_cast<std::size_t>(size) * count, 0.0) {}
+
+    double& Coefficient(int system, int i, int j) {
+        return coefficients[(static_cast<std::size_t>(i) * size + j) * count + system];
+    }
+    double Coefficient(int system, int i, int j) const {
+        return coefficients[(static_cast<std::size_t>(i) * size + j) * count + system];
+    }
+    double& Constant(int system, int i) {
+        return constants[static_cast<std::size_t>(i) * count + system];
+    }
+    double Constant(int system, int i) const {
+        return constants[static_cast<std::size_t>(i) * count + system];
+    }
+};
+
+// Resultado de um lote: soluções no mesmo layout SoA das constantes
+struct BatchSolution {
+    std::vector<double> values; // [i * count + sistema]
+    std::vector<LinearSolver::SolutionStatus> status;
+    int count;
+
+    BatchSolution() : count(0) {}
+
+    double Value(int system, int i) const {
+        return values[static_cast<std::size_t>(i) * count + system];
+    }
+};
+
+// Resolve milhares de sistemas pequenos de uma vez, priorizando sistemas por
+// segundo: grupos de LANES sistemas avançam juntos pela eliminação (pivoteamento
+// parcial feito com seleções, sem desvios por sistema) e os grupos são
+// distribuídos entre as threads. Sistemas com pivô nulo são reclassificados
+// individualmente pelo LinearSolver.
+class BatchLinearSolver {
+public:
+    static constexpr int LANES = 8;
+
+private:
+    static constexpr double EPSILON = 1e-10;
+    static constexpr int GROUPS_PER_CHUNK = 16;
+
+    std::shared_ptr<ThreadPool> threadPool;
+    LinearSolver fallbackSolver;
+
+    // Eliminar um grupo de LANES sistemas armazenado em [(i * n + j) * LANES + l].
+    // Sempre expandido dentro das variantes por conjunto de instruções abaixo,
+    // para que o compilador vetorize os laços sobre as faixas com SSE2/AVX2/AVX-512.
+#if defined(__GNUC__) || defined(__clang__)
+    __attribute__((always_inline))
+#endif
+    static inline void SolveGroupKernel(int n, double* a, double* b, double* x, bool* singular) {
+        for (int l = 0; l < LANES; l++) {
+            singular[l] = false;
+        }
+
+        for (int k = 0; k < n; k++) {
+            // Busca do pivô por sistema
+            long long pivotRow[LANES]; // 64 bits, mesma largura das faixas de double
+            double maxAbs[LANES];
+            for (int l = 0; l < LANES; l++) {
+                pivotRow[l] = k;
+                maxAbs[l] = std::abs(a[(k * n + k) * LANES + l]);
+            }
+            for (int i = k + 1; i < n; i++) {
+                const double* column = a + (i * n + k) * LANES;
+                for (int l = 0; l < LANES; l++) {
+                    double value = std::abs(column[l]);
+                    bool greater = value > maxAbs[l];
+                    maxAbs[l] = greater ? value : maxAbs[l];
+                    pivotRow[l] = greater ? static_cast<long long>(i) : pivotRow[l];
+                }
+            }
+
+            // Troca de linhas por seleção: cada sistema troca k com a sua linha de pivô
+            for (int i = k + 1; i < n; i++) {
+                bool anyLane = false;
+                for (int l = 0; l < LANES; l++) {
+                    anyLane |= pivotRow[l] == i;
+                }
+                if (!anyLane) continue;
+
+                for (int j = k; j <= n; j++) {
+                    // j == n representa o vetor de constantes
+                    double* __restrict top = j < n ? a + (k * n + j) * LANES : b + k * LANES;
+                    double* __restrict other = j < n ? a + (i * n + j) * LANES : b + i * LANES;
+                    for (int l = 0; l < LANES; l++) {
+                        double upper = top[l];
+                        double lower = other[l];
+                        bool swapLane = pivotRow[l] == i;
+                        top[l] = swapLane ? lower : upper;
+                        other[l] = swapLane ? upper : lower;
+                    }
+                }
+            }
+
+            // Inverso do pivô (sistemas singulares seguem com 0 e são tratados depois)
+            double inversePivot[LANES];
+            for (int l = 0; l < LANES; l++) {
+                bool zeroPivot = !(maxAbs[l] > EPSILON);
+                singular[l] |= zeroPivot;
+                double pivot = a[(k * n + k) * LANES + l];
+                inversePivot[l] = zeroPivot ? 0.0 : 1.0 / (zeroPivot ? 1.0 : pivot);
+            }
+
+            // Eliminação abaixo do pivô
+            for (int i = k + 1; i < n; i++) {
+                double factor[LANES];
+                for (int l = 0; l < LANES; l++) {
+                    factor[l] = a[(i * n + k) * LANES + l] * inversePivot[l];
+                }
+                for (int j = k + 1; j < n; j++) {
+                    double* target = a + (i * n + j) * LANES;
+                    const double* source = a + (k * n + j) * LANES;
+                    for (int l = 0; l < LANES; l++) {
+                        target[l] -= factor[l] * source[l];
+                    }
+                }
+                for (int l = 0; l < LANES; l++) {
+                    b[i * LANES + l] -= factor[l] * b[k * LANES + l];
+                }
+            }
+        }
+
+        // Substituição regressiva
+        for (int i = n - 1; i >= 0; i--) {
+            double sum[LANES];
+            for (int l = 0; l < LANES; l++) {
+                sum[l] = b[i * LANES + l];
+            }
+            for (int j = i + 1; j < n; j++) {
+                const double* coefficient = a + (i * n + j) * LANES;
+                for (int l = 0; l < LANES; l++) {
+                    sum[l] -= coefficient[l] * x[j * LANES + l];
+                }
+            }
+            for (int l = 0; l < LANES; l++) {
+                double diagonal = a[(i * n + i) * LANES + l];
+                x[i * LANES + l] = singular[l] ? 0.0 : sum[l] / diagonal;
+            }
+        }
+    }
+
+    static void SolveGroupDefault(int n, double* a, double* b, double* x, bool* singular) {
+        SolveGroupKernel(n, a, b, x, singular);
+    }
+
+#ifdef LINEAR_SOLVER_SIMD_X86
+    __attribute__((target("avx2,fma")))
+    static void SolveGroupAvx2(int n, double* a, double* b, double* x, bool* singular) {
+        SolveGroupKernel(n, a, b, x, singular);
+    }
+
+    __attribute__((target("avx512f")))
+    static void SolveGroupAvx512(int n, double* a, double* b, double* x, bool* singular) {
+        SolveGroupKernel(n, a, b, x, singular);
+    }
+#endif
+
+    // Variante escolhida pelo mesmo despacho em tempo de execução dos kernels SIMD
+    static void SolveGroup(int n, double* a, double* b, double* x, bool* singular) {
+#ifdef LINEAR_SOLVER_SIMD_X86
+        switch (SimdKernels().level) {
+            case SimdLevel::AVX512:
+                SolveGroupAvx512(n, a, b, x, singular);
+                return;
+            case SimdLevel::AVX2:
+                SolveGroupAvx2(n, a, b, x, singular);
+                return;
+            default:
+                break;
+        }
+#endif
+        SolveGroupDefault(n, a, b, x, singular);
+    }
+
+    // Resolver um sistema isolado pelo caminho geral (classificação de singulares)
+    void SolveSingle(const SystemBatch& batch, int system, BatchSolution& result) const {
+        const int n = batch.size;
+        DenseMatrix matrix(n, n);
+        std::vector<double> constants(n);
+        for (int i = 0; i < n; i++) {
+            for (int j = 0; j < n; j++) {
+                matrix(i, j) = batch.Coefficient(system, i, j);
+            }
+            constants[i] = batch.Constant(system, i);
+        }
+
+        auto solution = fallbackSolver.Solve(matrix, constants);
+        result.status[system] = solution.status;
+        for (int i = 0; i < n; i++) {
+            result.values[static_cast<std::size_t>(i) * batch.count + system] =
+                solution.hasSolution ? solution.values[i] : 0.0;
+        }
+    }
+
+    // Resolver os grupos [groupBegin, groupEnd)
+    void SolveGroups(const SystemBatch& batch, int groupBegin, int groupEnd, BatchSolution& result) const {
+        const int n = batch.size;
+        const int count = batch.count;
+        std::vector<double> a(static_cast<std::size_t>(n) * n * LANES);
+        std::vector<double> b(static_cast<std::size_t>(n) * LANES);
+        std::vector<double> x(static_cast<std::size_t>(n) * LANES);
+        bool singular[LANES];
+
+        for (int group = groupBegin; group < groupEnd; group++) {
+            const int first = group * LANES;
+            const int lanes = std::min(LANES, count - first);
+
+            // Copiar o grupo; faixas vazias do último grupo recebem a identidade
+            for (int e = 0; e < n * n; e++) {
+                const double* source = batch.coefficients.data() + static_cast<std::size_t>(e) * count + first;
+                double* target = a.data() + static_cast<std::size_t>(e) * LANES;
+                const double padding = (e / n == e % n) ? 1.0 : 0.0;
+                for (int l = 0; l < LANES; l++) {
+                    target[l] = l < lanes ? source[l] : padding;
+                }
+            }
+            for (int i = 0; i < n; i++) {
+                const double* source = batch.constants.data() + static_cast<std::size_t>(i) * count + first;
+                for (int l = 0; l < LANES; l++) {
+                    b[i * LANES + l] = l < lanes ? source[l] : 0.0;
+                }
+            }
+
+            SolveGroup(n, a.data(), b.data(), x.data(), singular);
+
+            for (int l = 0; l < lanes; l++) {
+                bool finite = true;
+                for (int i = 0; i < n; i++) {
+                    finite = finite && std::isfinite(x[i * LANES + l]);
+                }
+
+                if (singular[l] || !finite) {
+                    SolveSingle(batch, first + l, result);
+                    continue;
+                }
+
+                result.status[first + l] = LinearSolver::SolutionStatus::UNIQUE_SOLUTION;
+                for (int i = 0; i < n; i++) {
+                    result.values[static_cast<std::size_t>(i) * count + first + l] = x[i * LANES + l];
+                }
+            }
+        }
+    }
+
+public:
+    // Número de threads (1 = sequencial, 0 = todos os núcleos)
+    void SetThreadCount(int count) {
+        if (count == 1) {
+            threadPool.reset();
+        } else {
+            threadPool = std::make_shared<ThreadPool>(count);
+        }
+    }
+
+    void SetThreadPool(std::shared_ptr<ThreadPool> pool) { threadPool = std::move(pool); }
+
+    // Resolver todos os sistemas do lote
+    BatchSolution Solve(const SystemBatch& batch) const {
+        BatchSolution result;
+        if (batch.size <= 0 || batch.count <= 0 ||
+            batch.coefficients.size() != static_cast<std::size_t>(batch.size) * batch.size * batch.count ||
+            batch.constants.size() != static_cast<std::size_t>(batch.size) * batch.count) {
+            return result;
+        }
+
+        result.count = batch.count;
+        result.values.assign(static_cast<std::size_t>(batch.size) * batch.count, 0.0);
+        result.status.assign(batch.count, LinearSolver::SolutionStatus::CALCULATION_ERROR);
+
+        const int groupCount = (batch.count + LANES - 1) / LANES;
+        ParallelFor(threadPool.get(), 0, groupCount, GROUPS_PER_CHUNK, [&](int groupBegin, int groupEnd) {
+            SolveGroups(batch, groupBegin, groupEnd, result);
+        });
+
+        return result;
+    }
+};
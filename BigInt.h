@@ -0,0 +1,383 @@
+#pragma once
+#include <vector>
+#include <string>
+#include <cstdint>
+#include <cmath>
+#include <algorithm>
+#include <type_traits>
+
+// Inteiro com sinal de precisão arbitrária (magnitude em limbs de 32 bits,
+// menos significativo primeiro). Só o necessário para a eliminação exata:
+// soma, subtração, multiplicação, divisão (algoritmo D de Knuth), mdc,
+// deslocamento, resíduo módulo um primo de 64 bits, conversão para double e
+// para texto.
+class BigInt {
+private:
+    using Limbs = std::vector<std::uint32_t>;
+
+    Limbs limbs;           // Sem zeros à esquerda; vazio representa zero
+    bool negative = false; // Nunca true para zero
+
+    void Trim() {
+        while (!limbs.empty() && limbs.back() == 0) {
+            limbs.pop_back();
+        }
+        if (limbs.empty()) {
+            negative = false;
+        }
+    }
+
+    static int CompareMagnitude(const Limbs& a, const Limbs& b) {
+        if (a.size() != b.size()) {
+            return a.size() < b.size() ? -1 : 1;
+        }
+        for (std::size_t i = a.size(); i-- > 0;) {
+            if (a[i] != b[i]) {
+                return a[i] < b[i] ? -1 : 1;
+            }
+        }
+        return 0;
+    }
+
+    static Limbs AddMagnitude(const Limbs& a, const Limbs& b) {
+        const Limbs& longer = a.size() >= b.size() ? a : b;
+        const Limbs& shorter = a.size() >= b.size() ? b : a;
+        Limbs result(longer.size() + 1);
+        std::uint64_t carry = 0;
+        for (std::size_t i = 0; i < longer.size(); i++) {
+            const std::uint64_t sum = static_cast<std::uint64_t>(longer[i]) + (i < shorter.size() ? shorter[i] : 0) + carry;
+            result[i] = static_cast<std::uint32_t>(sum);
+            carry = sum >> 32;
+        }
+        result[longer.size()] = static_cast<std::uint32_t>(carry);
+        return result;
+    }
+
+    // |a| - |b| com |a| >= |b|
+    static Limbs SubtractMagnitude(const Limbs& a, const Limbs& b) {
+        Limbs result(a.size());
+        std::int64_t borrow = 0;
+        for (std::size_t i = 0; i < a.size(); i++) {
+            std::int64_t difference = static_cast<std::int64_t>(a[i]) - (i < b.size() ? b[i] : 0) - borrow;
+            borrow = difference < 0 ? 1 : 0;
+            result[i] = static_cast<std::uint32_t>(difference + (borrow << 32));
+        }
+        return result;
+    }
+
+    static Limbs MultiplyMagnitude(const Limbs& a, const Limbs& b) {
+        if (a.empty() || b.empty()) {
+            return Limbs();
+        }
+        Limbs result(a.size() + b.size(), 0);
+        for (std::size_t i = 0; i < a.size(); i++) {
+            std::uint64_t carry = 0;
+            const std::uint64_t factor = a[i];
+            for (std::size_t j = 0; j < b.size(); j++) {
+                const std::uint64_t product = factor * b[j] + result[i + j] + carry;
+                result[i + j] = static_cast<std::uint32_t>(product);
+                carry = product >> 32;
+            }
+            result[i + b.size()] = static_cast<std::uint32_t>(carry);
+        }
+        return result;
+    }
+
+    // Divisão de magnitudes (algoritmo D de Knuth, como no divmnu do Hacker's
+    // Delight): quotient = ⌊u / v⌋, remainder = u - quotient·v
+    static void DivideMagnitude(const Limbs& u, const Limbs& v, Limbs& quotient, Limbs& remainder) {
+        if (CompareMagnitude(u, v) < 0) {
+            quotient.clear();
+            remainder = u;
+            return;
+        }
+        const std::size_t n = v.size();
+        const std::size_t m = u.size();
+        if (n == 1) {
+            quotient.assign(m, 0);
+            std::uint64_t rest = 0;
+            for (std::size_t i = m; i-- > 0;) {
+                const std::uint64_t current = (rest << 32) | u[i];
+                quotient[i] = static_cast<std::uint32_t>(current / v[0]);
+                rest = current % v[0];
+            }
+            remainder.assign(1, static_cast<std::uint32_t>(rest));
+            return;
+        }
+
+        // Normalizar para o bit mais alto do divisor ficar ligado
+        const int shift = __builtin_clz(v[n - 1]);
+        Limbs vn(n);
+        Limbs un(m + 1);
+        for (std::size_t i = n - 1; i > 0; i--) {
+            vn[i] = (v[i] << shift) | (shift ? static_cast<std::uint32_t>(static_cast<std::uint64_t>(v[i - 1]) >> (32 - shift)) : 0);
+        }
+        vn[0] = v[0] << shift;
+        un[m] = shift ? static_cast<std::uint32_t>(static_cast<std::uint64_t>(u[m - 1]) >> (32 - shift)) : 0;
+        for (std::size_t i = m - 1; i > 0; i--) {
+            un[i] = (u[i] << shift) | (shift ? static_cast<std::uint32_t>(static_cast<std::uint64_t>(u[i - 1]) >> (32 - shift)) : 0);
+        }
+        un[0] = u[0] << shift;
+
+        const std::uint64_t base = std::uint64_t(1) << 32;
+        quotient.assign(m - n + 1, 0);
+        for (std::size_t j = m - n + 1; j-- > 0;) {
+            const std::uint64_t numerator = (static_cast<std::uint64_t>(un[j + n]) << 32) | un[j + n - 1];
+            std::uint64_t estimate = numerator / vn[n - 1];
+            std::uint64_t rest = numerator % vn[n - 1];
+            while (estimate >= base || estimate * vn[n - 2] > ((rest << 32) | un[j + n - 2])) {
+                estimate--;
+                rest += vn[n - 1];
+                if (rest >= base) {
+                    break;
+                }
+            }
+
+            // un[j..j+n] -= estimate·vn
+            std::int64_t borrow = 0;
+            std::int64_t difference = 0;
+            for (std::size_t i = 0; i < n; i++) {
+                const std::uint64_t product = estimate * vn[i];
+                difference = static_cast<std::int64_t>(un[i + j]) - borrow - static_cast<std::int64_t>(product & 0xFFFFFFFFu);
+                un[i + j] = static_cast<std::uint32_t>(difference);
+                borrow = static_cast<std::int64_t>(product >> 32) - (difference >> 32);
+            }
+            difference = static_cast<std::int64_t>(un[j + n]) - borrow;
+            un[j + n] = static_cast<std::uint32_t>(difference);
+
+            quotient[j] = static_cast<std::uint32_t>(estimate);
+            if (difference < 0) {
+                // A estimativa passou em 1: devolver um divisor
+                quotient[j]--;
+                std::uint64_t carry = 0;
+                for (std::size_t i = 0; i < n; i++) {
+                    const std::uint64_t sum = static_cast<std::uint64_t>(un[i + j]) + vn[i] + carry;
+                    un[i + j] = static_cast<std::uint32_t>(sum);
+                    carry = sum >> 32;
+                }
+                un[j + n] = static_cast<std::uint32_t>(un[j + n] + carry);
+            }
+        }
+
+        remainder.assign(n, 0);
+        for (std::size_t i = 0; i < n; i++) {
+            remainder[i] = (un[i] >> shift) | (shift ? static_cast<std::uint32_t>(static_cast<std::uint64_t>(un[i + 1]) << (32 - shift)) : 0);
+        }
+    }
+
+    static BigInt FromMagnitude(Limbs&& magnitude, bool negative) {
+        BigInt result;
+        result.limbs = std::move(magnitude);
+        result.negative = negative;
+        result.Trim();
+        return result;
+    }
+
+public:
+    BigInt() = default;
+
+    template <typename Int, typename std::enable_if<std::is_integral<Int>::value, int>::type = 0>
+    BigInt(Int value) : negative(value < 0) {
+        std::uint64_t magnitude = value < 0 ? 0 - static_cast<std::uint64_t>(value) : static_cast<std::uint64_t>(value);
+        while (magnitude != 0) {
+            limbs.push_back(static_cast<std::uint32_t>(magnitude));
+            magnitude >>= 32;
+        }
+    }
+
+#ifdef __SIZEOF_INT128__
+    BigInt(__int128 value) : negative(value < 0) {
+        unsigned __int128 magnitude = value < 0 ? 0 - static_cast<unsigned __int128>(value) : static_cast<unsigned __int128>(value);
+        while (magnitude != 0) {
+            limbs.push_back(static_cast<std::uint32_t>(magnitude));
+            magnitude >>= 32;
+        }
+    }
+#endif
+
+    bool IsZero() const { return limbs.empty(); }
+    int Sign() const { return limbs.empty() ? 0 : (negative ? -1 : 1); }
+
+    // Número de bits da magnitude (0 para zero)
+    int BitLength() const {
+        if (limbs.empty()) {
+            return 0;
+        }
+        return static_cast<int>(limbs.size() - 1) * 32 + (32 - __builtin_clz(limbs.back()));
+    }
+
+    BigInt Abs() const {
+        BigInt result = *this;
+        result.negative = false;
+        return result;
+    }
+
+    BigInt operator-() const {
+        BigInt result = *this;
+        result.negative = !negative && !limbs.empty();
+        return result;
+    }
+
+    BigInt operator+(const BigInt& other) const {
+        if (negative == other.negative) {
+            return FromMagnitude(AddMagnitude(limbs, other.limbs), negative);
+        }
+        if (CompareMagnitude(limbs, other.limbs) >= 0) {
+            return FromMagnitude(SubtractMagnitude(limbs, other.limbs), negative);
+        }
+        return FromMagnitude(SubtractMagnitude(other.limbs, limbs), other.negative);
+    }
+
+    BigInt operator-(const BigInt& other) const {
+        return *this + (-other);
+    }
+
+    BigInt operator*(const BigInt& other) const {
+        return FromMagnitude(MultiplyMagnitude(limbs, other.limbs), negative != other.negative);
+    }
+
+    // Divisão truncada em direção a zero (como em C++); other != 0
+    BigInt operator/(const BigInt& other) const {
+        Limbs quotient;
+        Limbs remainder;
+        DivideMagnitude(limbs, other.limbs, quotient, remainder);
+        return FromMagnitude(std::move(quotient), negative != other.negative);
+    }
+
+    // Resto com o sinal do dividendo (como em C++)
+    BigInt operator%(const BigInt& other) const {
+        Limbs quotient;
+        Limbs remainder;
+        DivideMagnitude(limbs, other.limbs, quotient, remainder);
+        return FromMagnitude(std::move(remainder), negative);
+    }
+
+    BigInt& operator+=(const BigInt& other) { return *this = *this + other; }
+    BigInt& operator-=(const BigInt& other) { return *this = *this - other; }
+    BigInt& operator*=(const BigInt& other) { return *this = *this * other; }
+    BigInt& operator/=(const BigInt& other) { return *this = *this / other; }
+
+    bool operator==(const BigInt& other) const { return negative == other.negative && limbs == other.limbs; }
+    bool operator!=(const BigInt& other) const { return !(*this == other); }
+    bool operator<(const BigInt& other) const {
+        if (negative != other.negative) {
+            return negative;
+        }
+        const int comparison = CompareMagnitude(limbs, other.limbs);
+        return negative ? comparison > 0 : comparison < 0;
+    }
+    bool operator>(const BigInt& other) const { return other < *this; }
+    bool operator<=(const BigInt& other) const { return !(other < *this); }
+    bool operator>=(const BigInt& other) const { return !(*this < other); }
+
+    // x·2^bits (bits >= 0)
+    BigInt ShiftLeft(int bits) const {
+        if (limbs.empty() || bits == 0) {
+            return *this;
+        }
+        const int limbShift = bits / 32;
+        const int bitShift = bits % 32;
+        Limbs result(limbs.size() + limbShift + 1, 0);
+        for (std::size_t i = 0; i < limbs.size(); i++) {
+            const std::uint64_t shifted = static_cast<std::uint64_t>(limbs[i]) << bitShift;
+            result[i + limbShift] |= static_cast<std::uint32_t>(shifted);
+            result[i + limbShift + 1] = static_cast<std::uint32_t>(shifted >> 32);
+        }
+        return FromMagnitude(std::move(result), negative);
+    }
+
+    // Resíduo em [0, modulus) para um módulo de até 64 bits (Horner nos limbs)
+    std::uint64_t Mod(std::uint64_t modulus) const {
+        if (modulus <= 0xFFFFFFFFu) {
+            // Módulo de 32 bits (primos da eliminação modular): resto parcial
+            // e limb cabem juntos em 64 bits, sem a divisão de 128 bits
+            std::uint64_t rest = 0;
+            for (std::size_t i = limbs.size(); i-- > 0;) {
+                rest = ((rest << 32) | limbs[i]) % modulus;
+            }
+            return (negative && rest != 0) ? modulus - rest : rest;
+        }
+        unsigned __int128 rest = 0;
+        for (std::size_t i = limbs.size(); i-- > 0;) {
+            rest = ((rest << 32) | limbs[i]) % modulus;
+        }
+        const std::uint64_t residue = static_cast<std::uint64_t>(rest);
+        return (negative && residue != 0) ? modulus - residue : residue;
+    }
+
+    // Máximo divisor comum (não negativo) pelo algoritmo de Euclides
+    static BigInt Gcd(BigInt a, BigInt b) {
+        a.negative = false;
+        b.negative = false;
+        while (!b.IsZero()) {
+            BigInt rest = a % b;
+            a = std::move(b);
+            b = std::move(rest);
+        }
+        return a;
+    }
+
+    // a / b em double sem estourar quando os dois são grandes: usa só os 64
+    // bits mais altos de cada um
+    static double Ratio(const BigInt& a, const BigInt& b) {
+        const int shiftA = std::max(0, a.BitLength() - 64);
+        const int shiftB = std::max(0, b.BitLength() - 64);
+        return std::ldexp(a.TopBits(shiftA) / b.TopBits(shiftB), shiftA - shiftB);
+    }
+
+    double ToDouble() const {
+        const int shift = std::max(0, BitLength() - 64);
+        return std::ldexp(TopBits(shift), shift);
+    }
+
+    // ln|x| (-inf para zero), sem estouro para qualquer tamanho
+    double LogAbs() const {
+        if (IsZero()) {
+            return -HUGE_VAL;
+        }
+        const int shift = std::max(0, BitLength() - 64);
+        return std::log(std::abs(TopBits(shift))) + shift * 0.6931471805599453;
+    }
+
+    std::string ToString() const {
+        if (limbs.empty()) {
+            return "0";
+        }
+        // Dividir repetidamente por 10⁹ e juntar os blocos de 9 dígitos
+        std::vector<std::uint32_t> blocks;
+        Limbs magnitude = limbs;
+        while (!magnitude.empty()) {
+            std::uint64_t rest = 0;
+            for (std::size_t i = magnitude.size(); i-- > 0;) {
+                const std::uint64_t current = (rest << 32) | magnitude[i];
+                magnitude[i] = static_cast<std::uint32_t>(current / 1000000000u);
+                rest = current % 1000000000u;
+            }
+            blocks.push_back(static_cast<std::uint32_t>(rest));
+            while (!magnitude.empty() && magnitude.back() == 0) {
+                magnitude.pop_back();
+            }
+        }
+        std::string text = negative ? "-" : "";
+        text += std::to_string(blocks.back());
+        for (std::size_t i = blocks.size() - 1; i-- > 0;) {
+            std::string block = std::to_string(blocks[i]);
+            text += std::string(9 - block.size(), '0') + block;
+        }
+        return text;
+    }
+
+private:
+    // (x >> shift) como double com sinal (cabe em 64 bits quando shift é o
+    // excesso de BitLength() sobre 64)
+    double TopBits(int shift) const {
+        double value = 0.0;
+        const int firstLimb = shift / 32;
+        const int bitShift = shift % 32;
+        for (std::size_t i = limbs.size(); i-- > static_cast<std::size_t>(firstLimb);) {
+            value = value * 4294967296.0 + limbs[i];
+        }
+        value = std::ldexp(value, -bitShift);
+        return negative ? -value : value;
+    }
+};
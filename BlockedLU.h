@@ -0,0 +1,261 @@
+#pragma once
+#include <vector>
+#include <cmath>
+#include <algorithm>
+#include "DenseMatrix.h"
+#include "SimdKernels.h"
+#include "ThreadPool.h"
+
+// Fatoração LU em blocos (tiled) com pivoteamento parcial: P·A = L·U.
+// Cada painel de "blockSize" colunas é fatorado sem blocos; em seguida o bloco
+// U12 é obtido por substituição triangular e a submatriz restante recebe uma
+// atualização no estilo GEMM (A22 -= L21·U12), percorrida em ladrilhos de
+// colunas para que U12 permaneça no cache durante a atualização.
+// Com um ThreadPool, a atualização de U12/A22 e as substituições com várias
+// colunas são divididas entre as threads (linhas ou faixas de colunas).
+template <typename T>
+class BlockedLU {
+public:
+    static constexpr int DEFAULT_BLOCK_SIZE = 64;
+    static constexpr int COLUMN_TILE = 128;
+    static constexpr int RHS_TILE = 256;
+
+private:
+    // Fatorar o painel [k0, k0 + kb) sem blocos. Retorna a coluna com pivô nulo ou -1
+    static int FactorPanel(DenseMatrixT<T>& a, int k0, int kb, std::vector<int>& pivots, T tolerance) {
+        const int n = a.Rows();
+        const int stride = a.Stride();
+        const int panelEnd = k0 + kb;
+
+        for (int k = k0; k < panelEnd; k++) {
+            // Encontrar pivô na coluna k
+            int pivotRow = k + SimdIndexOfMaxAbs(n - k, &a(k, k), stride);
+            T maxAbs = std::abs(a(pivotRow, k));
+
+            if (!(maxAbs > tolerance)) {
+                return k;
+            }
+
+            // Trocar linhas inteiras para manter L e a parte ainda não fatorada consistentes
+            pivots[k] = pivotRow;
+            a.SwapRows(k, pivotRow);
+
+            const T* pivotRowData = a.Row(k);
+            const T inversePivot = T(1) / pivotRowData[k];
+
+            // Calcular multiplicadores e atualizar o restante do painel
+            for (int i = k + 1; i < n; i++) {
+                T* rowData = a.Row(i);
+                T factor = rowData[k] * inversePivot;
+                rowData[k] = factor;
+                if (factor != T(0)) {
+                    SimdAxpy(panelEnd - k - 1, -factor, pivotRowData + k + 1, rowData + k + 1);
+                }
+            }
+        }
+
+        return -1;
+    }
+
+    // U12 = L11^{-1} · A12 (L11 triangular inferior unitária), colunas [colBegin, colEnd)
+    static void SolveUpperBlock(DenseMatrixT<T>& a, int k0, int kb, int colBegin, int colEnd) {
+        const int panelEnd = k0 + kb;
+
+        for (int i = k0 + 1; i < panelEnd; i++) {
+            T* rowData = a.Row(i);
+            for (int p = k0; p < i; p++) {
+                const T factor = rowData[p];
+                if (factor == T(0)) continue;
+                SimdAxpy(colEnd - colBegin, -factor, a.Row(p) + colBegin, rowData + colBegin);
+            }
+        }
+    }
+
+    // Micro-kernel: bloco de MR x NR elementos de A22 mantido em registradores
+    // enquanto acumula a contribuição de todas as kb colunas do painel
+    static constexpr int MR = 4;
+    static constexpr int NR = 8;
+
+    static void MicroKernel(DenseMatrixT<T>& a, int k0, int kb, int i0, int j0) {
+        const std::ptrdiff_t stride = a.Stride();
+        SimdGemm4x8(kb, &a(i0, k0), stride, &a(k0, j0), stride, &a(i0, j0), stride);
+    }
+
+    // Atualização genérica (bordas que não completam um micro-bloco)
+    static void UpdateEdge(DenseMatrixT<T>& a, int k0, int kb,
+                           int rowBegin, int rowEnd, int colBegin, int colEnd) {
+        for (int i = rowBegin; i < rowEnd; i++) {
+            T* rowData = a.Row(i);
+            for (int p = k0; p < k0 + kb; p++) {
+                const T factor = rowData[p];
+                if (factor == T(0)) continue;
+                SimdAxpy(colEnd - colBegin, -factor, a.Row(p) + colBegin, rowData + colBegin);
+            }
+        }
+    }
+
+    // A22 -= L21 · U12, linhas [rowBegin, rowEnd)
+    static void UpdateTrailing(DenseMatrixT<T>& a, int k0, int kb, int rowBegin, int rowEnd) {
+        const int n = a.Cols();
+        const int panelEnd = k0 + kb;
+
+        for (int jj = panelEnd; jj < n; jj += COLUMN_TILE) {
+            const int jEnd = std::min(n, jj + COLUMN_TILE);
+            const int jFull = jj + ((jEnd - jj) / NR) * NR;
+            int i = rowBegin;
+
+            for (; i + MR <= rowEnd; i += MR) {
+                for (int j = jj; j < jFull; j += NR) {
+                    MicroKernel(a, k0, kb, i, j);
+                }
+                if (jFull < jEnd) {
+                    UpdateEdge(a, k0, kb, i, i + MR, jFull, jEnd);
+                }
+            }
+
+            if (i < rowEnd) {
+                UpdateEdge(a, k0, kb, i, rowEnd, jj, jEnd);
+            }
+        }
+    }
+
+public:
+    // Fatorar a matriz quadrada in-place. pivots[k] guarda a linha trocada com k.
+    // Retorna -1 em caso de sucesso ou a primeira coluna sem pivô utilizável.
+    static int Factor(DenseMatrixT<T>& a, std::vector<int>& pivots,
+                      int blockSize, T tolerance, ThreadPool* pool = nullptr) {
+        const int n = a.Rows();
+        pivots.resize(n);
+        for (int k = 0; k < n; k++) {
+            pivots[k] = k;
+        }
+
+        if (blockSize < 1) {
+            blockSize = DEFAULT_BLOCK_SIZE;
+        }
+
+        for (int k0 = 0; k0 < n; k0 += blockSize) {
+            const int kb = std::min(blockSize, n - k0);
+
+            int failedColumn = FactorPanel(a, k0, kb, pivots, tolerance);
+            if (failedColumn != -1) {
+                return failedColumn;
+            }
+
+            if (k0 + kb < n) {
+                ParallelFor(pool, k0 + kb, n, COLUMN_TILE, [&](int colBegin, int colEnd) {
+                    SolveUpperBlock(a, k0, kb, colBegin, colEnd);
+                });
+                ParallelFor(pool, k0 + kb, n, 2 * MR, [&](int rowBegin, int rowEnd) {
+                    UpdateTrailing(a, k0, kb, rowBegin, rowEnd);
+                });
+            }
+        }
+
+        return -1;
+    }
+
+    // Resolver L·U·x = P·b in-place a partir dos fatores
+    static void SolveInPlace(const DenseMatrixT<T>& lu, const std::vector<int>& pivots, T* b) {
+        const int n = lu.Rows();
+
+        for (int k = 0; k < n; k++) {
+            if (pivots[k] != k) {
+                std::swap(b[k], b[pivots[k]]);
+            }
+        }
+
+        // Substituição progressiva (L unitária)
+        for (int i = 1; i < n; i++) {
+            const T* rowData = lu.Row(i);
+            T sum = b[i];
+            for (int j = 0; j < i; j++) {
+                sum -= rowData[j] * b[j];
+            }
+            b[i] = sum;
+        }
+
+        // Substituição regressiva
+        for (int i = n - 1; i >= 0; i--) {
+            const T* rowData = lu.Row(i);
+            T sum = b[i];
+            for (int j = i + 1; j < n; j++) {
+                sum -= rowData[j] * b[j];
+            }
+            b[i] = sum / rowData[i];
+        }
+    }
+
+    // Resolver Aᵀ·x = b in-place (Aᵀ = Uᵀ·Lᵀ·P): as linhas de U e L são as
+    // colunas dos fatores transpostos, então as substituições viram axpy por linha
+    static void SolveTransposeInPlace(const DenseMatrixT<T>& lu, const std::vector<int>& pivots, T* b) {
+        const int n = lu.Rows();
+
+        // Uᵀ·y = b
+        for (int i = 0; i < n; i++) {
+            const T* rowData = lu.Row(i);
+            b[i] /= rowData[i];
+            SimdAxpy(n - i - 1, -b[i], rowData + i + 1, b + i + 1);
+        }
+
+        // Lᵀ·z = y (L unitária)
+        for (int i = n - 1; i > 0; i--) {
+            SimdAxpy(i, -b[i], lu.Row(i), b);
+        }
+
+        for (int k = n - 1; k >= 0; k--) {
+            if (pivots[k] != k) {
+                std::swap(b[k], b[pivots[k]]);
+            }
+        }
+    }
+
+    // Resolver L·U·X = P·B in-place para várias colunas de B.
+    // As substituições percorrem B em faixas de colunas, de modo que cada linha
+    // de L/U carregada é aplicada a até RHS_TILE vetores de uma vez.
+    static void SolveInPlace(const DenseMatrixT<T>& lu, const std::vector<int>& pivots, DenseMatrixT<T>& b,
+                             ThreadPool* pool = nullptr) {
+        const int n = lu.Rows();
+        const int k = b.Cols();
+
+        for (int row = 0; row < n; row++) {
+            b.SwapRows(row, pivots[row]);
+        }
+
+        // Faixas de colunas são independentes e podem ir para threads diferentes
+        ParallelFor(pool, 0, k, RHS_TILE / 4, [&](int colBegin, int colEnd) {
+            for (int c0 = colBegin; c0 < colEnd; c0 += RHS_TILE) {
+                SolveColumns(lu, b, c0, std::min(colEnd, c0 + RHS_TILE));
+            }
+        });
+    }
+
+private:
+    // Substituições progressiva e regressiva para as colunas [c0, c1) de B
+    static void SolveColumns(const DenseMatrixT<T>& lu, DenseMatrixT<T>& b, int c0, int c1) {
+        const int n = lu.Rows();
+
+        // Substituição progressiva (L unitária)
+        for (int i = 1; i < n; i++) {
+            const T* rowData = lu.Row(i);
+            T* target = b.Row(i);
+            for (int j = 0; j < i; j++) {
+                const T factor = rowData[j];
+                if (factor == T(0)) continue;
+                SimdAxpy(c1 - c0, -factor, b.Row(j) + c0, target + c0);
+            }
+        }
+
+        // Substituição regressiva
+        for (int i = n - 1; i >= 0; i--) {
+            const T* rowData = lu.Row(i);
+            T* target = b.Row(i);
+            for (int j = i + 1; j < n; j++) {
+                const T factor = rowData[j];
+                if (factor == T(0)) continue;
+                SimdAxpy(c1 - c0, -factor, b.Row(j) + c0, target + c0);
+            }
+            SimdScale(c1 - c0, T(1) / rowData[i], target + c0);
+        }
+    }
+};
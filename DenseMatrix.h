@@ -0,0 +1,207 @@
+#pragma once
+#include <vector>
+#include <new>
+#include <memory>
+#include <cstddef>
+#include <cstring>
+#include <algorithm>
+
+// Matriz densa em ordem de linhas (row-major) com uma única alocação alinhada.
+// Cada linha ocupa "Stride()" elementos (leading dimension), preenchido até um
+// múltiplo de 64 bytes para que todas as linhas comecem alinhadas à linha de cache.
+// Uma visão (View) usa memória de fora, como um arquivo mapeado, sem copiar:
+// a cópia de uma visão é uma matriz comum, e a visão só passa a ter memória
+// própria se Resize() precisar de mais espaço.
+template <typename T>
+class DenseMatrixT {
+public:
+    static constexpr std::size_t ALIGNMENT = 64;
+
+private:
+    T* data;
+    int rows;
+    int cols;
+    int stride;
+    std::size_t capacity; // Elementos alocados (>= rows * stride)
+    bool external = false;        // Memória de fora (visão), não é liberada aqui
+    std::shared_ptr<void> owner;  // Mantém a memória da visão viva
+
+    // Calcular leading dimension preenchida até o alinhamento
+    static int PaddedStride(int cols) {
+        const int perLine = static_cast<int>(ALIGNMENT / sizeof(T));
+        return ((cols + perLine - 1) / perLine) * perLine;
+    }
+
+    static T* Allocate(std::size_t count) {
+        if (count == 0) {
+            return nullptr;
+        }
+        return static_cast<T*>(::operator new(count * sizeof(T), std::align_val_t(ALIGNMENT)));
+    }
+
+    static void Deallocate(T* ptr) {
+        if (ptr) {
+            ::operator delete(ptr, std::align_val_t(ALIGNMENT));
+        }
+    }
+
+    // Liberar a memória própria ou soltar a externa
+    void Release() {
+        if (external) {
+            external = false;
+            owner.reset();
+        } else {
+            Deallocate(data);
+        }
+        data = nullptr;
+    }
+
+public:
+    DenseMatrixT() : data(nullptr), rows(0), cols(0), stride(0), capacity(0) {}
+
+    DenseMatrixT(int rows, int cols, T value = T())
+        : data(nullptr), rows(rows), cols(cols), stride(PaddedStride(cols)),
+          capacity(static_cast<std::size_t>(rows) * stride) {
+        data = Allocate(capacity);
+        std::fill(data, data + capacity, value);
+    }
+
+    // Construir a partir do formato antigo vector<vector<T>>
+    explicit DenseMatrixT(const std::vector<std::vector<T>>& source)
+        : DenseMatrixT(static_cast<int>(source.size()),
+                       source.empty() ? 0 : static_cast<int>(source[0].size())) {
+        for (int i = 0; i < rows; i++) {
+            int count = std::min(cols, static_cast<int>(source[i].size()));
+            std::copy(source[i].begin(), source[i].begin() + count, Row(i));
+        }
+    }
+
+    DenseMatrixT(const DenseMatrixT& other)
+        : data(nullptr), rows(other.rows), cols(other.cols), stride(other.stride),
+          capacity(static_cast<std::size_t>(other.rows) * other.stride) {
+        data = Allocate(capacity);
+        if (capacity > 0) {
+            std::memcpy(data, other.data, capacity * sizeof(T));
+        }
+    }
+
+    DenseMatrixT(DenseMatrixT&& other) noexcept
+        : data(other.data), rows(other.rows), cols(other.cols), stride(other.stride),
+          capacity(other.capacity), external(other.external), owner(std::move(other.owner)) {
+        other.data = nullptr;
+        other.rows = other.cols = other.stride = 0;
+        other.capacity = 0;
+        other.external = false;
+    }
+
+    // A cópia reaproveita a alocação atual quando ela comporta a outra matriz
+    DenseMatrixT& operator=(const DenseMatrixT& other) {
+        if (this != &other) {
+            Resize(other.rows, other.cols);
+            const std::size_t count = static_cast<std::size_t>(rows) * stride;
+            if (count > 0) {
+                std::memcpy(data, other.data, count * sizeof(T));
+            }
+        }
+        return *this;
+    }
+
+    DenseMatrixT& operator=(DenseMatrixT&& other) noexcept {
+        if (this != &other) {
+            Release();
+            data = other.data;
+            rows = other.rows;
+            cols = other.cols;
+            stride = other.stride;
+            capacity = other.capacity;
+            external = other.external;
+            owner = std::move(other.owner);
+            other.data = nullptr;
+            other.rows = other.cols = other.stride = 0;
+            other.capacity = 0;
+            other.external = false;
+        }
+        return *this;
+    }
+
+    ~DenseMatrixT() {
+        Release();
+    }
+
+    // Visão de rows x cols elementos em memória externa, sem cópia. O endereço
+    // deve estar alinhado a ALIGNMENT e stride deve ser PaddedStride(cols);
+    // owner (opcional) mantém a memória viva enquanto a visão existir.
+    static DenseMatrixT View(T* memory, int rows, int cols, std::shared_ptr<void> owner = nullptr) {
+        DenseMatrixT view;
+        view.data = memory;
+        view.rows = rows;
+        view.cols = cols;
+        view.stride = PaddedStride(cols);
+        view.capacity = static_cast<std::size_t>(rows) * view.stride;
+        view.external = true;
+        view.owner = std::move(owner);
+        return view;
+    }
+
+    void Swap(DenseMatrixT& other) noexcept {
+        std::swap(data, other.data);
+        std::swap(rows, other.rows);
+        std::swap(cols, other.cols);
+        std::swap(stride, other.stride);
+        std::swap(capacity, other.capacity);
+        std::swap(external, other.external);
+        std::swap(owner, other.owner);
+    }
+
+    // Mudar as dimensões sem preservar o conteúdo; só aloca se a capacidade
+    // atual não bastar (workspaces reutilizados entre chamadas)
+    void Resize(int newRows, int newCols) {
+        const int newStride = PaddedStride(newCols);
+        const std::size_t count = static_cast<std::size_t>(newRows) * newStride;
+        if (count > capacity) {
+            T* replacement = Allocate(count);
+            Release();
+            data = replacement;
+            capacity = count;
+        }
+        rows = newRows;
+        cols = newCols;
+        stride = newStride;
+    }
+
+    // Número de colunas armazenadas por linha para uma largura cols
+    static int StrideFor(int cols) { return PaddedStride(cols); }
+
+    int Rows() const { return rows; }
+    int Cols() const { return cols; }
+    int Stride() const { return stride; }
+    bool Empty() const { return rows == 0 || cols == 0; }
+    bool IsView() const { return external; }
+
+    T* Data() { return data; }
+    const T* Data() const { return data; }
+
+    T* Row(int i) { return data + static_cast<std::size_t>(i) * stride; }
+    const T* Row(int i) const { return data + static_cast<std::size_t>(i) * stride; }
+
+    T& operator()(int i, int j) { return data[static_cast<std::size_t>(i) * stride + j]; }
+    const T& operator()(int i, int j) const { return data[static_cast<std::size_t>(i) * stride + j]; }
+
+    // Trocar duas linhas elemento a elemento (os dados ficam contíguos)
+    void SwapRows(int row1, int row2) {
+        if (row1 != row2) {
+            std::swap_ranges(Row(row1), Row(row1) + cols, Row(row2));
+        }
+    }
+
+    // Converter de volta para o formato antigo
+    std::vector<std::vector<T>> ToVector() const {
+        std::vector<std::vector<T>> result(rows, std::vector<T>(cols));
+        for (int i = 0; i < rows; i++) {
+            std::copy(Row(i), Row(i) + cols, result[i].begin());
+        }
+        return result;
+    }
+};
+
+using DenseMatrix = DenseMatrixT<double>;
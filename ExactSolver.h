@@ -0,0 +1,271 @@
+#pragma once
+#include <vector>
+#include <string>
+#include <cmath>
+#include <cstdint>
+#include "DenseMatrix.h"
+#include "BigInt.h"
+
+// Eliminação de Bareiss (livre de frações) para sistemas com coeficientes
+// inteiros: cada entrada intermediária é um menor da matriz original, então
+// todas as divisões são exatas e não há epsilon. Posto, classificação
+// (única / sem solução / infinitas), determinante e solução racional saem sem
+// erro de arredondamento. A eliminação roda em int64; se algum produto
+// estourar, recomeça em __int128 e por fim em BigInt, de modo que sistemas
+// pequenos pagam só aritmética de máquina.
+class ExactSolver {
+public:
+    enum class Outcome {
+        UNIQUE_SOLUTION,
+        NO_SOLUTION,
+        INFINITE_SOLUTIONS,
+        NOT_INTEGRAL  // Algum coeficiente não é inteiro (ou passa de 2^53)
+    };
+
+    // Aritmética em que a eliminação terminou
+    enum class Arithmetic {
+        INT64,
+        INT128,
+        BIGINT
+    };
+
+    // Fração irredutível com denominador positivo
+    struct Rational {
+        BigInt numerator;
+        BigInt denominator = 1;
+
+        double ToDouble() const { return BigInt::Ratio(numerator, denominator); }
+
+        // Valor exato de um double finito: mantissa·2^expoente
+        static Rational FromDouble(double value) {
+            Rational result;
+            int exponent = 0;
+            const double mantissa = std::frexp(value, &exponent);
+            long long integer = static_cast<long long>(std::ldexp(mantissa, 53));
+            exponent -= 53;
+            while (integer != 0 && integer % 2 == 0 && exponent < 0) {
+                integer /= 2;
+                exponent++;
+            }
+            result.numerator = BigInt(integer);
+            if (integer == 0) {
+                return result;
+            }
+            if (exponent >= 0) {
+                result.numerator = result.numerator.ShiftLeft(exponent);
+            } else {
+                result.denominator = BigInt(1).ShiftLeft(-exponent);
+            }
+            return result;
+        }
+
+        std::string ToString() const {
+            return denominator == BigInt(1) ? numerator.ToString()
+                                            : numerator.ToString() + "/" + denominator.ToString();
+        }
+    };
+
+    struct Result {
+        Outcome outcome = Outcome::NOT_INTEGRAL;
+        Arithmetic arithmetic = Arithmetic::INT64;
+        int rank = -1;
+        BigInt determinant;           // Exato (0 se singular)
+        std::vector<Rational> values; // Só com solução única
+    };
+
+    // Maior inteiro que o double representa sem lacunas
+    static constexpr double MAX_EXACT_INTEGER = 9007199254740992.0; // 2^53
+
+private:
+    // Operações com detecção de estouro para os inteiros de máquina
+    template <typename Int>
+    struct Checked {
+        static bool Multiply(const Int& a, const Int& b, Int& result) { return !__builtin_mul_overflow(a, b, &result); }
+        static bool Subtract(const Int& a, const Int& b, Int& result) { return !__builtin_sub_overflow(a, b, &result); }
+        static bool IsZero(const Int& value) { return value == 0; }
+        static BigInt ToBig(const Int& value) { return BigInt(value); }
+    };
+
+    // Eliminação em uma aritmética; false se algum valor estourou o tipo.
+    // m é a matriz aumentada [A|b] n x (n + 1) em ordem de linhas.
+    template <typename Int, typename Ops>
+    static bool Eliminate(std::vector<Int>& m, int n, Result& result) {
+        const int cols = n + 1;
+        auto at = [&](int i, int j) -> Int& { return m[static_cast<std::size_t>(i) * cols + j]; };
+
+        Int previous = 1;
+        bool negate = false;
+        int rank = 0;
+        for (int col = 0; col < n && rank < n; col++) {
+            int pivotRow = rank;
+            while (pivotRow < n && Ops::IsZero(at(pivotRow, col))) {
+                pivotRow++;
+            }
+            if (pivotRow == n) {
+                continue; // Coluna sem pivô: posto incompleto
+            }
+            if (pivotRow != rank) {
+                for (int j = col; j < cols; j++) {
+                    std::swap(at(pivotRow, j), at(rank, j));
+                }
+                negate = !negate;
+            }
+
+            // m[i][j] = (pivô·m[i][j] - m[i][col]·m[rank][j]) / pivô anterior (exata)
+            const Int pivot = at(rank, col);
+            for (int i = rank + 1; i < n; i++) {
+                const Int factor = at(i, col);
+                for (int j = col + 1; j < cols; j++) {
+                    Int left;
+                    Int right;
+                    if (!Ops::Multiply(pivot, at(i, j), left) || !Ops::Multiply(factor, at(rank, j), right) ||
+                        !Ops::Subtract(left, right, at(i, j))) {
+                        return false;
+                    }
+                    at(i, j) = at(i, j) / previous;
+                }
+                at(i, col) = 0;
+            }
+            previous = pivot;
+            rank++;
+        }
+
+        result.rank = rank;
+        // Linhas sem pivô viraram 0 = b'_i: qualquer b'_i não nulo é inconsistência
+        for (int i = rank; i < n; i++) {
+            if (!Ops::IsZero(at(i, n))) {
+                result.outcome = Outcome::NO_SOLUTION;
+                result.determinant = BigInt();
+                return true;
+            }
+        }
+        if (rank < n) {
+            result.outcome = Outcome::INFINITE_SOLUTIONS;
+            result.determinant = BigInt();
+            return true;
+        }
+
+        // O último pivô de Bareiss é det(P·A). Pela regra de Cramer y = det·x é
+        // inteiro, e a substituição regressiva em y só faz divisões exatas.
+        const Int determinant = at(n - 1, n - 1);
+        std::vector<Int> y(n);
+        for (int i = n - 1; i >= 0; i--) {
+            Int sum;
+            if (!Ops::Multiply(determinant, at(i, n), sum)) {
+                return false;
+            }
+            for (int j = i + 1; j < n; j++) {
+                Int product;
+                if (!Ops::Multiply(at(i, j), y[j], product) || !Ops::Subtract(sum, product, sum)) {
+                    return false;
+                }
+            }
+            y[i] = sum / at(i, i);
+        }
+
+        result.outcome = Outcome::UNIQUE_SOLUTION;
+        const BigInt denominator = Ops::ToBig(determinant);
+        result.determinant = negate ? -denominator : denominator;
+        result.values.resize(n);
+        for (int i = 0; i < n; i++) {
+            Rational& value = result.values[i];
+            value.numerator = Ops::ToBig(y[i]);
+            value.denominator = denominator;
+            const BigInt divisor = BigInt::Gcd(value.numerator, value.denominator);
+            if (divisor != BigInt(1)) {
+                value.numerator /= divisor;
+                value.denominator /= divisor;
+            }
+            if (value.denominator.Sign() < 0) {
+                value.numerator = -value.numerator;
+                value.denominator = -value.denominator;
+            }
+        }
+        return true;
+    }
+
+    template <typename Int, typename Ops>
+    static bool TrySolve(const DenseMatrix& a, const std::vector<double>& b, Result& result) {
+        const int n = a.Rows();
+        std::vector<Int> m(static_cast<std::size_t>(n) * (n + 1));
+        for (int i = 0; i < n; i++) {
+            for (int j = 0; j < n; j++) {
+                m[static_cast<std::size_t>(i) * (n + 1) + j] = Int(static_cast<long long>(a(i, j)));
+            }
+            m[static_cast<std::size_t>(i) * (n + 1) + n] = Int(static_cast<long long>(b[i]));
+        }
+        return Eliminate<Int, Ops>(m, n, result);
+    }
+
+public:
+    // Inteiro representado exatamente (|x| <= 2^53)?
+    static bool IsIntegral(double value) {
+        return std::abs(value) <= MAX_EXACT_INTEGER && value == std::trunc(value);
+    }
+
+    // Todos os coeficientes e constantes são inteiros?
+    static bool IsIntegral(const DenseMatrix& a, const std::vector<double>& b) {
+        for (int i = 0; i < a.Rows(); i++) {
+            for (int j = 0; j < a.Cols(); j++) {
+                if (!IsIntegral(a(i, j))) {
+                    return false;
+                }
+            }
+        }
+        for (double value : b) {
+            if (!IsIntegral(value)) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    // Resolver A·x = b exatamente (A quadrada, b com n elementos)
+    static Result Solve(const DenseMatrix& a, const std::vector<double>& b) {
+        Result result;
+        const int n = a.Rows();
+        if (n == 0 || a.Cols() != n || static_cast<int>(b.size()) != n || !IsIntegral(a, b)) {
+            return result;
+        }
+
+        result.arithmetic = Arithmetic::INT64;
+        if (TrySolve<std::int64_t, Checked<std::int64_t>>(a, b, result)) {
+            return result;
+        }
+#ifdef __SIZEOF_INT128__
+        result.arithmetic = Arithmetic::INT128;
+        if (TrySolve<__int128, Checked<__int128>>(a, b, result)) {
+            return result;
+        }
+#endif
+        result.arithmetic = Arithmetic::BIGINT;
+        TrySolve<BigInt, BigOps>(a, b, result);
+        return result;
+    }
+
+    // Bareiss direto em BigInt sobre a matriz aumentada [A|b] n x (n + 1) em
+    // ordem de linhas (coeficientes que não cabem em double)
+    static Result SolveAugmented(std::vector<BigInt> augmented, int n) {
+        Result result;
+        if (n == 0 || augmented.size() != static_cast<std::size_t>(n) * (n + 1)) {
+            return result;
+        }
+        result.arithmetic = Arithmetic::BIGINT;
+        Eliminate<BigInt, BigOps>(augmented, n, result);
+        return result;
+    }
+
+    // Adaptador para o formato vector<vector<double>>
+    static Result Solve(const std::vector<std::vector<double>>& a, const std::vector<double>& b) {
+        return Solve(DenseMatrix(a), b);
+    }
+
+private:
+    // BigInt nunca estoura
+    struct BigOps {
+        static bool Multiply(const BigInt& a, const BigInt& b, BigInt& result) { result = a * b; return true; }
+        static bool Subtract(const BigInt& a, const BigInt& b, BigInt& result) { result = a - b; return true; }
+        static bool IsZero(const BigInt& value) { return value.IsZero(); }
+        static BigInt ToBig(const BigInt& value) { return value; }
+    };
+};
@@ -0,0 +1,202 @@
+#pragma once
+#include <array>
+#include <algorithm>
+#include <cmath>
+#include <utility>
+
+// Solver para tamanhos conhecidos em tempo de compilação (1 a 10 variáveis).
+// Tudo fica em std::array na pilha, sem alocações; os laços têm limites
+// constantes e são desenrolados pelo compilador. Para N = 1, 2 e 3 a solução é
+// obtida por fórmula fechada (regra de Cramer) sem desvios.
+// Solve retorna false quando a matriz é (numericamente) singular; a
+// classificação do sistema fica então a cargo do LinearSolver.
+#if defined(__GNUC__) && !defined(__clang__)
+#define FIXED_SOLVER_UNROLL _Pragma("GCC unroll 16")
+#elif defined(__clang__)
+#define FIXED_SOLVER_UNROLL _Pragma("unroll")
+#else
+#define FIXED_SOLVER_UNROLL
+#endif
+
+template <int N>
+class FixedLinearSolver {
+public:
+    static constexpr int MAX_SIZE = 10;
+    static_assert(N >= 1 && N <= MAX_SIZE, "FixedLinearSolver suporta de 1 a 10 variáveis");
+
+    using Matrix = std::array<std::array<double, N>, N>;
+    using Vector = std::array<double, N>;
+    using Pivots = std::array<int, N>;
+
+private:
+    static constexpr double EPSILON = 1e-10;
+
+public:
+    static bool Solve(Matrix a, Vector b, Vector& x) {
+        double determinant;
+        Pivots pivots;
+        return Solve(a, b, x, determinant, pivots);
+    }
+
+    // Eliminação Gaussiana com pivoteamento parcial, limites fixos. Também
+    // devolve det(A) e as trocas de linha (linha k trocada com pivots[k]);
+    // as fórmulas fechadas não trocam linhas (pivots[k] = k).
+    static bool Solve(Matrix a, Vector b, Vector& x, double& determinant, Pivots& pivots) {
+        determinant = 1.0;
+        FIXED_SOLVER_UNROLL
+        for (int k = 0; k < N; k++) {
+            int pivotRow = k;
+            double maxAbs = std::abs(a[k][k]);
+            FIXED_SOLVER_UNROLL
+            for (int i = k + 1; i < N; i++) {
+                double currentAbs = std::abs(a[i][k]);
+                bool greater = currentAbs > maxAbs;
+                maxAbs = greater ? currentAbs : maxAbs;
+                pivotRow = greater ? i : pivotRow;
+            }
+
+            if (!(maxAbs > EPSILON)) {
+                return false;
+            }
+
+            std::swap(a[k], a[pivotRow]);
+            std::swap(b[k], b[pivotRow]);
+            pivots[k] = pivotRow;
+            determinant *= pivotRow != k ? -a[k][k] : a[k][k];
+
+            const double inversePivot = 1.0 / a[k][k];
+            FIXED_SOLVER_UNROLL
+            for (int i = k + 1; i < N; i++) {
+                const double factor = a[i][k] * inversePivot;
+                FIXED_SOLVER_UNROLL
+                for (int j = k + 1; j < N; j++) {
+                    a[i][j] -= factor * a[k][j];
+                }
+                b[i] -= factor * b[k];
+            }
+        }
+
+        FIXED_SOLVER_UNROLL
+        for (int i = N - 1; i >= 0; i--) {
+            double sum = b[i];
+            FIXED_SOLVER_UNROLL
+            for (int j = i + 1; j < N; j++) {
+                sum -= a[i][j] * x[j];
+            }
+            x[i] = sum / a[i][i];
+        }
+
+        return true;
+    }
+
+    // ‖A⁻¹‖₁ exato, pelas colunas da inversa (HUGE_VAL se A for singular).
+    // Com N <= 10 custa o mesmo que as resoluções do estimador de Hager.
+    static double InverseNormOne(Matrix a) {
+        Matrix inverse{};
+        FIXED_SOLVER_UNROLL
+        for (int i = 0; i < N; i++) {
+            inverse[i][i] = 1.0;
+        }
+
+        FIXED_SOLVER_UNROLL
+        for (int k = 0; k < N; k++) {
+            int pivotRow = k;
+            FIXED_SOLVER_UNROLL
+            for (int i = k + 1; i < N; i++) {
+                pivotRow = std::abs(a[i][k]) > std::abs(a[pivotRow][k]) ? i : pivotRow;
+            }
+            if (!(std::abs(a[pivotRow][k]) > EPSILON)) {
+                return HUGE_VAL;
+            }
+            std::swap(a[k], a[pivotRow]);
+            std::swap(inverse[k], inverse[pivotRow]);
+
+            const double inversePivot = 1.0 / a[k][k];
+            FIXED_SOLVER_UNROLL
+            for (int i = k + 1; i < N; i++) {
+                const double factor = a[i][k] * inversePivot;
+                FIXED_SOLVER_UNROLL
+                for (int j = k + 1; j < N; j++) {
+                    a[i][j] -= factor * a[k][j];
+                }
+                FIXED_SOLVER_UNROLL
+                for (int j = 0; j < N; j++) {
+                    inverse[i][j] -= factor * inverse[k][j];
+                }
+            }
+        }
+
+        Vector columnSums{};
+        FIXED_SOLVER_UNROLL
+        for (int i = N - 1; i >= 0; i--) {
+            FIXED_SOLVER_UNROLL
+            for (int c = 0; c < N; c++) {
+                double sum = inverse[i][c];
+                FIXED_SOLVER_UNROLL
+                for (int j = i + 1; j < N; j++) {
+                    sum -= a[i][j] * inverse[j][c];
+                }
+                inverse[i][c] = sum / a[i][i];
+                columnSums[c] += std::abs(inverse[i][c]);
+            }
+        }
+        return *std::max_element(columnSums.begin(), columnSums.end());
+    }
+};
+
+// Fórmulas fechadas: o determinante é comparado com a escala da matriz
+// (maior coeficiente elevado a N) para decidir se o sistema é singular.
+
+template <>
+inline bool FixedLinearSolver<1>::Solve(Matrix a, Vector b, Vector& x, double& determinant, Pivots& pivots) {
+    determinant = a[0][0];
+    pivots[0] = 0;
+    x[0] = b[0] / a[0][0];
+    return std::abs(a[0][0]) > EPSILON;
+}
+
+template <>
+inline bool FixedLinearSolver<2>::Solve(Matrix a, Vector b, Vector& x, double& determinant, Pivots& pivots) {
+    const double det = a[0][0] * a[1][1] - a[0][1] * a[1][0];
+    determinant = det;
+    pivots = {0, 1};
+    const double scale = std::max(std::max(std::abs(a[0][0]), std::abs(a[0][1])),
+                                  std::max(std::abs(a[1][0]), std::abs(a[1][1])));
+    const double inverseDet = 1.0 / det;
+    x[0] = (b[0] * a[1][1] - a[0][1] * b[1]) * inverseDet;
+    x[1] = (a[0][0] * b[1] - b[0] * a[1][0]) * inverseDet;
+    return std::abs(det) > EPSILON * scale * scale && std::isfinite(x[0]) && std::isfinite(x[1]);
+}
+
+template <>
+inline bool FixedLinearSolver<3>::Solve(Matrix a, Vector b, Vector& x, double& determinant, Pivots& pivots) {
+    // Cofatores da primeira linha, reutilizados no determinante
+    const double c00 = a[1][1] * a[2][2] - a[1][2] * a[2][1];
+    const double c01 = a[1][2] * a[2][0] - a[1][0] * a[2][2];
+    const double c02 = a[1][0] * a[2][1] - a[1][1] * a[2][0];
+    const double det = a[0][0] * c00 + a[0][1] * c01 + a[0][2] * c02;
+    determinant = det;
+    pivots = {0, 1, 2};
+
+    double scale = 0.0;
+    for (int i = 0; i < 3; i++) {
+        for (int j = 0; j < 3; j++) {
+            scale = std::max(scale, std::abs(a[i][j]));
+        }
+    }
+
+    // x = adj(A)·b / det
+    const double inverseDet = 1.0 / det;
+    x[0] = (c00 * b[0]
+          + (a[0][2] * a[2][1] - a[0][1] * a[2][2]) * b[1]
+          + (a[0][1] * a[1][2] - a[0][2] * a[1][1]) * b[2]) * inverseDet;
+    x[1] = (c01 * b[0]
+          + (a[0][0] * a[2][2] - a[0][2] * a[2][0]) * b[1]
+          + (a[0][2] * a[1][0] - a[0][0] * a[1][2]) * b[2]) * inverseDet;
+    x[2] = (c02 * b[0]
+          + (a[0][1] * a[2][0] - a[0][0] * a[2][1]) * b[1]
+          + (a[0][0] * a[1][1] - a[0][1] * a[1][0]) * b[2]) * inverseDet;
+
+    return std::abs(det) > EPSILON * scale * scale * scale &&
+           std::isfinite(x[0]) && std::isfinite(x[1]) && std::isfinite(x[2]);
+}
@@ -0,0 +1,202 @@
+#pragma once
+#include <vector>
+#include <mutex>
+#include <cstdint>
+#include <cstring>
+#include <algorithm>
+#include "NumberParser.h"
+
+// Modelo das células digitadas (coeficientes e constantes), independente da
+// interface. Cada célula guarda o valor já convertido e o estado (vazia,
+// inválida ou válida); SetText converte só a célula editada e, se ela mudou,
+// marca a célula como suja e incrementa a versão.
+//
+// TakeSnapshot entrega ao consumidor (a thread de cálculo) uma cópia do
+// sistema e a lista das células alteradas desde a cópia anterior: quando o
+// Snapshot recebido é o mesmo da última chamada (mesma versão), só as células
+// sujas são copiadas. Thread-safe; a interface escreve e o cálculo lê.
+class InputModel {
+public:
+    static constexpr int CONSTANT = -1; // Coluna das constantes em SetText e Cell
+
+    enum class CellState : unsigned char {
+        EMPTY,
+        INVALID, // Texto que não é um número
+        VALID
+    };
+
+    struct Cell {
+        int row;
+        int column; // CONSTANT para a constante da linha
+    };
+
+    struct Snapshot {
+        std::uint64_t version = 0; // 0: ainda não preenchido
+        int size = 0;
+        std::vector<std::vector<double>> matrix; // Células vazias ou inválidas valem 0
+        std::vector<double> constants;
+        int incompleteCells = 0;   // Vazias ou inválidas
+        bool full = true;          // Tudo copiado (primeira cópia ou tamanho novo)
+        std::vector<Cell> changes; // Células copiadas quando full == false
+
+        bool Complete() const { return incompleteCells == 0; }
+    };
+
+private:
+    mutable std::mutex mutex;
+    int size = 0;
+    std::uint64_t version = 0;
+    std::uint64_t snapshotVersion = 0; // Versão entregue no último TakeSnapshot
+
+    // Linha i: size coeficientes e a constante (posição size)
+    std::vector<double> values;
+    std::vector<CellState> states;
+    int incompleteCells = 0;
+    std::vector<int> dirty;
+    std::vector<unsigned char> isDirty;
+
+    int Index(int row, int column) const {
+        return row * (size + 1) + (column == CONSTANT ? size : column);
+    }
+
+    bool InRange(int row, int column) const {
+        return row >= 0 && row < size && column >= CONSTANT && column < size;
+    }
+
+public:
+    InputModel() = default;
+
+    explicit InputModel(int n, double initial = 0.0) {
+        Resize(n, initial);
+    }
+
+    // Converter o texto de uma célula como _tcstod (sem hexadecimal) com a
+    // entrada inteira consumida: espaços iniciais e '+' são aceitos; "+-1",
+    // "nan" e "inf" não (as mesmas regras da leitura de arquivos)
+    template <typename Char>
+    static CellState Parse(const Char* text, double& value) {
+        value = 0.0;
+        while (*text == ' ' || *text == '\t') {
+            text++;
+        }
+        if (*text == 0) {
+            return CellState::EMPTY;
+        }
+        char buffer[64] = {};
+        std::size_t length = 0;
+        for (; text[length] != 0; length++) {
+            const auto code = static_cast<std::uint32_t>(text[length]);
+            if (length + 1 >= sizeof(buffer) || code > 127) {
+                return CellState::INVALID;
+            }
+            buffer[length] = static_cast<char>(code);
+        }
+        double parsed;
+        if (!NumberParser::ParseDouble(buffer, buffer + length, false, parsed)) {
+            return CellState::INVALID;
+        }
+        value = parsed;
+        return CellState::VALID;
+    }
+
+    // Novo tamanho: todas as células válidas com initial (as caixas recém
+    // criadas mostram "0") e a próxima cópia é completa
+    void Resize(int n, double initial = 0.0) {
+        std::lock_guard<std::mutex> lock(mutex);
+        size = std::max(0, n);
+        const std::size_t count = static_cast<std::size_t>(size) * (size + 1);
+        values.assign(count, initial);
+        states.assign(count, CellState::VALID);
+        incompleteCells = 0;
+        dirty.clear();
+        isDirty.assign(count, 0);
+        version++;
+        snapshotVersion = 0;
+    }
+
+    // Atualizar uma célula; true se o valor ou o estado mudou
+    template <typename Char>
+    bool SetText(int row, int column, const Char* text) {
+        double value;
+        const CellState state = Parse(text, value);
+
+        std::lock_guard<std::mutex> lock(mutex);
+        if (!InRange(row, column)) {
+            return false;
+        }
+        const int index = Index(row, column);
+        if (states[index] == state && std::memcmp(&values[index], &value, sizeof(double)) == 0) {
+            return false;
+        }
+        incompleteCells += (state != CellState::VALID) - (states[index] != CellState::VALID);
+        states[index] = state;
+        values[index] = value;
+        if (!isDirty[index]) {
+            isDirty[index] = 1;
+            dirty.push_back(index);
+        }
+        version++;
+        return true;
+    }
+
+    int Size() const {
+        std::lock_guard<std::mutex> lock(mutex);
+        return size;
+    }
+
+    std::uint64_t Version() const {
+        std::lock_guard<std::mutex> lock(mutex);
+        return version;
+    }
+
+    double Value(int row, int column) const {
+        std::lock_guard<std::mutex> lock(mutex);
+        return InRange(row, column) ? values[Index(row, column)] : 0.0;
+    }
+
+    CellState State(int row, int column) const {
+        std::lock_guard<std::mutex> lock(mutex);
+        return InRange(row, column) ? states[Index(row, column)] : CellState::EMPTY;
+    }
+
+    // Atualizar snapshot para a versão atual. Se ele é a cópia entregue na
+    // última chamada, só as células sujas são copiadas (e listadas em
+    // changes); senão a cópia é completa e full fica verdadeiro
+    void TakeSnapshot(Snapshot& snapshot) {
+        std::lock_guard<std::mutex> lock(mutex);
+        snapshot.changes.clear();
+        snapshot.full = snapshotVersion == 0 || snapshot.version != snapshotVersion || snapshot.size != size;
+
+        if (snapshot.full) {
+            snapshot.size = size;
+            snapshot.matrix.assign(size, std::vector<double>(size));
+            snapshot.constants.assign(size, 0.0);
+            for (int i = 0; i < size; i++) {
+                const double* row = values.data() + Index(i, 0);
+                std::copy(row, row + size, snapshot.matrix[i].begin());
+                snapshot.constants[i] = row[size];
+            }
+        } else {
+            snapshot.changes.reserve(dirty.size());
+            for (int index : dirty) {
+                const int row = index / (size + 1);
+                const int column = index % (size + 1);
+                if (column == size) {
+                    snapshot.constants[row] = values[index];
+                    snapshot.changes.push_back({row, CONSTANT});
+                } else {
+                    snapshot.matrix[row][column] = values[index];
+                    snapshot.changes.push_back({row, column});
+                }
+            }
+        }
+
+        for (int index : dirty) {
+            isDirty[index] = 0;
+        }
+        dirty.clear();
+        snapshot.incompleteCells = incompleteCells;
+        snapshot.version = version;
+        snapshotVersion = version;
+    }
+};
@@ -0,0 +1,312 @@
+#pragma once
+#include <vector>
+#include <cmath>
+#include <algorithm>
+#include "SparseMatrix.h"
+#include "SimdKernels.h"
+#include "Preconditioner.h"
+
+// Métodos iterativos de Krylov sobre uma matriz esparsa. Cada método usa só
+// produtos matriz-vetor e memória O(nnz + n); o histórico recebe a norma
+// relativa do resíduo ||b - A·x|| / ||b|| no início e após cada iteração.
+// x entra como aproximação inicial (zeros se o tamanho não for n).
+class KrylovSolvers {
+public:
+    enum class Outcome {
+        CONVERGED,       // Resíduo relativo <= tolerância
+        MAX_ITERATIONS,  // Limite de iterações atingido
+        BREAKDOWN,       // Divisão por zero no método (ex.: matriz não SPD no CG)
+        STAGNATION       // O resíduo parou de diminuir
+    };
+
+    static constexpr int DEFAULT_RESTART = 30;
+
+private:
+    // Estagnação: o melhor resíduo não caiu abaixo de STAGNATION_FACTOR vezes o
+    // valor anterior em uma janela (um ciclo de reinício no GMRES)
+    static constexpr double STAGNATION_FACTOR = 0.999;
+    static constexpr int STAGNATION_WINDOW = 100;
+
+    static double Dot(int n, const double* x, const double* y) {
+        double sum = 0.0;
+        for (int i = 0; i < n; i++) {
+            sum += x[i] * y[i];
+        }
+        return sum;
+    }
+
+    // r = b - A·x
+    static void Residual(const SparseMatrix& a, const std::vector<double>& b,
+                         const std::vector<double>& x, std::vector<double>& r) {
+        a.Multiply(x.data(), r.data());
+        for (std::size_t i = 0; i < r.size(); i++) {
+            r[i] = b[i] - r[i];
+        }
+    }
+
+public:
+    // Gradiente conjugado precondicionado (A e M simétricas positivas definidas).
+    // Ao convergir pelo resíduo recursivo, o resíduo verdadeiro é recalculado;
+    // se ainda estiver acima da tolerância, as iterações continuam a partir dele.
+    static Outcome ConjugateGradient(const SparseMatrix& a, const std::vector<double>& b,
+                                     std::vector<double>& x, const Preconditioner& preconditioner,
+                                     double tolerance, int maxIterations,
+                                     std::vector<double>& history) {
+        const int n = a.Rows();
+        history.clear();
+        if (static_cast<int>(x.size()) != n) {
+            x.assign(n, 0.0);
+        }
+
+        const double bNorm = std::sqrt(Dot(n, b.data(), b.data()));
+        if (bNorm == 0.0) {
+            x.assign(n, 0.0);
+            history.push_back(0.0);
+            return Outcome::CONVERGED;
+        }
+
+        std::vector<double> r(n), z(n), p(n), q(n);
+        Residual(a, b, x, r);
+        double relative = std::sqrt(Dot(n, r.data(), r.data())) / bNorm;
+        history.push_back(relative);
+        if (relative <= tolerance) {
+            return Outcome::CONVERGED;
+        }
+
+        preconditioner.Apply(r.data(), z.data());
+        p = z;
+        double rz = Dot(n, r.data(), z.data());
+
+        for (int iteration = 0; iteration < maxIterations; iteration++) {
+            a.Multiply(p.data(), q.data());
+            const double pq = Dot(n, p.data(), q.data());
+            if (!(pq > 0.0) || !(rz > 0.0)) {
+                return Outcome::BREAKDOWN;
+            }
+
+            const double alpha = rz / pq;
+            SimdAxpy(n, alpha, p.data(), x.data());
+            SimdAxpy(n, -alpha, q.data(), r.data());
+
+            relative = std::sqrt(Dot(n, r.data(), r.data())) / bNorm;
+            if (relative <= tolerance) {
+                Residual(a, b, x, r);
+                relative = std::sqrt(Dot(n, r.data(), r.data())) / bNorm;
+                if (relative <= tolerance) {
+                    history.push_back(relative);
+                    return Outcome::CONVERGED;
+                }
+            }
+            history.push_back(relative);
+
+            preconditioner.Apply(r.data(), z.data());
+            const double rzNext = Dot(n, r.data(), z.data());
+            const double beta = rzNext / rz;
+            rz = rzNext;
+            for (int i = 0; i < n; i++) {
+                p[i] = z[i] + beta * p[i];
+            }
+        }
+
+        return Outcome::MAX_ITERATIONS;
+    }
+
+    // GMRES(m) com precondicionamento à direita (minimiza o resíduo verdadeiro):
+    // base de Arnoldi por Gram-Schmidt modificado e rotações de Givens. A cada
+    // reinício o resíduo é recalculado; um ciclo inteiro sem redução é estagnação.
+    static Outcome Gmres(const SparseMatrix& a, const std::vector<double>& b,
+                         std::vector<double>& x, const Preconditioner& preconditioner,
+                         int restart, double tolerance, int maxIterations,
+                         std::vector<double>& history) {
+        const int n = a.Rows();
+        const int m = std::max(1, std::min(restart, n));
+        history.clear();
+        if (static_cast<int>(x.size()) != n) {
+            x.assign(n, 0.0);
+        }
+
+        const double bNorm = std::sqrt(Dot(n, b.data(), b.data()));
+        if (bNorm == 0.0) {
+            x.assign(n, 0.0);
+            history.push_back(0.0);
+            return Outcome::CONVERGED;
+        }
+
+        std::vector<double> basis(static_cast<std::size_t>(m + 1) * n);
+        std::vector<double> hessenberg(static_cast<std::size_t>(m + 1) * m); // [i * m + j]
+        std::vector<double> cosines(m), sines(m), g(m + 1), y(m);
+        std::vector<double> r(n), z(n), w(n);
+        auto h = [&](int i, int j) -> double& { return hessenberg[static_cast<std::size_t>(i) * m + j]; };
+
+        int iteration = 0;
+        double cycleStart = 0.0;
+        for (bool first = true; ; first = false) {
+            Residual(a, b, x, r);
+            const double beta = std::sqrt(Dot(n, r.data(), r.data()));
+            const double relative = beta / bNorm;
+            if (first) {
+                history.push_back(relative);
+            } else {
+                history.back() = relative; // Estimado -> verdadeiro
+            }
+            if (relative <= tolerance) {
+                return Outcome::CONVERGED;
+            }
+            if (!first && relative > STAGNATION_FACTOR * cycleStart) {
+                return Outcome::STAGNATION;
+            }
+            if (iteration >= maxIterations) {
+                return Outcome::MAX_ITERATIONS;
+            }
+            cycleStart = relative;
+
+            std::fill(g.begin(), g.end(), 0.0);
+            g[0] = beta;
+            for (int i = 0; i < n; i++) {
+                basis[i] = r[i] / beta;
+            }
+
+            int size = 0;
+            while (size < m && iteration < maxIterations) {
+                const int j = size;
+                preconditioner.Apply(basis.data() + static_cast<std::size_t>(j) * n, z.data());
+                a.Multiply(z.data(), w.data());
+                for (int i = 0; i <= j; i++) {
+                    const double* v = basis.data() + static_cast<std::size_t>(i) * n;
+                    h(i, j) = Dot(n, w.data(), v);
+                    SimdAxpy(n, -h(i, j), v, w.data());
+                }
+                const double next = std::sqrt(Dot(n, w.data(), w.data()));
+                if (next > 0.0) {
+                    double* v = basis.data() + static_cast<std::size_t>(j + 1) * n;
+                    for (int i = 0; i < n; i++) {
+                        v[i] = w[i] / next;
+                    }
+                }
+
+                // Rotações anteriores e nova rotação para zerar h(j + 1, j)
+                for (int i = 0; i < j; i++) {
+                    const double upper = cosines[i] * h(i, j) + sines[i] * h(i + 1, j);
+                    h(i + 1, j) = -sines[i] * h(i, j) + cosines[i] * h(i + 1, j);
+                    h(i, j) = upper;
+                }
+                const double radius = std::hypot(h(j, j), next);
+                if (!(radius > 0.0)) {
+                    return Outcome::BREAKDOWN;
+                }
+                cosines[j] = h(j, j) / radius;
+                sines[j] = next / radius;
+                h(j, j) = radius;
+                g[j + 1] = -sines[j] * g[j];
+                g[j] = cosines[j] * g[j];
+
+                size++;
+                iteration++;
+                history.push_back(std::abs(g[j + 1]) / bNorm);
+                if (std::abs(g[j + 1]) / bNorm <= tolerance || next == 0.0) {
+                    break; // Convergência (ou subespaço invariante)
+                }
+            }
+
+            // x += M⁻¹·V·y com H·y = g (triangular superior)
+            for (int i = size - 1; i >= 0; i--) {
+                double sum = g[i];
+                for (int k = i + 1; k < size; k++) {
+                    sum -= h(i, k) * y[k];
+                }
+                y[i] = sum / h(i, i);
+            }
+            std::fill(w.begin(), w.end(), 0.0);
+            for (int i = 0; i < size; i++) {
+                SimdAxpy(n, y[i], basis.data() + static_cast<std::size_t>(i) * n, w.data());
+            }
+            preconditioner.Apply(w.data(), z.data());
+            SimdAxpy(n, 1.0, z.data(), x.data());
+        }
+    }
+
+    // BiCGSTAB com precondicionamento à direita (van der Vorst)
+    static Outcome BiCgStab(const SparseMatrix& a, const std::vector<double>& b,
+                            std::vector<double>& x, const Preconditioner& preconditioner,
+                            double tolerance, int maxIterations,
+                            std::vector<double>& history) {
+        const int n = a.Rows();
+        history.clear();
+        if (static_cast<int>(x.size()) != n) {
+            x.assign(n, 0.0);
+        }
+
+        const double bNorm = std::sqrt(Dot(n, b.data(), b.data()));
+        if (bNorm == 0.0) {
+            x.assign(n, 0.0);
+            history.push_back(0.0);
+            return Outcome::CONVERGED;
+        }
+
+        std::vector<double> r(n), shadow(n), p(n, 0.0), v(n, 0.0), s(n), t(n), pHat(n), sHat(n);
+        Residual(a, b, x, r);
+        shadow = r;
+        double relative = std::sqrt(Dot(n, r.data(), r.data())) / bNorm;
+        history.push_back(relative);
+        if (relative <= tolerance) {
+            return Outcome::CONVERGED;
+        }
+
+        double rho = 1.0, alpha = 1.0, omega = 1.0;
+        double windowBest = relative;
+        double best = relative;
+        for (int iteration = 0; iteration < maxIterations; iteration++) {
+            const double rhoNext = Dot(n, shadow.data(), r.data());
+            if (rhoNext == 0.0 || omega == 0.0) {
+                return Outcome::BREAKDOWN;
+            }
+            const double beta = (rhoNext / rho) * (alpha / omega);
+            rho = rhoNext;
+            for (int i = 0; i < n; i++) {
+                p[i] = r[i] + beta * (p[i] - omega * v[i]);
+            }
+
+            preconditioner.Apply(p.data(), pHat.data());
+            a.Multiply(pHat.data(), v.data());
+            const double shadowV = Dot(n, shadow.data(), v.data());
+            if (shadowV == 0.0) {
+                return Outcome::BREAKDOWN;
+            }
+            alpha = rho / shadowV;
+            for (int i = 0; i < n; i++) {
+                s[i] = r[i] - alpha * v[i];
+            }
+
+            preconditioner.Apply(s.data(), sHat.data());
+            a.Multiply(sHat.data(), t.data());
+            const double tt = Dot(n, t.data(), t.data());
+            omega = tt > 0.0 ? Dot(n, t.data(), s.data()) / tt : 0.0;
+            SimdAxpy(n, alpha, pHat.data(), x.data());
+            SimdAxpy(n, omega, sHat.data(), x.data());
+            for (int i = 0; i < n; i++) {
+                r[i] = s[i] - omega * t[i];
+            }
+
+            relative = std::sqrt(Dot(n, r.data(), r.data())) / bNorm;
+            if (relative <= tolerance) {
+                Residual(a, b, x, r);
+                relative = std::sqrt(Dot(n, r.data(), r.data())) / bNorm;
+                if (relative <= tolerance) {
+                    history.push_back(relative);
+                    return Outcome::CONVERGED;
+                }
+            }
+            history.push_back(relative);
+
+            best = std::min(best, relative);
+            if ((iteration + 1) % STAGNATION_WINDOW == 0) {
+                if (best > STAGNATION_FACTOR * windowBest) {
+                    return Outcome::STAGNATION;
+                }
+                windowBest = best;
+            }
+        }
+
+        return Outcome::MAX_ITERATIONS;
+    }
+};
@@ -0,0 +1,294 @@
+#pragma once
+#include <vector>
+#include <cmath>
+#include <algorithm>
+#include "DenseMatrix.h"
+#include "BlockedLU.h"
+
+// Resultado de uma fatoração P·A = L·U guardado para reutilização.
+// L (unitária, abaixo da diagonal) e U (diagonal e acima) ficam empacotados em
+// uma única matriz; "pivots" registra as trocas de linha na ordem em que ocorreram.
+// Depois de fatorar uma vez, cada novo vetor de constantes custa apenas as
+// substituições progressiva e regressiva, O(n²).
+//
+// Editar um coeficiente ou uma linha não exige fatorar de novo: a mudança é uma
+// correção de posto 1, A' = A + u·vᵀ, aplicada pela fórmula de Sherman-Morrison
+// sobre os fatores existentes em O(n²). As correções se acumulam (Woodbury) até
+// MaxUpdates(); depois disso, ou quando o denominador 1 + vᵀ·A⁻¹·u fica pequeno
+// demais para a correção ser estável, a matriz é fatorada de novo.
+class LUFactorization {
+public:
+    // |σ| abaixo disto (relativo a ‖v‖·‖A⁻¹u‖) faz a correção refatorar
+    static constexpr double UPDATE_TOLERANCE = 1e-8;
+
+private:
+    DenseMatrix coefficients; // Matriz atual, já com as correções (verificação e diagnósticos)
+    DenseMatrix factors;
+    std::vector<int> pivots;
+    bool singular;
+    int blockSize;
+    double tolerance;
+
+    // Correção k: A_k = A_{k-1} + u_k·v_kᵀ, com w_k = A_{k-1}⁻¹·u_k,
+    // z_k = A_{k-1}⁻ᵀ·v_k e σ_k = 1 + v_kᵀ·w_k (uma linha por correção)
+    DenseMatrix updateU;
+    DenseMatrix updateV;
+    DenseMatrix updateW;
+    DenseMatrix updateZ;
+    std::vector<double> updateSigma;
+    int updateCount;
+    int refactorCount;
+    double determinantScale; // Π σ_k: det(A + u·vᵀ) = det(A)·σ
+
+    static double Dot(int n, const double* x, const double* y) {
+        double sum = 0.0;
+        for (int i = 0; i < n; i++) {
+            sum += x[i] * y[i];
+        }
+        return sum;
+    }
+
+    void Refactor(ThreadPool* pool) {
+        factors = coefficients;
+        singular = BlockedLU<double>::Factor(factors, pivots, blockSize, tolerance, pool) != -1;
+        updateCount = 0;
+        determinantScale = 1.0;
+        refactorCount++;
+    }
+
+    // Preparar a linha da próxima correção; false se não houver mais espaço
+    bool ReserveUpdate() {
+        if (singular || updateCount >= MaxUpdates()) {
+            return false;
+        }
+        if (updateCount == 0) {
+            const int n = Size();
+            updateU.Resize(MaxUpdates(), n);
+            updateV.Resize(MaxUpdates(), n);
+            updateW.Resize(MaxUpdates(), n);
+            updateZ.Resize(MaxUpdates(), n);
+            updateSigma.resize(MaxUpdates());
+        }
+        return true;
+    }
+
+    // Registrar a correção cujos u e v já estão na linha updateCount
+    // (coefficients já atualizada)
+    bool CommitUpdate(ThreadPool* pool) {
+        const int n = Size();
+        const double* u = updateU.Row(updateCount);
+        const double* v = updateV.Row(updateCount);
+        double* w = updateW.Row(updateCount);
+        double* z = updateZ.Row(updateCount);
+
+        std::copy(u, u + n, w);
+        SolveInPlace(w);
+        std::copy(v, v + n, z);
+        SolveTransposeInPlace(z);
+
+        const double sigma = 1.0 + Dot(n, v, w);
+        double normV = 0.0;
+        double normW = 0.0;
+        for (int i = 0; i < n; i++) {
+            normV = std::max(normV, std::abs(v[i]));
+            normW += std::abs(w[i]);
+        }
+        if (!(std::abs(sigma) > UPDATE_TOLERANCE * std::max(1.0, normV * normW))) {
+            // Matriz (quase) singular depois da edição: a LU completa decide
+            Refactor(pool);
+            return false;
+        }
+
+        updateSigma[updateCount] = sigma;
+        determinantScale *= sigma;
+        updateCount++;
+        return true;
+    }
+
+public:
+    LUFactorization()
+        : singular(true), blockSize(BlockedLU<double>::DEFAULT_BLOCK_SIZE), tolerance(0.0),
+          updateCount(0), refactorCount(0), determinantScale(1.0) {}
+
+    LUFactorization(const DenseMatrix& matrix, int blockSize, double tolerance,
+                    ThreadPool* pool = nullptr)
+        : coefficients(matrix), factors(matrix), singular(true), blockSize(blockSize),
+          tolerance(tolerance), updateCount(0), refactorCount(0), determinantScale(1.0) {
+        if (matrix.Empty() || matrix.Rows() != matrix.Cols()) {
+            return;
+        }
+        singular = BlockedLU<double>::Factor(factors, pivots, blockSize, tolerance, pool) != -1;
+    }
+
+    int Size() const { return coefficients.Rows(); }
+    bool IsSingular() const { return singular; }
+
+    // Construída a partir de uma matriz quadrada não vazia (singular ou não)
+    bool IsValid() const { return !coefficients.Empty() && coefficients.Rows() == coefficients.Cols(); }
+
+    const DenseMatrix& Coefficients() const { return coefficients; }
+
+    // Fatores e trocas da última fatoração completa (sem as correções de posto 1)
+    const DenseMatrix& Factors() const { return factors; }
+    const std::vector<int>& Pivots() const { return pivots; }
+
+    // Correções acumuladas desde a última fatoração e quantas vezes a matriz
+    // foi fatorada de novo por uma edição
+    int UpdateCount() const { return updateCount; }
+    int RefactorCount() const { return refactorCount; }
+
+    // Uma solução com k correções custa O(n² + k·n); acima deste limite
+    // refatorar sai mais barato que continuar acumulando
+    int MaxUpdates() const { return std::max(4, Size() / 8); }
+
+    // Resolver A·x = b in-place (b deve ter Size() elementos)
+    void SolveInPlace(double* b) const {
+        const int n = Size();
+        BlockedLU<double>::SolveInPlace(factors, pivots, b);
+        for (int k = 0; k < updateCount; k++) {
+            SimdAxpy(n, -Dot(n, updateV.Row(k), b) / updateSigma[k], updateW.Row(k), b);
+        }
+    }
+
+    // Resolver Aᵀ·x = b in-place (estimador de condicionamento)
+    void SolveTransposeInPlace(double* b) const {
+        const int n = Size();
+        BlockedLU<double>::SolveTransposeInPlace(factors, pivots, b);
+        for (int k = 0; k < updateCount; k++) {
+            SimdAxpy(n, -Dot(n, updateU.Row(k), b) / updateSigma[k], updateZ.Row(k), b);
+        }
+    }
+
+    // Resolver A·X = B in-place para várias colunas (B com Size() linhas)
+    void SolveInPlace(DenseMatrix& b, ThreadPool* pool = nullptr) const {
+        BlockedLU<double>::SolveInPlace(factors, pivots, b, pool);
+        const int n = Size();
+        const int columns = b.Cols();
+        std::vector<double> projection;
+        for (int k = 0; k < updateCount; k++) {
+            // B -= w_k·(v_kᵀ·B)/σ_k
+            projection.assign(columns, 0.0);
+            const double* v = updateV.Row(k);
+            const double* w = updateW.Row(k);
+            for (int i = 0; i < n; i++) {
+                if (v[i] != 0.0) {
+                    SimdAxpy(columns, v[i] / updateSigma[k], b.Row(i), projection.data());
+                }
+            }
+            for (int i = 0; i < n; i++) {
+                if (w[i] != 0.0) {
+                    SimdAxpy(columns, -w[i], projection.data(), b.Row(i));
+                }
+            }
+        }
+    }
+
+    // Resolver A·x = b, O(n²). Retorna vetor vazio se a matriz for singular.
+    std::vector<double> Solve(const std::vector<double>& b) const {
+        if (singular || static_cast<int>(b.size()) != Size()) {
+            return std::vector<double>();
+        }
+        std::vector<double> x = b;
+        SolveInPlace(x.data());
+        return x;
+    }
+
+    // Trocar o coeficiente (row, col) por value. Retorna true se a mudança
+    // entrou como correção de posto 1 e false se a matriz foi fatorada de novo
+    // (ou, sem mudar nada, se a fatoração ou os índices forem inválidos).
+    bool UpdateEntry(int row, int col, double value, ThreadPool* pool = nullptr) {
+        if (!IsValid() || row < 0 || row >= Size() || col < 0 || col >= Size()) {
+            return false;
+        }
+        const double delta = value - coefficients(row, col);
+        if (delta == 0.0) {
+            return true;
+        }
+        coefficients(row, col) = value;
+        if (!ReserveUpdate()) {
+            Refactor(pool);
+            return false;
+        }
+        double* u = updateU.Row(updateCount);
+        double* v = updateV.Row(updateCount);
+        std::fill(u, u + Size(), 0.0);
+        std::fill(v, v + Size(), 0.0);
+        u[row] = delta;
+        v[col] = 1.0;
+        return CommitUpdate(pool);
+    }
+
+    // Trocar a linha row inteira por values (Size() elementos): u = e_row,
+    // v = nova linha - linha antiga
+    bool UpdateRow(int row, const double* values, ThreadPool* pool = nullptr) {
+        if (!IsValid() || row < 0 || row >= Size() || values == nullptr) {
+            return false;
+        }
+        const int n = Size();
+        double* current = coefficients.Row(row);
+        if (std::equal(values, values + n, current)) {
+            return true;
+        }
+        if (!ReserveUpdate()) {
+            std::copy(values, values + n, current);
+            Refactor(pool);
+            return false;
+        }
+        double* u = updateU.Row(updateCount);
+        double* v = updateV.Row(updateCount);
+        std::fill(u, u + n, 0.0);
+        u[row] = 1.0;
+        for (int j = 0; j < n; j++) {
+            v[j] = values[j] - current[j];
+        }
+        std::copy(values, values + n, current);
+        return CommitUpdate(pool);
+    }
+
+    bool UpdateRow(int row, const std::vector<double>& values, ThreadPool* pool = nullptr) {
+        return static_cast<int>(values.size()) == Size() && UpdateRow(row, values.data(), pool);
+    }
+
+    // Correção geral A += u·vᵀ (O(n²) também para atualizar a cópia de A)
+    bool Update(const double* u, const double* v, ThreadPool* pool = nullptr) {
+        if (!IsValid() || u == nullptr || v == nullptr) {
+            return false;
+        }
+        const int n = Size();
+        for (int i = 0; i < n; i++) {
+            if (u[i] != 0.0) {
+                SimdAxpy(n, u[i], v, coefficients.Row(i));
+            }
+        }
+        if (!ReserveUpdate()) {
+            Refactor(pool);
+            return false;
+        }
+        std::copy(u, u + n, updateU.Row(updateCount));
+        std::copy(v, v + n, updateV.Row(updateCount));
+        return CommitUpdate(pool);
+    }
+
+    bool Update(const std::vector<double>& u, const std::vector<double>& v, ThreadPool* pool = nullptr) {
+        return static_cast<int>(u.size()) == Size() && static_cast<int>(v.size()) == Size() &&
+               Update(u.data(), v.data(), pool);
+    }
+
+    // Determinante a partir da diagonal de U, da paridade das trocas e dos
+    // fatores σ das correções
+    double Determinant() const {
+        if (singular) {
+            return 0.0;
+        }
+        double det = determinantScale;
+        for (int k = 0; k < Size(); k++) {
+            det *= factors(k, k);
+            if (pivots[k] != k) {
+                det = -det;
+            }
+        }
+        return det;
+    }
+
+    double DeterminantScale() const { return determinantScale; }
+};
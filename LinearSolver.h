@@ -2,6 +2,32 @@
 #include <vector>
 #include <cmath>
 #include <algorithm>
+#include "DenseMatrix.h"
+#include "SimdKernels.h"
+#include "BlockedLU.h"
+#include "SymmetricFactorization.h"
+#include "LUFactorization.h"
+#include "ThreadPool.h"
+#include "FixedLinearSolver.h"
+#include "SparseMatrix.h"
+#include "SparseOrdering.h"
+#include "SparseLU.h"
+#include "SparseCholesky.h"
+#include "Preconditioner.h"
+#include "KrylovSolvers.h"
+#include "BandMatrix.h"
+#include "BandLU.h"
+#include "SolverWorkspace.h"
+#include "ConditionEstimator.h"
+#include "ExactSolver.h"
+#include "MultiModularSolver.h"
+#include "OutOfCoreLU.h"
+#include "MatrixFile.h"
+#include <memory>
+#include <string>
+#include <cstdio>
+#include <limits>
+#include <numeric>
 
 class LinearSolver {
 public:
@@ -17,52 +43,215 @@ public:
         SolutionStatus status;
         std::vector<double> values;
         
-        Solution() : hasSolution(false), status(SolutionStatus::CALCULATION_ERROR) {}
+        // Métodos iterativos: iterações feitas e resíduo relativo após cada uma
+        // (na precisão mista, iterations conta os passos de refinamento)
+        int iterations;
+        std::vector<double> residualHistory;
+        
+        // Motivo da falha quando status == CALCULATION_ERROR (vazio se não houver)
+        std::string diagnostics;
+        
+        // Subprodutos da fatoração densa que produziu a solução (sem trabalho
+        // extra). rank < 0 indica que o caminho não os calcula (esparso e iterativos).
+        int rank;                 // Posto numérico (pivôs acima de EPSILON)
+        std::vector<int> pivots;  // Passo k trocou a linha k com pivots[k] (simétrica em Cholesky/LDLᵀ)
+        double determinant;       // Pode estourar para ±inf ou ir a 0 em n grande
+        int determinantSign;      // -1, 0 ou +1
+        double logAbsDeterminant; // ln|det(A)|, -inf se singular
+        
+        // Estimativa de κ₁(A) = ‖A‖₁·‖A⁻¹‖₁ a partir dos mesmos fatores (NaN se
+        // não calculada) e se ela passa de ILL_CONDITIONED_THRESHOLD
+        double conditionEstimate;
+        bool illConditioned;
+        
+        // Resultado decidido pela eliminação exata (values são as frações
+        // exatas arredondadas para double; as frações ficam em exactValues)
+        bool exact;
+        std::vector<ExactSolver::Rational> exactValues;
+        ExactSolver::Rational exactDeterminant;
+        
+        Solution() : hasSolution(false), status(SolutionStatus::CALCULATION_ERROR), iterations(0),
+                     rank(-1), determinant(std::numeric_limits<double>::quiet_NaN()), determinantSign(0),
+                     logAbsDeterminant(std::numeric_limits<double>::quiet_NaN()),
+                     conditionEstimate(std::numeric_limits<double>::quiet_NaN()), illConditioned(false),
+                     exact(false) {}
+    };
+    
+    // Resultado de A·X = B com várias colunas de constantes
+    struct MultiSolution {
+        bool hasSolution;
+        SolutionStatus status;
+        DenseMatrix values; // n x k, uma coluna por vetor de constantes
+        
+        MultiSolution() : hasSolution(false), status(SolutionStatus::CALCULATION_ERROR) {}
+    };
+    
+    // Algoritmo usado pela fase de eliminação
+    enum class Algorithm {
+        AUTOMATIC,       // Escolhe pelo tamanho e pela simetria do sistema
+        CLASSIC,         // Eliminação Gaussiana linha a linha
+        BLOCKED,         // LU em blocos (cache-blocked)
+        MIXED_PRECISION  // LU em blocos em float + refinamento iterativo em double
     };
     
+    static constexpr int DEFAULT_BLOCKED_THRESHOLD = 256;
+    
+    // Parâmetros dos métodos iterativos
+    struct IterativeOptions {
+        double tolerance = 1e-10;  // Resíduo relativo ||b - A·x|| / ||b||
+        int maxIterations = 0;     // 0 = 2·n
+        Preconditioner::Type preconditioner = Preconditioner::Type::JACOBI;
+        int blockSize = Preconditioner::DEFAULT_BLOCK_SIZE; // Block-Jacobi
+        double dropTolerance = Preconditioner::DEFAULT_DROP_TOLERANCE; // ILUT
+        int fillPerRow = Preconditioner::DEFAULT_FILL_PER_ROW;         // ILUT
+        int restart = KrylovSolvers::DEFAULT_RESTART;                  // GMRES(m)
+    };
+    
+    // Sistemas esparsos singulares até este tamanho são classificados pela
+    // eliminação densa; acima dele retornam CALCULATION_ERROR
+    static constexpr int SPARSE_DENSE_FALLBACK = 2000;
+    
+    // No modo automático, matrizes densas com banda (lower + upper + 1) de até
+    // n / BAND_DETECTION_RATIO diagonais são resolvidas pela LU em banda
+    static constexpr int BAND_DETECTION_RATIO = 4;
+    
+    // Limite de passos do refinamento iterativo da precisão mista (como no dsgesv)
+    static constexpr int MAX_REFINEMENT_STEPS = 30;
+    
+    // Acima deste κ₁ a solução pode perder mais de 10 dos ~16 dígitos do double
+    static constexpr double ILL_CONDITIONED_THRESHOLD = 1e10;
+    
+    // Na LU em banda e no Thomas, κ₁ acima de 1/ε indica que os pivôs "não
+    // nulos" são só arredondamento: a matriz é tratada como singular
+    static constexpr double SINGULAR_CONDITION = 1.0 / std::numeric_limits<double>::epsilon();
+    
+    // Sistemas inteiros até este tamanho têm a palavra final da eliminação
+    // exata quando o ponto flutuante fica em dúvida
+    static constexpr int EXACT_MAX_SIZE = 64;
+    
+    // Acima deste tamanho a eliminação exata é modular (vários primos e resto
+    // chinês) em vez do Bareiss, cujos inteiros crescem com n
+    static constexpr int EXACT_MODULAR_THRESHOLD = 24;
+    
 private:
     static constexpr double EPSILON = 1e-10;
     
+    Algorithm algorithm = Algorithm::AUTOMATIC;
+    int blockSize = BlockedLU<double>::DEFAULT_BLOCK_SIZE;
+    int blockedThreshold = DEFAULT_BLOCKED_THRESHOLD;
+    
+    // Configuração do caminho esparso
+    SparseOrdering::Method sparseOrdering = SparseOrdering::Method::MINIMUM_DEGREE;
+    double pivotThreshold = SparseLU::DEFAULT_PIVOT_THRESHOLD;
+    
+    IterativeOptions iterativeOptions;
+    
+    // Estimar o condicionamento em cada resolução densa (O(n²) a mais)
+    bool estimateCondition = true;
+    
+    // Reclassificar sistemas inteiros duvidosos com aritmética exata
+    bool exactArithmetic = true;
+    
+    // Pool de threads compartilhado (nulo = execução sequencial)
+    std::shared_ptr<ThreadPool> threadPool;
+    
+    // Trabalho mínimo (elementos atualizados) para dividir uma etapa entre threads
+    static constexpr int PARALLEL_MIN_WORK = 32768;
+    
     // Função auxiliar para verificar se um número é praticamente zero
     bool IsZero(double value) const {
         return std::abs(value) < EPSILON;
     }
     
     // Função para encontrar o pivô na coluna
-    int FindPivot(const std::vector<std::vector<double>>& matrix, int col, int startRow) const {
-        int pivotRow = startRow;
-        double maxAbs = std::abs(matrix[startRow][col]);
+    int FindPivot(const DenseMatrix& matrix, int col, int startRow) const {
+        const double* entry = &matrix(startRow, col);
+        int pivotRow = startRow + SimdIndexOfMaxAbs(matrix.Rows() - startRow, entry, matrix.Stride());
         
-        for (int i = startRow + 1; i < static_cast<int>(matrix.size()); i++) {
-            double currentAbs = std::abs(matrix[i][col]);
-            if (currentAbs > maxAbs) {
-                maxAbs = currentAbs;
-                pivotRow = i;
-            }
+        return (std::abs(matrix(pivotRow, col)) > EPSILON) ? pivotRow : -1;
+    }
+    
+    // Limpar um resultado reaproveitado, mantendo a capacidade de values
+    static void Reset(Solution& solution) {
+        solution.hasSolution = false;
+        solution.status = SolutionStatus::CALCULATION_ERROR;
+        solution.values.clear();
+        solution.iterations = 0;
+        solution.residualHistory.clear();
+        solution.diagnostics.clear();
+        solution.rank = -1;
+        solution.pivots.clear();
+        solution.determinant = std::numeric_limits<double>::quiet_NaN();
+        solution.determinantSign = 0;
+        solution.logAbsDeterminant = std::numeric_limits<double>::quiet_NaN();
+        solution.conditionEstimate = std::numeric_limits<double>::quiet_NaN();
+        solution.illConditioned = false;
+        solution.exact = false;
+        solution.exactValues.clear();
+        solution.exactDeterminant = ExactSolver::Rational();
+    }
+    
+    // Produto dos pivôs guardado como mantissa·2^expoente (frexp), para o
+    // determinante de matrizes grandes não estourar nem zerar no meio do produto
+    class DeterminantProduct {
+    private:
+        double mantissa = 1.0;
+        long long exponent = 0;
+        
+    public:
+        void Multiply(double value) {
+            int shift = 0;
+            mantissa = std::frexp(mantissa * value, &shift);
+            exponent += shift;
         }
         
-        return (maxAbs > EPSILON) ? pivotRow : -1;
-    }
+        void Negate() { mantissa = -mantissa; }
+        
+        void Store(Solution& solution) const {
+            const long long limit = 1 << 20; // Já fora do alcance do double
+            const int clamped = static_cast<int>(std::max(-limit, std::min(limit, exponent)));
+            solution.determinant = std::ldexp(mantissa, clamped);
+            solution.determinantSign = mantissa > 0.0 ? 1 : (mantissa < 0.0 ? -1 : 0);
+            solution.logAbsDeterminant = mantissa == 0.0
+                ? -HUGE_VAL
+                : std::log(std::abs(mantissa)) + static_cast<double>(exponent) * 0.6931471805599453;
+        }
+    };
     
-    // Função para trocar duas linhas da matriz
-    void SwapRows(std::vector<std::vector<double>>& matrix, int row1, int row2) const {
-        if (row1 != row2) {
-            std::swap(matrix[row1], matrix[row2]);
+    // Diagnósticos de P·A = L·U: posto completo, trocas de linha e produto da diagonal de U
+    template <typename T>
+    static void StoreLUDiagnostics(const DenseMatrixT<T>& lu, const std::vector<int>& pivots, Solution& solution) {
+        const int n = lu.Rows();
+        DeterminantProduct determinant;
+        for (int k = 0; k < n; k++) {
+            determinant.Multiply(static_cast<double>(lu(k, k)));
+            if (pivots[k] != k) {
+                determinant.Negate();
+            }
         }
+        determinant.Store(solution);
+        solution.pivots.assign(pivots.begin(), pivots.begin() + n);
+        solution.rank = n;
     }
     
-    // Eliminação Gaussiana com pivoteamento parcial
-    Solution GaussianElimination(std::vector<std::vector<double>> augmentedMatrix) const {
-        Solution solution;
-        int n = static_cast<int>(augmentedMatrix.size());
+    // Eliminação Gaussiana com pivoteamento parcial (opera in-place na matriz
+    // aumentada). Com posto completo, a parte quadrada guarda os fatores de
+    // Crout P·A = M·U: pivôs na diagonal, multiplicadores abaixo dela e U
+    // unitária (normalizada) acima.
+    void GaussianElimination(DenseMatrix& augmentedMatrix, 
+                             std::vector<int>& pivotCols,
+                             Solution& solution) const {
+        Reset(solution);
+        int n = augmentedMatrix.Rows();
         
-        if (n == 0 || augmentedMatrix[0].size() != static_cast<size_t>(n + 1)) {
-            solution.status = SolutionStatus::CALCULATION_ERROR;
-            return solution;
+        if (n == 0 || augmentedMatrix.Cols() != n + 1) {
+            return;
         }
         
-        std::vector<int> pivotCols(n, -1); // Para rastrear colunas de pivô
+        pivotCols.assign(n, -1); // Para rastrear colunas de pivô
+        solution.pivots.reserve(n);
         int rank = 0;
+        DeterminantProduct determinant;
         
         // Fase de eliminação (forward elimination)
         for (int col = 0; col < n && rank < n; col++) {
@@ -75,41 +264,58 @@ private:
             }
             
             // Trocar linhas se necessário
-            SwapRows(augmentedMatrix, rank, pivotRow);
+            augmentedMatrix.SwapRows(rank, pivotRow);
             pivotCols[rank] = col;
+            solution.pivots.push_back(pivotRow);
             
-            // Normalizar linha do pivô
-            double pivot = augmentedMatrix[rank][col];
-            for (int j = 0; j <= n; j++) {
-                augmentedMatrix[rank][j] /= pivot;
+            // Normalizar linha do pivô (colunas à esquerda de col já são zero)
+            double* pivotRowData = augmentedMatrix.Row(rank);
+            double pivot = pivotRowData[col];
+            determinant.Multiply(pivot);
+            if (pivotRow != rank) {
+                determinant.Negate();
             }
+            SimdScale(n - col, 1.0 / pivot, pivotRowData + col + 1);
             
-            // Eliminar elementos abaixo do pivô
-            for (int i = rank + 1; i < n; i++) {
-                if (!IsZero(augmentedMatrix[i][col])) {
-                    double factor = augmentedMatrix[i][col];
-                    for (int j = 0; j <= n; j++) {
-                        augmentedMatrix[i][j] -= factor * augmentedMatrix[rank][j];
+            // Eliminar elementos abaixo do pivô (linhas independentes entre si);
+            // o multiplicador fica no lugar do elemento eliminado
+            const int width = n - col;
+            ThreadPool* pool = (n - rank - 1) * width >= PARALLEL_MIN_WORK ? threadPool.get() : nullptr;
+            ParallelFor(pool, rank + 1, n, std::max(1, PARALLEL_MIN_WORK / width), [&](int rowBegin, int rowEnd) {
+                for (int i = rowBegin; i < rowEnd; i++) {
+                    double* rowData = augmentedMatrix.Row(i);
+                    if (!IsZero(rowData[col])) {
+                        double factor = rowData[col];
+                        SimdAxpy(width, -factor, pivotRowData + col + 1, rowData + col + 1);
+                    } else {
+                        rowData[col] = 0.0;
                     }
                 }
-            }
+            });
             
             rank++;
         }
         
+        // O posto e o determinante valem para qualquer classificação
+        if (rank < n) {
+            determinant.Multiply(0.0);
+        }
+        determinant.Store(solution);
+        solution.rank = rank;
+        
         // Verificar consistência do sistema
         for (int i = rank; i < n; i++) {
-            if (!IsZero(augmentedMatrix[i][n])) {
+            if (!IsZero(augmentedMatrix(i, n))) {
                 // Linha da forma [0 0 ... 0 | c] onde c ≠ 0
                 solution.status = SolutionStatus::NO_SOLUTION;
-                return solution;
+                return;
             }
         }
         
         // Verificar se há variáveis livres (infinitas soluções)
         if (rank < n) {
             solution.status = SolutionStatus::INFINITE_SOLUTIONS;
-            return solution;
+            return;
         }
         
         // Substituição regressiva (back substitution)
@@ -119,22 +325,676 @@ private:
             int col = pivotCols[i];
             if (col == -1) continue;
             
-            solution.values[col] = augmentedMatrix[i][n];
+            const double* rowData = augmentedMatrix.Row(i);
+            double value = rowData[n];
             
             for (int j = col + 1; j < n; j++) {
-                solution.values[col] -= augmentedMatrix[i][j] * solution.values[j];
+                value -= rowData[j] * solution.values[j];
             }
+            
+            solution.values[col] = value;
         }
         
         // Marcar como solução válida
         solution.hasSolution = true;
         solution.status = SolutionStatus::UNIQUE_SOLUTION;
+    }
+    
+    // Resolver A·x = b com os fatores de Crout da eliminação clássica
+    static void CroutSolveInPlace(const DenseMatrix& factors, const std::vector<int>& pivots, double* b) {
+        const int n = factors.Rows();
+        for (int k = 0; k < n; k++) {
+            if (pivots[k] != k) {
+                std::swap(b[k], b[pivots[k]]);
+            }
+        }
+        
+        for (int i = 0; i < n; i++) {
+            const double* rowData = factors.Row(i);
+            double sum = b[i];
+            for (int j = 0; j < i; j++) {
+                sum -= rowData[j] * b[j];
+            }
+            b[i] = sum / rowData[i];
+        }
+        
+        for (int i = n - 2; i >= 0; i--) {
+            const double* rowData = factors.Row(i);
+            double sum = b[i];
+            for (int j = i + 1; j < n; j++) {
+                sum -= rowData[j] * b[j];
+            }
+            b[i] = sum;
+        }
+    }
+    
+    // Aᵀ·x = b com os mesmos fatores: Uᵀ (unitária), Mᵀ e as trocas em ordem inversa
+    static void CroutSolveTransposeInPlace(const DenseMatrix& factors, const std::vector<int>& pivots, double* b) {
+        const int n = factors.Rows();
+        for (int i = 0; i < n; i++) {
+            SimdAxpy(n - i - 1, -b[i], factors.Row(i) + i + 1, b + i + 1);
+        }
+        
+        for (int i = n - 1; i >= 0; i--) {
+            const double* rowData = factors.Row(i);
+            b[i] /= rowData[i];
+            SimdAxpy(i, -b[i], rowData, b);
+        }
+        
+        for (int k = n - 1; k >= 0; k--) {
+            if (pivots[k] != k) {
+                std::swap(b[k], b[pivots[k]]);
+            }
+        }
+    }
+    
+    // x = A⁻¹·x (ou A⁻ᵀ·x) com os fatores que a última resolução deixou no workspace
+    static void SolveWithFactors(SolverWorkspace& workspace, double* x, bool transpose) {
+        using FactorKind = SolverWorkspace::FactorKind;
+        switch (workspace.factorKind) {
+            case FactorKind::CROUT:
+                if (transpose) {
+                    CroutSolveTransposeInPlace(workspace.augmented, workspace.pivots, x);
+                } else {
+                    CroutSolveInPlace(workspace.augmented, workspace.pivots, x);
+                }
+                break;
+            case FactorKind::LU:
+                if (transpose) {
+                    BlockedLU<double>::SolveTransposeInPlace(workspace.factors, workspace.pivots, x);
+                } else {
+                    BlockedLU<double>::SolveInPlace(workspace.factors, workspace.pivots, x);
+                }
+                break;
+            case FactorKind::SINGLE_LU: {
+                const int n = workspace.singleFactors.Rows();
+                std::vector<float>& single = workspace.correction;
+                single.resize(n);
+                for (int i = 0; i < n; i++) {
+                    single[i] = static_cast<float>(x[i]);
+                }
+                if (transpose) {
+                    BlockedLU<float>::SolveTransposeInPlace(workspace.singleFactors, workspace.pivots, single.data());
+                } else {
+                    BlockedLU<float>::SolveInPlace(workspace.singleFactors, workspace.pivots, single.data());
+                }
+                for (int i = 0; i < n; i++) {
+                    x[i] = single[i];
+                }
+                break;
+            }
+            case FactorKind::CHOLESKY:
+                SymmetricFactorization<double>::SolveCholeskyInPlace(workspace.factors, x);
+                break;
+            case FactorKind::LDLT:
+                SymmetricFactorization<double>::SolveLDLTInPlace(workspace.factors, workspace.pivots,
+                                                                 workspace.offDiagonal, x);
+                break;
+            case FactorKind::BAND:
+                if (transpose) {
+                    workspace.band.SolveTransposeInPlace(x);
+                } else {
+                    workspace.band.SolveInPlace(x);
+                }
+                break;
+            case FactorKind::TRIDIAGONAL: {
+                // Thomas refaz a eliminação em O(n); a transposta troca as diagonais
+                const int n = static_cast<int>(workspace.diagonal.size());
+                BandLU::SolveTridiagonal(n, transpose ? workspace.upper.data() : workspace.lower.data(),
+                                         workspace.diagonal.data(),
+                                         transpose ? workspace.lower.data() : workspace.upper.data(),
+                                         x, 0.0, workspace.modifiedUpper.data());
+                break;
+            }
+            default:
+                break;
+        }
+    }
+    
+    // ‖A‖₁ (maior soma de coluna) percorrendo só a banda [-lower, +upper]
+    template <typename MatrixType>
+    static double NormOne(const MatrixType& matrix, int n, int lower, int upper, std::vector<double>& columnSums) {
+        columnSums.assign(n, 0.0);
+        for (int i = 0; i < n; i++) {
+            const int end = std::min(n - 1, i + upper);
+            for (int j = std::max(0, i - lower); j <= end; j++) {
+                columnSums[j] += std::abs(matrix(i, j));
+            }
+        }
+        double norm = 0.0;
+        for (int j = 0; j < n; j++) {
+            norm = std::max(norm, columnSums[j]);
+        }
+        return norm;
+    }
+    
+    // κ₁(A) ≈ ‖A‖₁·‖A⁻¹‖₁ pelo estimador de Hager/Higham sobre os fatores do
+    // workspace: algumas resoluções O(n²), sem formar a inversa
+    void EstimateCondition(double normOne, int n, Solution& solution, SolverWorkspace& workspace) const {
+        if (!estimateCondition || workspace.factorKind == SolverWorkspace::FactorKind::NONE) {
+            return;
+        }
+        const double inverseNorm = ConditionEstimator::InverseNormOne(n,
+            [&](double* x) { SolveWithFactors(workspace, x, false); },
+            [&](double* x) { SolveWithFactors(workspace, x, true); },
+            workspace.estimate, workspace.signs);
+        solution.conditionEstimate = normOne * inverseNorm;
+        solution.illConditioned = !(solution.conditionEstimate <= ILL_CONDITIONED_THRESHOLD);
+    }
+    
+    // Refinamento iterativo em double com os fatores já calculados (O(n²) por
+    // passo), tentado quando a solução direta não passa na verificação.
+    // Para quando o resíduo passa ou deixa de cair pela metade.
+    bool RefineSolution(const DenseMatrix& coefficients, 
+                        const std::vector<double>& constants,
+                        Solution& solution,
+                        SolverWorkspace& workspace) const {
+        if (workspace.factorKind == SolverWorkspace::FactorKind::NONE) {
+            return false;
+        }
+        return RefineSolution(coefficients, constants, solution, workspace.residual,
+                              [&](double* x) { SolveWithFactors(workspace, x, false); });
+    }
+    
+    // Idem, com qualquer resolução pelos fatores (x <- A⁻¹·x)
+    template <typename SolveFactors>
+    bool RefineSolution(const DenseMatrix& coefficients, 
+                        const std::vector<double>& constants,
+                        Solution& solution,
+                        std::vector<double>& residual,
+                        SolveFactors solveFactors) const {
+        const int n = coefficients.Rows();
+        double previousNorm = HUGE_VAL;
+        
+        for (int step = 0; step <= MAX_REFINEMENT_STEPS; step++) {
+            if (Residual(coefficients, constants, solution.values, residual)) {
+                return true;
+            }
+            
+            double norm = 0.0;
+            for (int i = 0; i < n; i++) {
+                norm = std::max(norm, std::abs(residual[i]));
+            }
+            if (!(norm < 0.5 * previousNorm) || step == MAX_REFINEMENT_STEPS) {
+                return false;
+            }
+            previousNorm = norm;
+            
+            solveFactors(residual.data());
+            for (int i = 0; i < n; i++) {
+                solution.values[i] += residual[i];
+            }
+            solution.iterations = step + 1;
+        }
+        return false;
+    }
+    
+    // Sistema inteiro pequeno o bastante para a eliminação exata?
+    template <typename MatrixType>
+    bool UseExact(int n, const MatrixType& coefficients, const std::vector<double>& constants) const {
+        if (!exactArithmetic || n > EXACT_MAX_SIZE) {
+            return false;
+        }
+        for (int i = 0; i < n; i++) {
+            for (int j = 0; j < n; j++) {
+                if (!ExactSolver::IsIntegral(At(coefficients, i, j))) {
+                    return false;
+                }
+            }
+            if (!ExactSolver::IsIntegral(constants[i])) {
+                return false;
+            }
+        }
+        return true;
+    }
+    
+    // Copiar um resultado exato para a Solution (valores e determinante
+    // também arredondados para double)
+    static void StoreExact(ExactSolver::Outcome outcome, int rank, ExactSolver::Rational determinant,
+                           std::vector<ExactSolver::Rational> values, Solution& solution) {
+        solution.exact = true;
+        solution.rank = rank;
+        solution.pivots.clear();
+        solution.iterations = 0;
+        solution.diagnostics.clear();
+        solution.determinant = determinant.ToDouble();
+        solution.determinantSign = determinant.numerator.Sign();
+        solution.logAbsDeterminant = determinant.numerator.LogAbs() - determinant.denominator.LogAbs();
+        solution.exactDeterminant = std::move(determinant);
+        solution.exactValues = std::move(values);
+        solution.values.resize(solution.exactValues.size());
+        for (size_t i = 0; i < solution.exactValues.size(); i++) {
+            solution.values[i] = solution.exactValues[i].ToDouble();
+        }
+        switch (outcome) {
+            case ExactSolver::Outcome::UNIQUE_SOLUTION:
+                solution.hasSolution = true;
+                solution.status = SolutionStatus::UNIQUE_SOLUTION;
+                return;
+            case ExactSolver::Outcome::NO_SOLUTION:
+                solution.status = SolutionStatus::NO_SOLUTION;
+                break;
+            case ExactSolver::Outcome::INFINITE_SOLUTIONS:
+                solution.status = SolutionStatus::INFINITE_SOLUTIONS;
+                break;
+            default:
+                solution.exact = false;
+                solution.hasSolution = false;
+                solution.status = SolutionStatus::CALCULATION_ERROR;
+                solution.diagnostics = "Entrada inválida para a aritmética exata";
+                return;
+        }
+        solution.hasSolution = false;
+        solution.conditionEstimate = HUGE_VAL;
+        solution.illConditioned = true;
+    }
+    
+    // Sistema inteiro que o ponto flutuante deu como singular, reprovou na
+    // verificação ou achou mal condicionado: a eliminação exata decide sem epsilon
+    bool ExactSolve(const DenseMatrix& coefficients, const std::vector<double>& constants, Solution& solution) const {
+        const int n = coefficients.Rows();
+        if (!UseExact(n, coefficients, constants)) {
+            return false;
+        }
+        
+        if (n > EXACT_MODULAR_THRESHOLD) {
+            MultiModularSolver::Result exact = MultiModularSolver::Solve(coefficients, constants, threadPool.get());
+            StoreExact(exact.outcome, exact.rank, std::move(exact.determinant), std::move(exact.values), solution);
+        } else {
+            ExactSolver::Result exact = ExactSolver::Solve(coefficients, constants);
+            ExactSolver::Rational determinant;
+            determinant.numerator = std::move(exact.determinant);
+            StoreExact(exact.outcome, exact.rank, std::move(determinant), std::move(exact.values), solution);
+        }
+        return true;
+    }
+    
+    // Decidir se o sistema deve usar a LU em blocos
+    bool UseBlocked(int n) const {
+        switch (algorithm) {
+            case Algorithm::CLASSIC:
+                return false;
+            case Algorithm::BLOCKED:
+                return true;
+            default:
+                return n >= blockedThreshold;
+        }
+    }
+    
+    // Resolver via LU em blocos. Retorna false se a matriz for (numericamente) singular,
+    // caso em que a classificação fica a cargo da eliminação clássica.
+    bool BlockedSolve(const DenseMatrix& coefficients, 
+                      const std::vector<double>& constants,
+                      Solution& solution,
+                      SolverWorkspace& workspace) const {
+        DenseMatrix& lu = workspace.factors;
+        lu = coefficients;
+        
+        if (BlockedLU<double>::Factor(lu, workspace.pivots, blockSize, EPSILON, threadPool.get()) != -1) {
+            return false;
+        }
+        
+        solution.values = constants;
+        BlockedLU<double>::SolveInPlace(lu, workspace.pivots, solution.values.data());
+        StoreLUDiagnostics(lu, workspace.pivots, solution);
+        workspace.factorKind = SolverWorkspace::FactorKind::LU;
+        solution.hasSolution = true;
+        solution.status = SolutionStatus::UNIQUE_SOLUTION;
+        return true;
+    }
+    
+    // r = b - A·x em double. Retorna true se o resíduo passa na verificação de
+    // Solve (todas as componentes com |r_i| <= EPSILON·100).
+    bool Residual(const DenseMatrix& coefficients, 
+                  const std::vector<double>& constants,
+                  const std::vector<double>& x,
+                  std::vector<double>& residual) const {
+        const int n = coefficients.Rows();
+        residual.resize(n);
+        ThreadPool* pool = static_cast<long long>(n) * n >= 4LL * PARALLEL_MIN_WORK ? threadPool.get() : nullptr;
+        ParallelFor(pool, 0, n, std::max(1, PARALLEL_MIN_WORK / std::max(1, n)), [&](int rowBegin, int rowEnd) {
+            for (int i = rowBegin; i < rowEnd; i++) {
+                const double* rowData = coefficients.Row(i);
+                double sum = 0.0;
+                for (int j = 0; j < n; j++) {
+                    sum += rowData[j] * x[j];
+                }
+                residual[i] = constants[i] - sum;
+            }
+        });
         
-        return solution;
+        for (int i = 0; i < n; i++) {
+            if (!(std::abs(residual[i]) <= EPSILON * 100)) {
+                return false;
+            }
+        }
+        return true;
     }
     
+    // Precisão mista: LU em float (metade da memória e da banda, o dobro de
+    // elementos por instrução SIMD) e refinamento iterativo com resíduos em
+    // double, x += (LU)⁻¹·(b - A·x), até o resíduo passar na verificação.
+    // Retorna false (para a fatoração em double assumir) se a matriz for
+    // singular em float, se não couber no intervalo do float ou se o
+    // refinamento não convergir.
+    bool MixedPrecisionSolve(const DenseMatrix& coefficients, 
+                             const std::vector<double>& constants,
+                             Solution& solution,
+                             SolverWorkspace& workspace) const {
+        const int n = coefficients.Rows();
+        DenseMatrixT<float>& lu = workspace.singleFactors;
+        lu.Resize(n, n);
+        for (int i = 0; i < n; i++) {
+            const double* source = coefficients.Row(i);
+            float* target = lu.Row(i);
+            for (int j = 0; j < n; j++) {
+                target[j] = static_cast<float>(source[j]);
+                if (!std::isfinite(target[j])) {
+                    return false;
+                }
+            }
+        }
+        
+        std::vector<int>& pivots = workspace.pivots;
+        if (BlockedLU<float>::Factor(lu, pivots, blockSize, static_cast<float>(EPSILON), threadPool.get()) != -1) {
+            return false;
+        }
+        
+        std::vector<double>& x = workspace.values;
+        std::vector<double>& residual = workspace.residual;
+        std::vector<float>& correction = workspace.correction;
+        x.assign(n, 0.0);
+        residual = constants;
+        correction.resize(n);
+        double previousNorm = HUGE_VAL;
+        
+        for (int step = 0; step <= MAX_REFINEMENT_STEPS; step++) {
+            if (step > 0 && Residual(coefficients, constants, x, residual)) {
+                solution.values = x;
+                solution.hasSolution = true;
+                solution.status = SolutionStatus::UNIQUE_SOLUTION;
+                solution.iterations = step;
+                // Determinante dos fatores em float: precisão relativa de float
+                StoreLUDiagnostics(lu, pivots, solution);
+                workspace.factorKind = SolverWorkspace::FactorKind::SINGLE_LU;
+                return true;
+            }
+            
+            // Sem redução pela metade (ou resíduo não finito): não vai convergir
+            double norm = 0.0;
+            for (int i = 0; i < n; i++) {
+                norm = std::max(norm, std::abs(residual[i]));
+            }
+            if (!(norm < 0.5 * previousNorm)) {
+                return false;
+            }
+            previousNorm = norm;
+            
+            for (int i = 0; i < n; i++) {
+                correction[i] = static_cast<float>(residual[i]);
+            }
+            BlockedLU<float>::SolveInPlace(lu, pivots, correction.data());
+            for (int i = 0; i < n; i++) {
+                x[i] += correction[i];
+            }
+        }
+        
+        return false;
+    }
+    
+    // Thomas quando a matriz é tridiagonal e diagonalmente dominante (não
+    // precisa de pivoteamento), LU em banda com pivoteamento nos demais casos.
+    // matrix é uma BandMatrix ou a banda [-lower, +upper] de uma DenseMatrix;
+    // solution.values entra com as constantes e sai com a solução.
+    // Retorna false se a matriz for (numericamente) singular.
+    template <typename MatrixType>
+    static bool SolveBandInPlace(const MatrixType& matrix, int n, int lower, int upper,
+                                 Solution& solution, SolverWorkspace& workspace) {
+        std::vector<double>& values = solution.values;
+        if (lower == 1 && upper == 1) {
+            std::vector<double>& subDiagonal = workspace.lower;
+            std::vector<double>& diagonal = workspace.diagonal;
+            std::vector<double>& superDiagonal = workspace.upper;
+            subDiagonal.resize(n - 1);
+            diagonal.resize(n);
+            superDiagonal.resize(n - 1);
+            bool dominant = true;
+            for (int i = 0; i < n; i++) {
+                diagonal[i] = matrix(i, i);
+                if (i + 1 < n) {
+                    subDiagonal[i] = matrix(i + 1, i);
+                    superDiagonal[i] = matrix(i, i + 1);
+                }
+                const double offDiagonal = (i > 0 ? std::abs(subDiagonal[i - 1]) : 0.0) +
+                                           (i + 1 < n ? std::abs(superDiagonal[i]) : 0.0);
+                dominant = dominant && std::abs(diagonal[i]) >= offDiagonal;
+            }
+            
+            std::vector<double>& result = workspace.values;
+            result = values;
+            workspace.modifiedUpper.resize(n);
+            if (dominant && BandLU::SolveTridiagonal(n, subDiagonal.data(), diagonal.data(), superDiagonal.data(),
+                                                     result.data(), EPSILON, workspace.modifiedUpper.data())) {
+                workspace.factorKind = SolverWorkspace::FactorKind::TRIDIAGONAL;
+                if (BandSingular(matrix, n, lower, upper, workspace)) {
+                    return false;
+                }
+                values = result;
+                // Pivôs do Thomas refeitos em O(n) a partir dos coeficientes modificados
+                DeterminantProduct determinant;
+                determinant.Multiply(diagonal[0]);
+                for (int i = 1; i < n; i++) {
+                    determinant.Multiply(diagonal[i] - subDiagonal[i - 1] * workspace.modifiedUpper[i - 1]);
+                }
+                determinant.Store(solution);
+                solution.pivots.resize(n);
+                std::iota(solution.pivots.begin(), solution.pivots.end(), 0);
+                solution.rank = n;
+                return true;
+            }
+        }
+        
+        BandLU& lu = workspace.band;
+        if (!lu.Factor(matrix, n, lower, upper, EPSILON)) {
+            return false;
+        }
+        workspace.factorKind = SolverWorkspace::FactorKind::BAND;
+        if (BandSingular(matrix, n, lower, upper, workspace)) {
+            return false;
+        }
+        lu.SolveInPlace(values.data());
+        
+        DeterminantProduct determinant;
+        for (int k = 0; k < n; k++) {
+            determinant.Multiply(lu.Diagonal(k));
+            if (lu.Pivots()[k] != k) {
+                determinant.Negate();
+            }
+        }
+        determinant.Store(solution);
+        solution.pivots = lu.Pivots();
+        solution.rank = n;
+        return true;
+    }
+    
+    // κ₁ da banda pelos fatores do workspace, calculado mesmo sem a estimativa
+    // ligada (O(n·banda) por resolução): o critério EPSILON dos pivôs não pega
+    // matrizes singulares cujo pivô nulo sobra como arredondamento
+    template <typename MatrixType>
+    static bool BandSingular(const MatrixType& matrix, int n, int lower, int upper, SolverWorkspace& workspace) {
+        const double inverseNorm = ConditionEstimator::InverseNormOne(n,
+            [&](double* x) { SolveWithFactors(workspace, x, false); },
+            [&](double* x) { SolveWithFactors(workspace, x, true); },
+            workspace.estimate, workspace.signs);
+        if (NormOne(matrix, n, lower, upper, workspace.columnSums) * inverseNorm <= SINGULAR_CONDITION) {
+            return false;
+        }
+        workspace.factorKind = SolverWorkspace::FactorKind::NONE;
+        return true;
+    }
+    
+    // Caminho em banda do modo automático: a largura de banda é medida (com
+    // saída antecipada para matrizes cheias) e, se for estreita, a banda é
+    // fatorada direto da matriz densa em O(n·lower·(lower + upper)).
+    // singular indica que a banda foi detectada mas a matriz é (numericamente)
+    // singular: a classificação fica com a eliminação clássica.
+    static bool BandSolve(const DenseMatrix& coefficients, 
+                          const std::vector<double>& constants,
+                          Solution& solution,
+                          SolverWorkspace& workspace,
+                          bool& singular) {
+        int lower = 0;
+        int upper = 0;
+        const int n = coefficients.Rows();
+        if (!BandMatrix::DetectBandwidth(coefficients, n / BAND_DETECTION_RATIO, lower, upper)) {
+            return false;
+        }
+        
+        solution.values = constants;
+        if (!SolveBandInPlace(coefficients, n, lower, upper, solution, workspace)) {
+            singular = true;
+            return false;
+        }
+        
+        solution.hasSolution = true;
+        solution.status = SolutionStatus::UNIQUE_SOLUTION;
+        return true;
+    }
+    
+    // Simetria exata, com saída na primeira diferença (matrizes não simétricas
+    // costumam ser rejeitadas logo nas primeiras linhas)
+    static bool IsSymmetric(const DenseMatrix& matrix) {
+        const int n = matrix.Rows();
+        for (int i = 1; i < n; i++) {
+            const double* rowData = matrix.Row(i);
+            for (int j = 0; j < i; j++) {
+                if (rowData[j] != matrix(j, i)) {
+                    return false;
+                }
+            }
+        }
+        return true;
+    }
+    
+    // Caminho simétrico: Cholesky quando a diagonal é positiva, Bunch-Kaufman
+    // LDLᵀ se a matriz não for positiva definida. Retorna false se a matriz for
+    // (numericamente) singular, caso em que a eliminação clássica classifica o sistema.
+    bool SymmetricSolve(const DenseMatrix& coefficients, 
+                        const std::vector<double>& constants,
+                        Solution& solution,
+                        SolverWorkspace& workspace) const {
+        const int n = coefficients.Rows();
+        bool positiveDiagonal = true;
+        for (int i = 0; i < n && positiveDiagonal; i++) {
+            positiveDiagonal = coefficients(i, i) > 0.0;
+        }
+        
+        DenseMatrix& factors = workspace.factors;
+        factors = coefficients;
+        solution.values = constants;
+        
+        if (positiveDiagonal && 
+            SymmetricFactorization<double>::FactorCholesky(factors, blockSize, EPSILON, workspace.panel,
+                                                           threadPool.get()) == -1) {
+            SymmetricFactorization<double>::SolveCholeskyInPlace(factors, solution.values.data());
+            
+            // det(A) = det(L)²
+            DeterminantProduct determinant;
+            for (int k = 0; k < n; k++) {
+                determinant.Multiply(factors(k, k));
+                determinant.Multiply(factors(k, k));
+            }
+            determinant.Store(solution);
+            solution.pivots.resize(n);
+            std::iota(solution.pivots.begin(), solution.pivots.end(), 0);
+            workspace.factorKind = SolverWorkspace::FactorKind::CHOLESKY;
+        } else {
+            if (positiveDiagonal) {
+                factors = coefficients;
+            }
+            std::vector<int>& pivots = workspace.pivots;
+            std::vector<double>& offDiagonal = workspace.offDiagonal;
+            if (SymmetricFactorization<double>::FactorLDLT(factors, pivots, offDiagonal, blockSize, EPSILON,
+                                                           workspace.columns, workspace.panel,
+                                                           threadPool.get()) != -1) {
+                solution.values.clear();
+                return false;
+            }
+            SymmetricFactorization<double>::SolveLDLTInPlace(factors, pivots, offDiagonal, solution.values.data());
+            
+            // det(A) = det(D) (as trocas simétricas não mudam o sinal); os blocos
+            // 2x2 viram duas trocas de linha: k com k e k + 1 com p
+            DeterminantProduct determinant;
+            solution.pivots.resize(n);
+            for (int k = 0; k < n; k++) {
+                if (pivots[k] >= 0) {
+                    determinant.Multiply(factors(k, k));
+                    solution.pivots[k] = pivots[k];
+                } else {
+                    const double d21 = offDiagonal[k];
+                    determinant.Multiply(factors(k, k) * factors(k + 1, k + 1) - d21 * d21);
+                    solution.pivots[k] = k;
+                    solution.pivots[k + 1] = -pivots[k] - 1;
+                    k++;
+                }
+            }
+            determinant.Store(solution);
+            workspace.factorKind = SolverWorkspace::FactorKind::LDLT;
+        }
+        
+        solution.rank = n;
+        solution.hasSolution = true;
+        solution.status = SolutionStatus::UNIQUE_SOLUTION;
+        return true;
+    }
+    
+    // Verificar A·X = B para todas as colunas, linha a linha
+    bool VerifySolutions(const DenseMatrix& coefficients, 
+                         const DenseMatrix& constants,
+                         const DenseMatrix& solutions) const {
+        int n = coefficients.Rows();
+        int k = constants.Cols();
+        std::vector<double> residual(k);
+        
+        for (int i = 0; i < n; i++) {
+            const double* rowData = coefficients.Row(i);
+            std::fill(residual.begin(), residual.end(), 0.0);
+            for (int j = 0; j < n; j++) {
+                const double* solutionRow = solutions.Row(j);
+                for (int c = 0; c < k; c++) {
+                    residual[c] += rowData[j] * solutionRow[c];
+                }
+            }
+            
+            const double* constantRow = constants.Row(i);
+            for (int c = 0; c < k; c++) {
+                if (std::abs(residual[c] - constantRow[c]) > EPSILON * 100) {
+                    return false;
+                }
+            }
+        }
+        
+        return true;
+    }
+    
+    // Matriz não vazia com todas as linhas do tamanho do número de linhas
+    // (DenseMatrix(vector) completaria linhas curtas com zeros)
+    static bool IsSquare(const std::vector<std::vector<double>>& matrix) {
+        for (const auto& row : matrix) {
+            if (row.size() != matrix.size()) {
+                return false;
+            }
+        }
+        return !matrix.empty();
+    }
+    
+    // Acesso uniforme aos dois formatos de matriz aceitos
+    static double At(const DenseMatrix& matrix, int i, int j) { return matrix(i, j); }
+    static double At(const std::vector<std::vector<double>>& matrix, int i, int j) { return matrix[i][j]; }
+    
     // Verificar se a solução encontrada é válida
-    bool VerifySolution(const std::vector<std::vector<double>>& coefficients, 
+    template <typename MatrixType>
+    bool VerifySolution(const MatrixType& coefficients, 
                        const std::vector<double>& constants,
                        const std::vector<double>& solution) const {
         int n = static_cast<int>(solution.size());
@@ -142,7 +1002,7 @@ private:
         for (int i = 0; i < n; i++) {
             double sum = 0.0;
             for (int j = 0; j < n; j++) {
-                sum += coefficients[i][j] * solution[j];
+                sum += At(coefficients, i, j) * solution[j];
             }
             
             if (std::abs(sum - constants[i]) > EPSILON * 100) {
@@ -153,91 +1013,828 @@ private:
         return true;
     }
     
+    // Verificação pelo produto A·x da própria representação (esparsa: O(nnz);
+    // banda: O(n·largura))
+    template <typename StructuredMatrix>
+    bool VerifyProduct(const StructuredMatrix& coefficients, 
+                       const std::vector<double>& constants,
+                       const std::vector<double>& solution) const {
+        std::vector<double> product(solution.size());
+        coefficients.Multiply(solution.data(), product.data());
+        
+        for (std::size_t i = 0; i < product.size(); i++) {
+            if (std::abs(product[i] - constants[i]) > EPSILON * 100) {
+                return false;
+            }
+        }
+        
+        return true;
+    }
+    
+    // Densa: o mesmo teste que encerra o refinamento da precisão mista
+    bool VerifySolution(const DenseMatrix& coefficients, 
+                        const std::vector<double>& constants,
+                        const std::vector<double>& solution) const {
+        std::vector<double> residual;
+        return Residual(coefficients, constants, solution, residual);
+    }
+    
+    // Variantes com o vetor de resíduo do workspace (só a densa o usa)
+    bool VerifySolution(const DenseMatrix& coefficients, 
+                        const std::vector<double>& constants,
+                        const std::vector<double>& solution,
+                        std::vector<double>& residual) const {
+        return Residual(coefficients, constants, solution, residual);
+    }
+    
+    template <typename MatrixType>
+    bool VerifySolution(const MatrixType& coefficients, 
+                        const std::vector<double>& constants,
+                        const std::vector<double>& solution,
+                        std::vector<double>&) const {
+        return VerifySolution(coefficients, constants, solution);
+    }
+    
+    bool VerifySolution(const SparseMatrix& coefficients, 
+                        const std::vector<double>& constants,
+                        const std::vector<double>& solution) const {
+        return VerifyProduct(coefficients, constants, solution);
+    }
+    
+    bool VerifySolution(const BandMatrix& coefficients, 
+                        const std::vector<double>& constants,
+                        const std::vector<double>& solution) const {
+        return VerifyProduct(coefficients, constants, solution);
+    }
+    
+    // Candidata a Cholesky: simétrica e com diagonal positiva
+    static bool IsCholeskyCandidate(const SparseMatrix& matrix) {
+        for (int i = 0; i < matrix.Rows(); i++) {
+            if (!(matrix.At(i, i) > 0.0)) {
+                return false;
+            }
+        }
+        return matrix.IsSymmetric();
+    }
+    
+    enum class IterativeMethod {
+        CONJUGATE_GRADIENT,
+        GMRES,
+        BICGSTAB
+    };
+    
+    // Executar um método de Krylov com as opções atuais e traduzir o resultado
+    Solution SolveIterative(const SparseMatrix& coefficients, 
+                            const std::vector<double>& constants,
+                            IterativeMethod method) const {
+        Solution result;
+        
+        if (coefficients.Rows() == 0 || coefficients.Rows() != coefficients.Cols() ||
+            coefficients.Rows() != static_cast<int>(constants.size())) {
+            return result;
+        }
+        
+        Preconditioner preconditioner;
+        if (!preconditioner.Setup(coefficients, iterativeOptions.preconditioner, iterativeOptions.blockSize,
+                                  iterativeOptions.dropTolerance, iterativeOptions.fillPerRow)) {
+            result.diagnostics = "Precondicionador não pôde ser construído (pivô nulo ou não positivo)";
+            return result;
+        }
+        
+        const int n = coefficients.Rows();
+        const int maxIterations = iterativeOptions.maxIterations > 0 ? iterativeOptions.maxIterations : 2 * n;
+        const double tolerance = iterativeOptions.tolerance;
+        const char* name = "CG";
+        KrylovSolvers::Outcome outcome;
+        switch (method) {
+            case IterativeMethod::GMRES:
+                name = "GMRES";
+                outcome = KrylovSolvers::Gmres(coefficients, constants, result.values, preconditioner,
+                                               iterativeOptions.restart, tolerance, maxIterations,
+                                               result.residualHistory);
+                break;
+            case IterativeMethod::BICGSTAB:
+                name = "BiCGSTAB";
+                outcome = KrylovSolvers::BiCgStab(coefficients, constants, result.values, preconditioner,
+                                                  tolerance, maxIterations, result.residualHistory);
+                break;
+            default:
+                outcome = KrylovSolvers::ConjugateGradient(coefficients, constants, result.values, preconditioner,
+                                                           tolerance, maxIterations, result.residualHistory);
+                break;
+        }
+        result.iterations = static_cast<int>(result.residualHistory.size()) - 1;
+        
+        if (outcome == KrylovSolvers::Outcome::CONVERGED) {
+            result.hasSolution = true;
+            result.status = SolutionStatus::UNIQUE_SOLUTION;
+            return result;
+        }
+        
+        const char* reason = "atingiu o limite de iterações";
+        if (outcome == KrylovSolvers::Outcome::STAGNATION) {
+            reason = "estagnou";
+        } else if (outcome == KrylovSolvers::Outcome::BREAKDOWN) {
+            reason = method == IterativeMethod::CONJUGATE_GRADIENT
+                ? "falhou (matriz não é simétrica positiva definida)"
+                : "falhou (divisão por zero no método)";
+        }
+        char message[160];
+        std::snprintf(message, sizeof(message), "%s %s após %d iterações (resíduo relativo %.3e)",
+                      name, reason, result.iterations, result.residualHistory.back());
+        result.diagnostics = message;
+        result.values.clear();
+        return result;
+    }
+    
+    // Caminho de tamanho fixo (pilha, sem alocações além do vetor de resposta).
+    // Retorna false para matrizes singulares, que seguem para o caminho geral.
+    template <int N, typename MatrixType>
+    bool SolveFixed(const MatrixType& coefficients, 
+                    const std::vector<double>& constants,
+                    Solution& solution) const {
+        typename FixedLinearSolver<N>::Matrix a;
+        typename FixedLinearSolver<N>::Vector b;
+        typename FixedLinearSolver<N>::Vector x;
+        typename FixedLinearSolver<N>::Pivots pivots;
+        double determinant = 0.0;
+        for (int i = 0; i < N; i++) {
+            for (int j = 0; j < N; j++) {
+                a[i][j] = At(coefficients, i, j);
+            }
+            b[i] = constants[i];
+        }
+        
+        if (!FixedLinearSolver<N>::Solve(a, b, x, determinant, pivots)) {
+            return false;
+        }
+        
+        solution.values.assign(x.begin(), x.end());
+        if (estimateCondition) {
+            // Aqui a inversa exata custa o mesmo que o estimador
+            double normOne = 0.0;
+            for (int j = 0; j < N; j++) {
+                double sum = 0.0;
+                for (int i = 0; i < N; i++) {
+                    sum += std::abs(a[i][j]);
+                }
+                normOne = std::max(normOne, sum);
+            }
+            solution.conditionEstimate = normOne * FixedLinearSolver<N>::InverseNormOne(a);
+            solution.illConditioned = !(solution.conditionEstimate <= ILL_CONDITIONED_THRESHOLD);
+        }
+        DeterminantProduct product;
+        product.Multiply(determinant);
+        product.Store(solution);
+        solution.pivots.assign(pivots.begin(), pivots.end());
+        solution.rank = N;
+        solution.hasSolution = true;
+        solution.status = SolutionStatus::UNIQUE_SOLUTION;
+        return true;
+    }
+    
+    // Despachar para FixedLinearSolver<n> quando 1 <= n <= 10
+    template <typename MatrixType>
+    bool TrySolveFixed(int n, const MatrixType& coefficients, 
+                       const std::vector<double>& constants,
+                       Solution& solution) const {
+        switch (n) {
+            case 1: return SolveFixed<1>(coefficients, constants, solution);
+            case 2: return SolveFixed<2>(coefficients, constants, solution);
+            case 3: return SolveFixed<3>(coefficients, constants, solution);
+            case 4: return SolveFixed<4>(coefficients, constants, solution);
+            case 5: return SolveFixed<5>(coefficients, constants, solution);
+            case 6: return SolveFixed<6>(coefficients, constants, solution);
+            case 7: return SolveFixed<7>(coefficients, constants, solution);
+            case 8: return SolveFixed<8>(coefficients, constants, solution);
+            case 9: return SolveFixed<9>(coefficients, constants, solution);
+            case 10: return SolveFixed<10>(coefficients, constants, solution);
+            default: return false;
+        }
+    }
+    
+    // Resultado do caminho de tamanho fixo, já verificado
+    template <typename MatrixType>
+    bool SolveSmall(int n, const MatrixType& coefficients, 
+                    const std::vector<double>& constants,
+                    Solution& solution,
+                    SolverWorkspace& workspace) const {
+        if (n > FixedLinearSolver<1>::MAX_SIZE || !TrySolveFixed(n, coefficients, constants, solution)) {
+            return false;
+        }
+        
+        if (!VerifySolution(coefficients, constants, solution.values, workspace.residual) ||
+            (solution.illConditioned && UseExact(n, coefficients, constants))) {
+            // Imprecisão numérica (ou sistema inteiro duvidoso, que merece a
+            // eliminação exata): o caminho geral dá o veredito final
+            Reset(solution);
+            return false;
+        }
+        
+        return true;
+    }
+    
 public:
+    // Configuração do algoritmo de eliminação
+    void SetAlgorithm(Algorithm value) { algorithm = value; }
+    Algorithm GetAlgorithm() const { return algorithm; }
+    
+    // Tamanho do bloco (painel) da LU em blocos
+    void SetBlockSize(int value) { blockSize = std::max(1, value); }
+    int GetBlockSize() const { return blockSize; }
+    
+    // Tamanho a partir do qual o modo automático usa a LU em blocos
+    void SetBlockedThreshold(int value) { blockedThreshold = std::max(1, value); }
+    int GetBlockedThreshold() const { return blockedThreshold; }
+    
+    // Número de threads usadas na eliminação (1 = sequencial, 0 = todos os núcleos)
+    void SetThreadCount(int count) {
+        if (count == 1) {
+            threadPool.reset();
+        } else {
+            threadPool = std::make_shared<ThreadPool>(count);
+        }
+    }
+    
+    // Compartilhar um pool existente entre vários solvers
+    void SetThreadPool(std::shared_ptr<ThreadPool> pool) { threadPool = std::move(pool); }
+    std::shared_ptr<ThreadPool> GetThreadPool() const { return threadPool; }
+    int GetThreadCount() const { return threadPool ? threadPool->ThreadCount() : 1; }
+    
+    // Estimativa de κ₁ em cada resolução densa (desligar economiza O(n²) por
+    // chamada em laços de sistemas pequenos)
+    void SetConditionEstimation(bool value) { estimateCondition = value; }
+    bool GetConditionEstimation() const { return estimateCondition; }
+    
+    // Eliminação exata para sistemas inteiros duvidosos (até EXACT_MAX_SIZE)
+    void SetExactArithmetic(bool value) { exactArithmetic = value; }
+    bool GetExactArithmetic() const { return exactArithmetic; }
+    
+    // Ordenação usada pelas fatorações esparsas
+    void SetSparseOrdering(SparseOrdering::Method value) { sparseOrdering = value; }
+    SparseOrdering::Method GetSparseOrdering() const { return sparseOrdering; }
+    
+    // Limiar do pivoteamento da LU esparsa (1 = parcial, menor = preserva a esparsidade)
+    void SetPivotThreshold(double value) { pivotThreshold = std::min(1.0, std::max(0.0, value)); }
+    double GetPivotThreshold() const { return pivotThreshold; }
+    
+    // Solução racional exata (eliminação modular com resto chinês e
+    // reconstrução racional), sem limite de tamanho nem epsilon
+    Solution SolveExact(const std::vector<std::vector<ExactSolver::Rational>>& coefficients,
+                        const std::vector<ExactSolver::Rational>& constants) const {
+        Solution result;
+        MultiModularSolver::Result exact = MultiModularSolver::Solve(coefficients, constants, threadPool.get());
+        StoreExact(exact.outcome, exact.rank, std::move(exact.determinant), std::move(exact.values), result);
+        return result;
+    }
+    
+    // Idem, tomando cada double pelo seu valor binário exato
+    Solution SolveExact(const DenseMatrix& coefficients, const std::vector<double>& constants) const {
+        Solution result;
+        MultiModularSolver::Result exact = MultiModularSolver::Solve(coefficients, constants, threadPool.get());
+        StoreExact(exact.outcome, exact.rank, std::move(exact.determinant), std::move(exact.values), result);
+        return result;
+    }
+    
     // Método principal para resolver o sistema
+    Solution Solve(const DenseMatrix& coefficients, 
+                   const std::vector<double>& constants) const {
+        Solution result;
+        SolverWorkspace workspace;
+        Solve(coefficients, constants, result, workspace);
+        return result;
+    }
+    
+    // Resolver reaproveitando a memória de workspace e a capacidade de
+    // result.values: depois que os buffers atingem o tamanho do sistema,
+    // chamadas repetidas não fazem nenhuma alocação no heap
+    void Solve(const DenseMatrix& coefficients, 
+               const std::vector<double>& constants,
+               Solution& result,
+               SolverWorkspace& workspace) const {
+        Reset(result);
+        
+        if (coefficients.Empty() || constants.empty() || 
+            coefficients.Rows() != static_cast<int>(constants.size()) ||
+            coefficients.Rows() != coefficients.Cols()) {
+            return;
+        }
+        
+        int n = coefficients.Rows();
+        
+        if (SolveSmall(n, coefficients, constants, result, workspace)) {
+            return;
+        }
+        
+        workspace.factorKind = SolverWorkspace::FactorKind::NONE;
+        
+        // Precisão mista: o refinamento termina com a solução já verificada
+        if (algorithm == Algorithm::MIXED_PRECISION && MixedPrecisionSolve(coefficients, constants, result, workspace)) {
+            EstimateCondition(NormOne(coefficients, n, n, n, workspace.columnSums), n, result, workspace);
+            if (result.illConditioned) {
+                ExactSolve(coefficients, constants, result);
+            }
+            return;
+        }
+        
+        // Se o caminho em banda ou o simétrico perder precisão, a LU refaz o
+        // sistema; banda singular vai direto para a eliminação clássica, que
+        // separa sem solução de infinitas
+        bool bandSingular = false;
+        bool solved = algorithm == Algorithm::AUTOMATIC &&
+                      (BandSolve(coefficients, constants, result, workspace, bandSingular) ||
+                       (!bandSingular && IsSymmetric(coefficients) &&
+                        SymmetricSolve(coefficients, constants, result, workspace))) &&
+                      VerifySolution(coefficients, constants, result.values, workspace.residual);
+        
+        if (!solved && (bandSingular || !UseBlocked(n) || !BlockedSolve(coefficients, constants, result, workspace))) {
+            // Criar matriz aumentada [A|b]
+            DenseMatrix& augmentedMatrix = workspace.augmented;
+            augmentedMatrix.Resize(n, n + 1);
+            
+            for (int i = 0; i < n; i++) {
+                std::copy(coefficients.Row(i), coefficients.Row(i) + n, augmentedMatrix.Row(i));
+                augmentedMatrix(i, n) = constants[i];
+            }
+            
+            GaussianElimination(augmentedMatrix, workspace.pivotColumns, result);
+            if (result.hasSolution) {
+                workspace.pivots = result.pivots;
+                workspace.factorKind = SolverWorkspace::FactorKind::CROUT;
+            }
+        }
+        
+        if (!result.hasSolution) {
+            // Singular pelo critério EPSILON; um sistema inteiro é reclassificado exatamente
+            ExactSolve(coefficients, constants, result);
+            return;
+        }
+        
+        EstimateCondition(NormOne(coefficients, n, n, n, workspace.columnSums), n, result, workspace);
+        
+        // Verificar a solução; se o resíduo não passar, o refinamento iterativo
+        // com os mesmos fatores ainda pode recuperar a precisão
+        if (!VerifySolution(coefficients, constants, result.values, workspace.residual) &&
+            !RefineSolution(coefficients, constants, result, workspace)) {
+            result.hasSolution = false;
+            result.status = SolutionStatus::CALCULATION_ERROR;
+            char message[160];
+            if (result.illConditioned) {
+                std::snprintf(message, sizeof(message),
+                              "Matriz mal condicionada (κ₁ ≈ %.2e): o resíduo não passou na verificação "
+                              "nem com refinamento iterativo", result.conditionEstimate);
+            } else {
+                std::snprintf(message, sizeof(message), "O resíduo não passou na verificação");
+            }
+            result.diagnostics = message;
+        }
+        
+        if (!result.hasSolution || result.illConditioned) {
+            ExactSolve(coefficients, constants, result);
+        }
+    }
+    
+    // Adaptador para o formato vector<vector<double>>
     Solution Solve(const std::vector<std::vector<double>>& coefficients, 
                    const std::vector<double>& constants) const {
-        Solution solution;
+        Solution result;
+        SolverWorkspace workspace;
+        Solve(coefficients, constants, result, workspace);
+        return result;
+    }
+    
+    void Solve(const std::vector<std::vector<double>>& coefficients, 
+               const std::vector<double>& constants,
+               Solution& result,
+               SolverWorkspace& workspace) const {
+        Reset(result);
         
-        if (coefficients.empty() || constants.empty() || 
+        if (!IsSquare(coefficients) || constants.empty() || 
             coefficients.size() != constants.size()) {
-            solution.status = SolutionStatus::CALCULATION_ERROR;
-            return solution;
+            return;
         }
         
-        int n = static_cast<int>(coefficients.size());
+        // Sistemas pequenos não precisam sequer da cópia para DenseMatrix
+        const int n = static_cast<int>(coefficients.size());
+        if (SolveSmall(n, coefficients, constants, result, workspace)) {
+            return;
+        }
         
-        // Verificar se a matriz é quadrada
-        for (const auto& row : coefficients) {
-            if (row.size() != static_cast<size_t>(n)) {
-                solution.status = SolutionStatus::CALCULATION_ERROR;
-                return solution;
+        DenseMatrix& input = workspace.input;
+        input.Resize(n, n);
+        for (int i = 0; i < n; i++) {
+            std::copy(coefficients[i].begin(), coefficients[i].end(), input.Row(i));
+        }
+        Solve(input, constants, result, workspace);
+    }
+    
+    // Resolver um sistema esparso: Cholesky quando a matriz é simétrica com
+    // diagonal positiva, LU com pivoteamento por limiar nos demais casos
+    Solution Solve(const SparseMatrix& coefficients, 
+                   const std::vector<double>& constants) const {
+        Solution result;
+        
+        if (coefficients.Rows() == 0 || coefficients.Rows() != coefficients.Cols() ||
+            coefficients.Rows() != static_cast<int>(constants.size())) {
+            return result;
+        }
+        
+        const int n = coefficients.Rows();
+        std::vector<int> order = SparseOrdering::Compute(coefficients, sparseOrdering);
+        bool factored = false;
+        result.values = constants;
+        
+        if (IsCholeskyCandidate(coefficients)) {
+            SparseCholesky cholesky;
+            if (cholesky.Factor(coefficients, order, EPSILON)) {
+                cholesky.SolveInPlace(result.values.data());
+                factored = true;
             }
         }
         
-        // Criar matriz aumentada [A|b]
-        std::vector<std::vector<double>> augmentedMatrix(n, std::vector<double>(n + 1));
+        if (!factored) {
+            SparseLU lu;
+            if (lu.Factor(coefficients, order, pivotThreshold, EPSILON)) {
+                lu.SolveInPlace(result.values.data());
+                factored = true;
+            }
+        }
         
-        for (int i = 0; i < n; i++) {
-            for (int j = 0; j < n; j++) {
-                augmentedMatrix[i][j] = coefficients[i][j];
+        if (!factored) {
+            // Singular: a eliminação densa decide entre sem solução e infinitas
+            if (n <= SPARSE_DENSE_FALLBACK) {
+                return Solve(coefficients.ToDense(), constants);
             }
-            augmentedMatrix[i][n] = constants[i];
+            return Solution();
         }
         
-        auto result = GaussianElimination(augmentedMatrix);
+        if (VerifySolution(coefficients, constants, result.values)) {
+            result.hasSolution = true;
+            result.status = SolutionStatus::UNIQUE_SOLUTION;
+        } else {
+            result.status = SolutionStatus::CALCULATION_ERROR;
+        }
         
-        // Verificar solução se encontrada
-        if (result.hasSolution && !VerifySolution(coefficients, constants, result.values)) {
-            result.hasSolution = false;
+        return result;
+    }
+    
+    // Resolver um sistema em banda em O(n·lower·(lower + upper)) operações e
+    // O(n·(2·lower + upper + 1)) de memória; tridiagonais diagonalmente
+    // dominantes usam o algoritmo de Thomas, em O(n)
+    Solution Solve(const BandMatrix& coefficients, 
+                   const std::vector<double>& constants) const {
+        Solution result;
+        
+        if (coefficients.Size() == 0 || coefficients.Size() != static_cast<int>(constants.size())) {
+            return result;
+        }
+        
+        result.values = constants;
+        SolverWorkspace workspace;
+        if (!SolveBandInPlace(coefficients, coefficients.Size(), coefficients.Lower(), coefficients.Upper(),
+                              result, workspace)) {
+            // Singular: a eliminação densa decide entre sem solução e infinitas
+            if (coefficients.Size() <= SPARSE_DENSE_FALLBACK) {
+                return Solve(coefficients.ToDense(), constants);
+            }
+            return Solution();
+        }
+        
+        EstimateCondition(NormOne(coefficients, coefficients.Size(), coefficients.Lower(), coefficients.Upper(),
+                                  workspace.columnSums), coefficients.Size(), result, workspace);
+        
+        if (VerifySolution(coefficients, constants, result.values)) {
+            result.hasSolution = true;
+            result.status = SolutionStatus::UNIQUE_SOLUTION;
+        } else {
             result.status = SolutionStatus::CALCULATION_ERROR;
         }
         
         return result;
     }
     
-    // Método para calcular o determinante (útil para diagnósticos)
-    double CalculateDeterminant(const std::vector<std::vector<double>>& matrix) const {
-        if (matrix.empty() || matrix.size() != matrix[0].size()) {
-            return 0.0;
+    // Sistema tridiagonal com as diagonais como no dgtsv: lower[i] = a(i + 1, i)
+    // e upper[i] = a(i, i + 1), com n - 1 posições cada
+    Solution SolveTridiagonal(const std::vector<double>& lower, 
+                              const std::vector<double>& diagonal,
+                              const std::vector<double>& upper,
+                              const std::vector<double>& constants) const {
+        const int n = static_cast<int>(diagonal.size());
+        if (n == 0 || static_cast<int>(lower.size()) != n - 1 || static_cast<int>(upper.size()) != n - 1) {
+            return Solution();
+        }
+        
+        BandMatrix matrix(n, 1, 1);
+        for (int i = 0; i < n; i++) {
+            matrix(i, i) = diagonal[i];
+            if (i + 1 < n) {
+                matrix(i + 1, i) = lower[i];
+                matrix(i, i + 1) = upper[i];
+            }
+        }
+        return Solve(matrix, constants);
+    }
+    
+    // Configuração dos métodos iterativos
+    void SetIterativeOptions(const IterativeOptions& value) { iterativeOptions = value; }
+    const IterativeOptions& GetIterativeOptions() const { return iterativeOptions; }
+    
+    // Gradiente conjugado precondicionado para sistemas simétricos positivos
+    // definidos. Usa memória O(nnz); não classifica sistemas singulares:
+    // não convergência ou matriz não SPD resultam em CALCULATION_ERROR, com o
+    // motivo em diagnostics.
+    Solution SolveConjugateGradient(const SparseMatrix& coefficients, 
+                                    const std::vector<double>& constants) const {
+        return SolveIterative(coefficients, constants, IterativeMethod::CONJUGATE_GRADIENT);
+    }
+    
+    // Adaptador para matrizes densas (convertidas para CSR)
+    Solution SolveConjugateGradient(const DenseMatrix& coefficients, 
+                                    const std::vector<double>& constants) const {
+        return SolveConjugateGradient(SparseMatrix::FromDense(coefficients), constants);
+    }
+    
+    // GMRES com reinício a cada IterativeOptions::restart iterações, para
+    // sistemas não simétricos (memória O(nnz + restart·n))
+    Solution SolveGmres(const SparseMatrix& coefficients, 
+                        const std::vector<double>& constants) const {
+        return SolveIterative(coefficients, constants, IterativeMethod::GMRES);
+    }
+    
+    Solution SolveGmres(const DenseMatrix& coefficients, 
+                        const std::vector<double>& constants) const {
+        return SolveGmres(SparseMatrix::FromDense(coefficients), constants);
+    }
+    
+    // BiCGSTAB para sistemas não simétricos (memória O(nnz + n))
+    Solution SolveBiCgStab(const SparseMatrix& coefficients, 
+                           const std::vector<double>& constants) const {
+        return SolveIterative(coefficients, constants, IterativeMethod::BICGSTAB);
+    }
+    
+    Solution SolveBiCgStab(const DenseMatrix& coefficients, 
+                           const std::vector<double>& constants) const {
+        return SolveBiCgStab(SparseMatrix::FromDense(coefficients), constants);
+    }
+    
+    // Fatorar a matriz de coeficientes uma única vez para vários vetores de constantes
+    LUFactorization Factorize(const DenseMatrix& coefficients) const {
+        return LUFactorization(coefficients, blockSize, EPSILON, threadPool.get());
+    }
+    
+    // Adaptador para o formato vector<vector<double>>
+    LUFactorization Factorize(const std::vector<std::vector<double>>& coefficients) const {
+        if (!IsSquare(coefficients)) {
+            return LUFactorization();
+        }
+        return Factorize(DenseMatrix(coefficients));
+    }
+    
+    // Resolver reaproveitando uma fatoração existente: apenas substituições, O(n²)
+    // (mais O(k·n) com k correções de posto 1 acumuladas)
+    Solution Solve(const LUFactorization& factorization, 
+                   const std::vector<double>& constants) const {
+        const DenseMatrix& coefficients = factorization.Coefficients();
+        
+        if (factorization.IsSingular()) {
+            // Matriz singular: a eliminação clássica decide entre sem solução e infinitas
+            return Solve(coefficients, constants);
+        }
+        
+        Solution result;
+        const int n = factorization.Size();
+        if (static_cast<int>(constants.size()) != n) {
+            return result;
+        }
+        
+        result.values = constants;
+        factorization.SolveInPlace(result.values.data());
+        
+        // Como no caminho denso: refinamento iterativo com os mesmos fatores e,
+        // se não bastar (ou as correções acumuladas perderam precisão), o Solve
+        // completo, que ainda tenta a aritmética exata
+        std::vector<double> residual;
+        if (!RefineSolution(coefficients, constants, result, residual,
+                            [&](double* x) { factorization.SolveInPlace(x); })) {
+            return Solve(coefficients, constants);
+        }
+        result.hasSolution = true;
+        result.status = SolutionStatus::UNIQUE_SOLUTION;
+        
+        // Diagnósticos dos mesmos fatores; depois de correções de posto 1 as
+        // trocas da fatoração base já não descrevem a matriz atual
+        const DenseMatrix& factors = factorization.Factors();
+        const std::vector<int>& pivots = factorization.Pivots();
+        DeterminantProduct determinant;
+        for (int k = 0; k < n; k++) {
+            determinant.Multiply(factors(k, k));
+            if (pivots[k] != k) {
+                determinant.Negate();
+            }
+        }
+        determinant.Multiply(factorization.DeterminantScale());
+        determinant.Store(result);
+        result.rank = n;
+        if (factorization.UpdateCount() == 0) {
+            result.pivots = pivots;
+        }
+        
+        if (estimateCondition) {
+            std::vector<double> estimate;
+            std::vector<double> signs;
+            const double inverseNorm = ConditionEstimator::InverseNormOne(n,
+                [&](double* x) { factorization.SolveInPlace(x); },
+                [&](double* x) { factorization.SolveTransposeInPlace(x); },
+                estimate, signs);
+            result.conditionEstimate = NormOne(coefficients, n, n, n, estimate) * inverseNorm;
+            result.illConditioned = !(result.conditionEstimate <= ILL_CONDITIONED_THRESHOLD);
         }
         
-        int n = static_cast<int>(matrix.size());
-        auto tempMatrix = matrix; // Cópia para não modificar a original
+        if (result.illConditioned) {
+            ExactSolve(coefficients, constants, result);
+        }
+        return result;
+    }
+    
+    // Resolver um sistema guardado fora da memória: fatora a partir do último
+    // checkpoint, se preciso, e resolve e verifica lendo os painéis do arquivo.
+    // Sem a matriz na memória não há classificação de sistemas singulares:
+    // pivô nulo ou erro de E/S resultam em CALCULATION_ERROR com o motivo.
+    Solution Solve(OutOfCoreLU& store, const std::vector<double>& constants) const {
+        Solution result;
+        const int n = store.Size();
+        if (n == 0 || static_cast<int>(constants.size()) != n) {
+            return result;
+        }
         
-        double det = 1.0;
+        if (!store.IsFactored()) {
+            const OutOfCoreLU::Status status = store.Factor(threadPool.get(), EPSILON);
+            if (status == OutOfCoreLU::Status::SINGULAR) {
+                result.diagnostics = "Matriz singular: coluna " + std::to_string(store.SingularColumn() + 1) +
+                                     " sem pivô utilizável";
+                return result;
+            }
+            if (status != OutOfCoreLU::Status::SUCCESS) {
+                result.diagnostics = "Erro de leitura ou gravação nos arquivos da fatoração";
+                return result;
+            }
+        }
         
+        result.values = constants;
+        std::vector<double> product;
+        if (!store.Solve(result.values) || !store.Multiply(result.values, product)) {
+            result.values.clear();
+            result.diagnostics = "Erro de leitura nos arquivos da fatoração";
+            return result;
+        }
         for (int i = 0; i < n; i++) {
-            // Encontrar pivô
-            int pivotRow = i;
-            for (int k = i + 1; k < n; k++) {
-                if (std::abs(tempMatrix[k][i]) > std::abs(tempMatrix[pivotRow][i])) {
-                    pivotRow = k;
-                }
+            if (!(std::abs(product[i] - constants[i]) <= EPSILON * 100)) {
+                result.diagnostics = "A solução não passou na verificação do resíduo";
+                return result;
             }
-            
-            if (IsZero(tempMatrix[pivotRow][i])) {
-                return 0.0; // Determinante é zero
+        }
+        result.hasSolution = true;
+        result.status = SolutionStatus::UNIQUE_SOLUTION;
+        result.rank = n;
+        result.pivots = store.Pivots();
+        result.determinantSign = store.DeterminantSign();
+        result.logAbsDeterminant = store.LogAbsDeterminant();
+        result.determinant = store.DeterminantSign() * std::exp(store.LogAbsDeterminant());
+        return result;
+    }
+    
+    // Resolver um sistema gravado em MatrixFile: os solvers leem a matriz
+    // direto do arquivo mapeado (visão densa ou CSR), sem etapa de leitura
+    Solution Solve(const MatrixFile& file, const std::vector<double>& constants) const {
+        if (file.GetKind() == MatrixFile::Kind::SPARSE) {
+            return Solve(file.Sparse(), constants);
+        }
+        return Solve(file.Dense(), constants);
+    }
+    
+    // Idem, com as constantes gravadas no próprio arquivo
+    Solution Solve(const MatrixFile& file) const {
+        return Solve(file, file.Constants());
+    }
+    
+    // Resolver A·X = B para várias colunas de constantes com uma única fatoração
+    MultiSolution SolveMany(const DenseMatrix& coefficients, 
+                            const DenseMatrix& constants) const {
+        MultiSolution result;
+        
+        if (coefficients.Empty() || constants.Empty() || 
+            coefficients.Rows() != coefficients.Cols() ||
+            constants.Rows() != coefficients.Rows()) {
+            return result;
+        }
+        
+        LUFactorization factorization = Factorize(coefficients);
+        const int n = constants.Rows();
+        result.values = constants;
+        
+        // Fatoração compartilhada: basta se o κ₁ dos fatores estiver abaixo do
+        // limite e todas as colunas passarem na verificação
+        bool illConditioned = false;
+        if (!factorization.IsSingular()) {
+            factorization.SolveInPlace(result.values, threadPool.get());
+            if (estimateCondition) {
+                std::vector<double> estimate;
+                std::vector<double> signs;
+                const double inverseNorm = ConditionEstimator::InverseNormOne(n,
+                    [&](double* x) { factorization.SolveInPlace(x); },
+                    [&](double* x) { factorization.SolveTransposeInPlace(x); },
+                    estimate, signs);
+                illConditioned = !(NormOne(coefficients, n, n, n, estimate) * inverseNorm <= ILL_CONDITIONED_THRESHOLD);
             }
-            
-            if (pivotRow != i) {
-                std::swap(tempMatrix[i], tempMatrix[pivotRow]);
-                det *= -1.0; // Troca de linha muda o sinal do determinante
+            if (!illConditioned && VerifySolutions(coefficients, constants, result.values)) {
+                result.hasSolution = true;
+                result.status = SolutionStatus::UNIQUE_SOLUTION;
+                return result;
+            }
+        }
+        
+        // Coluna a coluna: com pivô abaixo de EPSILON ou resíduo reprovado, o
+        // caminho denso completo (refinamento e aritmética exata); mal
+        // condicionada, as colunas inteiras vão direto para a eliminação exata.
+        // Uma coluna inconsistente torna o bloco sem solução; o bloco só tem
+        // solução se todas as colunas tiverem solução única.
+        std::vector<double> column(n);
+        std::vector<double> values(n);
+        Solution solution;
+        result.status = SolutionStatus::UNIQUE_SOLUTION;
+        for (int c = 0; c < constants.Cols(); c++) {
+            for (int i = 0; i < n; i++) {
+                column[i] = constants(i, c);
+                values[i] = result.values(i, c);
+            }
+            if (factorization.IsSingular()) {
+                solution = Solve(coefficients, column);
+            } else if (illConditioned && ExactSolve(coefficients, column, solution)) {
+                // Decidido pela eliminação exata
+            } else if (VerifySolution(coefficients, column, values)) {
+                continue;
+            } else {
+                solution = Solve(coefficients, column);
             }
             
-            det *= tempMatrix[i][i];
-            
-            // Eliminação
-            for (int k = i + 1; k < n; k++) {
-                double factor = tempMatrix[k][i] / tempMatrix[i][i];
-                for (int j = i; j < n; j++) {
-                    tempMatrix[k][j] -= factor * tempMatrix[i][j];
+            if (solution.status == SolutionStatus::NO_SOLUTION) {
+                result.status = SolutionStatus::NO_SOLUTION;
+                return result;
+            }
+            if (!solution.hasSolution) {
+                if (result.status == SolutionStatus::UNIQUE_SOLUTION) {
+                    result.status = solution.status;
                 }
+                continue;
             }
+            for (int i = 0; i < n; i++) {
+                result.values(i, c) = solution.values[i];
+            }
+        }
+        result.hasSolution = result.status == SolutionStatus::UNIQUE_SOLUTION;
+        
+        return result;
+    }
+    
+    // Adaptador para o formato vector<vector<double>> (constantes com n linhas e k colunas)
+    MultiSolution SolveMany(const std::vector<std::vector<double>>& coefficients, 
+                            const std::vector<std::vector<double>>& constants) const {
+        if (!IsSquare(coefficients) || coefficients.size() != constants.size()) {
+            return MultiSolution();
+        }
+        for (const auto& row : constants) {
+            if (row.empty() || row.size() != constants[0].size()) {
+                return MultiSolution();
+            }
+        }
+        
+        return SolveMany(DenseMatrix(coefficients), DenseMatrix(constants));
+    }
+    
+    // Determinante por uma LU em blocos. Quem já resolveu o sistema denso tem o
+    // mesmo valor (e o log|det|, sem estouro) em Solution::determinant.
+    double CalculateDeterminant(const DenseMatrix& matrix) const {
+        if (matrix.Empty() || matrix.Rows() != matrix.Cols()) {
+            return 0.0;
         }
         
-        return det;
+        DenseMatrix lu = matrix; // Cópia para não modificar a original
+        std::vector<int> pivots;
+        if (BlockedLU<double>::Factor(lu, pivots, blockSize, EPSILON, threadPool.get()) != -1) {
+            return 0.0; // Determinante é zero
+        }
+        
+        Solution diagnostics;
+        StoreLUDiagnostics(lu, pivots, diagnostics);
+        return diagnostics.determinant;
+    }
+    
+    // Adaptador para o formato vector<vector<double>>
+    double CalculateDeterminant(const std::vector<std::vector<double>>& matrix) const {
+        if (matrix.empty() || matrix.size() != matrix[0].size()) {
+            return 0.0;
+        }
+        
+        return CalculateDeterminant(DenseMatrix(matrix));
     }
 };
-
-
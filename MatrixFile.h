@@ -0,0 +1,463 @@
+#pragma once
+#include <vector>
+#include <string>
+#include <fstream>
+#include <filesystem>
+#include <memory>
+#include <limits>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <algorithm>
+#ifdef _WIN32
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+#include "DenseMatrix.h"
+#include "SparseMatrix.h"
+#include "SimdKernels.h"
+
+// Formato binário de matriz para sistemas grandes, lido por mapeamento em
+// memória (mmap / MapViewOfFile). Um cabeçalho fixo de 128 bytes guarda a
+// assinatura, a marca de ordem dos bytes, a versão, o tipo (densa ou CSR), as
+// dimensões e a posição de cada seção; as seções começam em múltiplos de 64
+// bytes, então Dense() e Sparse() devolvem visões direto sobre o arquivo, sem
+// cópia, que o LinearSolver usa como qualquer outra matriz.
+//
+// Open() lê só o cabeçalho e custa o mesmo para qualquer tamanho de arquivo;
+// Verify() percorre os dados, confere o checksum e a estrutura CSR. O
+// mapeamento é privado (copy-on-write): escrever em uma visão não altera o
+// arquivo. As visões mantêm o mapeamento vivo mesmo depois de Close().
+//
+// Seções: densa = linhas com stride DenseMatrix::StrideFor(cols); CSR =
+// ponteiros de linha (int64), índices de coluna (int32) e valores; e, em
+// ambos, as constantes opcionais. Os bytes de preenchimento são zero.
+class MatrixFile {
+public:
+    static constexpr std::uint32_t VERSION = 1;
+    static constexpr std::uint64_t ALIGNMENT = 64;
+
+    enum class Kind {
+        NONE = 0,
+        DENSE = 1,
+        SPARSE = 2
+    };
+
+    enum class Status {
+        SUCCESS,
+        IO_ERROR,            // Falha ao abrir, mapear ou gravar o arquivo
+        INVALID_FORMAT,      // Assinatura, dimensões ou seções inconsistentes
+        WRONG_ENDIANNESS,    // Gravado em uma máquina com outra ordem de bytes
+        UNSUPPORTED_VERSION, // Versão mais nova que VERSION
+        CHECKSUM_MISMATCH    // Cabeçalho ou dados corrompidos
+    };
+
+private:
+    static constexpr char MAGIC[8] = {'C', 'A', 'L', 'C', 'M', 'A', 'T', 'B'};
+    static constexpr std::uint32_t ENDIANNESS_MARK = 0x01020304u;
+    static constexpr std::uint32_t HAS_CONSTANTS = 1u;
+    static constexpr std::size_t CHECKSUM_CHUNK = std::size_t(1) << 16; // doubles por bloco
+    static constexpr std::uint64_t CHECKSUM_SEED = 0x43414C434D415442ull;
+
+    struct Header {
+        char magic[8];
+        std::uint32_t endianness;
+        std::uint32_t version;
+        std::uint32_t kind;
+        std::uint32_t flags;
+        std::int64_t rows;
+        std::int64_t cols;
+        std::int64_t nonZeros;
+        std::int64_t stride;
+        std::uint64_t valuesOffset;
+        std::uint64_t pointersOffset;  // Só CSR
+        std::uint64_t indicesOffset;   // Só CSR
+        std::uint64_t constantsOffset; // 0 sem constantes
+        std::uint64_t fileSize;
+        std::uint64_t payloadChecksum; // Dos bytes depois do cabeçalho
+        std::uint64_t reserved[2];
+        std::uint64_t headerChecksum;  // Dos 120 bytes anteriores
+    };
+    static_assert(sizeof(Header) == 128, "O cabeçalho tem tamanho fixo");
+
+    // Arquivo inteiro mapeado como cópia privada
+    class Mapping {
+    private:
+        unsigned char* address = nullptr;
+        std::uint64_t length = 0;
+
+    public:
+        Mapping() = default;
+        Mapping(const Mapping&) = delete;
+        Mapping& operator=(const Mapping&) = delete;
+
+        ~Mapping() {
+            if (!address) {
+                return;
+            }
+#ifdef _WIN32
+            UnmapViewOfFile(address);
+#else
+            munmap(address, static_cast<std::size_t>(length));
+#endif
+        }
+
+        bool Open(const std::filesystem::path& path) {
+#ifdef _WIN32
+            // Caminho em UTF-16 (path::value_type é wchar_t): nomes fora do ASCII funcionam
+            HANDLE file = CreateFileW(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr,
+                                      OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+            if (file == INVALID_HANDLE_VALUE) {
+                return false;
+            }
+            LARGE_INTEGER size;
+            HANDLE mapping = nullptr;
+            if (GetFileSizeEx(file, &size) && size.QuadPart > 0) {
+                mapping = CreateFileMappingW(file, nullptr, PAGE_WRITECOPY, 0, 0, nullptr);
+            }
+            if (mapping) {
+                address = static_cast<unsigned char*>(MapViewOfFile(mapping, FILE_MAP_COPY, 0, 0, 0));
+                length = static_cast<std::uint64_t>(size.QuadPart);
+                CloseHandle(mapping); // A visão mantém o mapeamento
+            }
+            CloseHandle(file);
+#else
+            const int file = open(path.c_str(), O_RDONLY);
+            if (file < 0) {
+                return false;
+            }
+            struct stat info;
+            if (fstat(file, &info) == 0 && info.st_size > 0) {
+                void* result = mmap(nullptr, static_cast<std::size_t>(info.st_size),
+                                    PROT_READ | PROT_WRITE, MAP_PRIVATE, file, 0);
+                if (result != MAP_FAILED) {
+                    address = static_cast<unsigned char*>(result);
+                    length = static_cast<std::uint64_t>(info.st_size);
+                }
+            }
+            close(file);
+#endif
+            return address != nullptr;
+        }
+
+        unsigned char* Bytes() const { return address; }
+        std::uint64_t Length() const { return length; }
+    };
+
+    // Gravação sequencial com o checksum calculado em blocos de
+    // CHECKSUM_CHUNK doubles, os mesmos que Verify() usa na leitura
+    class PayloadWriter {
+    private:
+        std::ofstream& file;
+        std::vector<unsigned char> buffer;
+        std::uint64_t position = sizeof(Header);
+        std::uint64_t checksum = CHECKSUM_SEED;
+
+        void Drain() {
+            if (buffer.empty()) {
+                return;
+            }
+            checksum = SimdHash(reinterpret_cast<const double*>(buffer.data()),
+                                static_cast<int>(buffer.size() / sizeof(double)), checksum);
+            file.write(reinterpret_cast<const char*>(buffer.data()), static_cast<std::streamsize>(buffer.size()));
+            buffer.clear();
+        }
+
+    public:
+        explicit PayloadWriter(std::ofstream& file) : file(file) {
+            buffer.reserve(CHECKSUM_CHUNK * sizeof(double));
+        }
+
+        void Append(const void* source, std::size_t bytes) {
+            const unsigned char* input = static_cast<const unsigned char*>(source);
+            while (bytes > 0) {
+                const std::size_t count = std::min(bytes, CHECKSUM_CHUNK * sizeof(double) - buffer.size());
+                buffer.insert(buffer.end(), input, input + count);
+                input += count;
+                bytes -= count;
+                position += count;
+                if (buffer.size() == CHECKSUM_CHUNK * sizeof(double)) {
+                    Drain();
+                }
+            }
+        }
+
+        // Completar com zeros até o próximo múltiplo de ALIGNMENT
+        void Pad() {
+            static const unsigned char zeros[ALIGNMENT] = {};
+            const std::uint64_t remainder = position % ALIGNMENT;
+            if (remainder != 0) {
+                Append(zeros, static_cast<std::size_t>(ALIGNMENT - remainder));
+            }
+        }
+
+        std::uint64_t Position() const { return position; }
+
+        std::uint64_t Finish() {
+            Drain();
+            return checksum;
+        }
+    };
+
+    std::shared_ptr<Mapping> mapping;
+    Header header = {};
+
+    static std::uint64_t HeaderChecksum(const Header& value) {
+        return SimdHash(reinterpret_cast<const double*>(&value),
+                        static_cast<int>(offsetof(Header, headerChecksum) / sizeof(double)), CHECKSUM_SEED);
+    }
+
+    static Header NewHeader(Kind kind, int rows, int cols, std::int64_t nonZeros, bool hasConstants) {
+        Header result = {};
+        std::memcpy(result.magic, MAGIC, sizeof(MAGIC));
+        result.endianness = ENDIANNESS_MARK;
+        result.version = VERSION;
+        result.kind = static_cast<std::uint32_t>(kind);
+        result.flags = hasConstants ? HAS_CONSTANTS : 0u;
+        result.rows = rows;
+        result.cols = cols;
+        result.nonZeros = nonZeros;
+        return result;
+    }
+
+    static Status Finish(std::ofstream& file, PayloadWriter& writer, Header& result) {
+        result.fileSize = writer.Position();
+        result.payloadChecksum = writer.Finish();
+        result.headerChecksum = HeaderChecksum(result);
+        file.seekp(0);
+        file.write(reinterpret_cast<const char*>(&result), sizeof(result));
+        file.close();
+        return file.fail() ? Status::IO_ERROR : Status::SUCCESS;
+    }
+
+    static void AppendConstants(PayloadWriter& writer, Header& result, const std::vector<double>& constants) {
+        if (!constants.empty()) {
+            result.constantsOffset = writer.Position();
+            writer.Append(constants.data(), constants.size() * sizeof(double));
+            writer.Pad();
+        }
+    }
+
+    // A seção [offset, offset + bytes) está alinhada e dentro do arquivo
+    bool SectionFits(std::uint64_t offset, std::uint64_t bytes) const {
+        return offset >= sizeof(Header) && offset % ALIGNMENT == 0 &&
+               offset <= header.fileSize && bytes <= header.fileSize - offset;
+    }
+
+    Status CheckHeader() const {
+        if (header.kind != static_cast<std::uint32_t>(Kind::DENSE) &&
+            header.kind != static_cast<std::uint32_t>(Kind::SPARSE)) {
+            return Status::INVALID_FORMAT;
+        }
+        const std::int64_t limit = std::numeric_limits<int>::max();
+        if (header.rows < 0 || header.rows > limit || header.cols < 0 || header.cols > limit ||
+            header.fileSize != mapping->Length() || header.fileSize % ALIGNMENT != 0) {
+            return Status::INVALID_FORMAT;
+        }
+        const std::uint64_t rows = static_cast<std::uint64_t>(header.rows);
+        if ((header.flags & HAS_CONSTANTS) && !SectionFits(header.constantsOffset, rows * sizeof(double))) {
+            return Status::INVALID_FORMAT;
+        }
+        if (GetKind() == Kind::DENSE) {
+            const std::uint64_t stride = static_cast<std::uint64_t>(DenseMatrix::StrideFor(static_cast<int>(header.cols)));
+            if (header.stride != static_cast<std::int64_t>(stride) ||
+                !SectionFits(header.valuesOffset, rows * stride * sizeof(double))) {
+                return Status::INVALID_FORMAT;
+            }
+            return Status::SUCCESS;
+        }
+        const std::uint64_t nonZeros = static_cast<std::uint64_t>(header.nonZeros);
+        if (header.nonZeros < 0 ||
+            !SectionFits(header.pointersOffset, (rows + 1) * sizeof(std::int64_t)) ||
+            !SectionFits(header.indicesOffset, nonZeros * sizeof(int)) ||
+            !SectionFits(header.valuesOffset, nonZeros * sizeof(double))) {
+            return Status::INVALID_FORMAT;
+        }
+        const std::int64_t* pointers = reinterpret_cast<const std::int64_t*>(mapping->Bytes() + header.pointersOffset);
+        if (pointers[0] != 0 || pointers[header.rows] != header.nonZeros) {
+            return Status::INVALID_FORMAT;
+        }
+        return Status::SUCCESS;
+    }
+
+public:
+    // Gravar uma matriz densa (e, se houver, as constantes do sistema)
+    static Status Write(const std::filesystem::path& path, const DenseMatrix& matrix,
+                        const std::vector<double>& constants = {}) {
+        if (!constants.empty() && static_cast<int>(constants.size()) != matrix.Rows()) {
+            return Status::INVALID_FORMAT;
+        }
+        std::ofstream file(path, std::ios::binary | std::ios::trunc);
+        if (!file) {
+            return Status::IO_ERROR;
+        }
+        Header result = NewHeader(Kind::DENSE, matrix.Rows(), matrix.Cols(),
+                                  static_cast<std::int64_t>(matrix.Rows()) * matrix.Cols(), !constants.empty());
+        const int stride = DenseMatrix::StrideFor(matrix.Cols());
+        result.stride = stride;
+        file.write(reinterpret_cast<const char*>(&result), sizeof(result));
+
+        PayloadWriter writer(file);
+        result.valuesOffset = writer.Position();
+        const std::vector<double> padding(static_cast<std::size_t>(stride - matrix.Cols()), 0.0);
+        for (int i = 0; i < matrix.Rows(); i++) {
+            writer.Append(matrix.Row(i), static_cast<std::size_t>(matrix.Cols()) * sizeof(double));
+            writer.Append(padding.data(), padding.size() * sizeof(double));
+        }
+        writer.Pad();
+        AppendConstants(writer, result, constants);
+        return Finish(file, writer, result);
+    }
+
+    // Gravar uma matriz CSR (e, se houver, as constantes do sistema)
+    static Status Write(const std::filesystem::path& path, const SparseMatrix& matrix,
+                        const std::vector<double>& constants = {}) {
+        if (!constants.empty() && static_cast<int>(constants.size()) != matrix.Rows()) {
+            return Status::INVALID_FORMAT;
+        }
+        std::ofstream file(path, std::ios::binary | std::ios::trunc);
+        if (!file) {
+            return Status::IO_ERROR;
+        }
+        Header result = NewHeader(Kind::SPARSE, matrix.Rows(), matrix.Cols(), matrix.NonZeros(), !constants.empty());
+        file.write(reinterpret_cast<const char*>(&result), sizeof(result));
+
+        const auto rowPointers = matrix.RowPointers();
+        const auto columnIndices = matrix.ColumnIndices();
+        const auto values = matrix.Values();
+        PayloadWriter writer(file);
+        result.pointersOffset = writer.Position();
+        writer.Append(rowPointers.data(), rowPointers.size() * sizeof(std::int64_t));
+        writer.Pad();
+        result.indicesOffset = writer.Position();
+        writer.Append(columnIndices.data(), columnIndices.size() * sizeof(int));
+        writer.Pad();
+        result.valuesOffset = writer.Position();
+        writer.Append(values.data(), values.size() * sizeof(double));
+        writer.Pad();
+        AppendConstants(writer, result, constants);
+        return Finish(file, writer, result);
+    }
+
+    // Mapear o arquivo e validar o cabeçalho, em tempo constante
+    Status Open(const std::filesystem::path& path) {
+        Close();
+        auto opened = std::make_shared<Mapping>();
+        if (!opened->Open(path)) {
+            return Status::IO_ERROR;
+        }
+        if (opened->Length() < sizeof(Header)) {
+            return Status::INVALID_FORMAT;
+        }
+        Header candidate;
+        std::memcpy(&candidate, opened->Bytes(), sizeof(candidate));
+        if (std::memcmp(candidate.magic, MAGIC, sizeof(MAGIC)) != 0) {
+            return Status::INVALID_FORMAT;
+        }
+        if (candidate.endianness != ENDIANNESS_MARK) {
+            return candidate.endianness == 0x04030201u ? Status::WRONG_ENDIANNESS : Status::INVALID_FORMAT;
+        }
+        if (candidate.version > VERSION) {
+            return Status::UNSUPPORTED_VERSION;
+        }
+        if (candidate.headerChecksum != HeaderChecksum(candidate)) {
+            return Status::CHECKSUM_MISMATCH;
+        }
+
+        mapping = std::move(opened);
+        header = candidate;
+        const Status status = CheckHeader();
+        if (status != Status::SUCCESS) {
+            Close();
+        }
+        return status;
+    }
+
+    // Conferir o checksum de todos os dados e, para CSR, a ordem dos índices.
+    // Lê o arquivo inteiro: O(tamanho)
+    Status Verify() const {
+        if (!IsOpen()) {
+            return Status::IO_ERROR;
+        }
+        const unsigned char* payload = mapping->Bytes() + sizeof(Header);
+        const std::uint64_t count = (header.fileSize - sizeof(Header)) / sizeof(double);
+        std::uint64_t checksum = CHECKSUM_SEED;
+        for (std::uint64_t begin = 0; begin < count; begin += CHECKSUM_CHUNK) {
+            const std::uint64_t chunk = std::min<std::uint64_t>(CHECKSUM_CHUNK, count - begin);
+            checksum = SimdHash(reinterpret_cast<const double*>(payload) + begin, static_cast<int>(chunk), checksum);
+        }
+        if (checksum != header.payloadChecksum) {
+            return Status::CHECKSUM_MISMATCH;
+        }
+
+        if (GetKind() == Kind::SPARSE) {
+            const SparseMatrix matrix = Sparse();
+            const auto rowPointers = matrix.RowPointers();
+            const auto columnIndices = matrix.ColumnIndices();
+            for (int i = 0; i < matrix.Rows(); i++) {
+                if (rowPointers[i + 1] < rowPointers[i]) {
+                    return Status::INVALID_FORMAT;
+                }
+                for (std::int64_t p = rowPointers[i]; p < rowPointers[i + 1]; p++) {
+                    const int column = columnIndices[p];
+                    if (column < 0 || column >= matrix.Cols() ||
+                        (p > rowPointers[i] && column <= columnIndices[p - 1])) {
+                        return Status::INVALID_FORMAT;
+                    }
+                }
+            }
+        }
+        return Status::SUCCESS;
+    }
+
+    void Close() {
+        mapping.reset();
+        header = Header();
+    }
+
+    bool IsOpen() const { return mapping != nullptr; }
+    Kind GetKind() const { return IsOpen() ? static_cast<Kind>(header.kind) : Kind::NONE; }
+    int Rows() const { return static_cast<int>(header.rows); }
+    int Cols() const { return static_cast<int>(header.cols); }
+    std::int64_t NonZeros() const { return header.nonZeros; }
+    std::uint64_t FileBytes() const { return header.fileSize; }
+    bool HasConstants() const { return IsOpen() && (header.flags & HAS_CONSTANTS) != 0; }
+
+    // Visão densa sobre o arquivo (vazia se o arquivo não for denso)
+    DenseMatrix Dense() const {
+        if (GetKind() != Kind::DENSE) {
+            return DenseMatrix();
+        }
+        double* values = reinterpret_cast<double*>(mapping->Bytes() + header.valuesOffset);
+        return DenseMatrix::View(values, Rows(), Cols(), mapping);
+    }
+
+    // Visão CSR sobre o arquivo (vazia se o arquivo não for CSR)
+    SparseMatrix Sparse() const {
+        if (GetKind() != Kind::SPARSE) {
+            return SparseMatrix();
+        }
+        const unsigned char* bytes = mapping->Bytes();
+        return SparseMatrix::View(Rows(), Cols(),
+                                  reinterpret_cast<const std::int64_t*>(bytes + header.pointersOffset),
+                                  reinterpret_cast<const int*>(bytes + header.indicesOffset),
+                                  reinterpret_cast<const double*>(bytes + header.valuesOffset),
+                                  mapping);
+    }
+
+    // Constantes gravadas com a matriz (vazio se não houver)
+    std::vector<double> Constants() const {
+        if (!HasConstants()) {
+            return std::vector<double>();
+        }
+        const double* begin = reinterpret_cast<const double*>(mapping->Bytes() + header.constantsOffset);
+        return std::vector<double>(begin, begin + Rows());
+    }
+};
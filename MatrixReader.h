@@ -0,0 +1,669 @@
+#pragma once
+#include <vector>
+#include <string>
+#include <fstream>
+#include <filesystem>
+#include <limits>
+#include <cctype>
+#include <cstdint>
+#include <cstring>
+#include <algorithm>
+#include "DenseMatrix.h"
+#include "SparseMatrix.h"
+#include "ThreadPool.h"
+#include "NumberParser.h"
+
+// Leitura de matrizes em texto: Matrix Market (.mtx, coordinate e array) e
+// CSV/TSV. O arquivo vai inteiro para a memória e é dividido em partes de pelo
+// menos MIN_CHUNK_BYTES, sempre em fim de linha. Uma primeira passada paralela
+// conta as linhas e as entradas de cada parte, o que dá a linha inicial e a
+// posição de saída de cada uma; a segunda converte os números com
+// std::from_chars e escreve direto na matriz densa ou nos arrays do CSR.
+//
+// Um token inválido para a leitura: Result traz o status, a linha e a coluna
+// (em caracteres, a partir de 1) do primeiro erro do arquivo e uma mensagem.
+class MatrixReader {
+public:
+    static constexpr std::size_t MIN_CHUNK_BYTES = std::size_t(1) << 20;
+
+    enum class Status {
+        SUCCESS,
+        IO_ERROR,            // Arquivo não encontrado ou ilegível
+        INVALID_HEADER,      // Cabeçalho ou linha de tamanho do .mtx inválidos
+        UNSUPPORTED,         // Matriz complexa ou hermitiana
+        MALFORMED_TOKEN,     // Texto que não é um número válido
+        WRONG_FIELD_COUNT,   // Linha com número de campos diferente da primeira
+        INDEX_OUT_OF_RANGE,  // Coordenada fora das dimensões declaradas
+        WRONG_ENTRY_COUNT    // Mais ou menos entradas que as declaradas
+    };
+
+    struct Result {
+        Status status = Status::IO_ERROR;
+        bool isSparse = false;  // Coordinate vira CSR; array e CSV, matriz densa
+        DenseMatrix dense;
+        SparseMatrix sparse;
+        long long line = 0;     // Posição do primeiro erro (a partir de 1)
+        int column = 0;
+        std::string message;
+    };
+
+private:
+    struct Error {
+        Status status = Status::SUCCESS;
+        long long line = 0;
+        int column = 0;
+        std::string message;
+    };
+
+    // Parte do texto que começa no início de uma linha
+    struct Chunk {
+        const char* begin;
+        const char* end;
+        long long firstLine = 1;
+        long long items = 0;    // Linhas de dados (ou entradas) na parte
+        long long offset = 0;   // Índice da primeira entrada da parte
+        Error error;
+    };
+
+    struct Entry {
+        int column;
+        double value;
+    };
+
+    static bool Fail(Error& error, Status status, long long line, int column, std::string message) {
+        error.status = status;
+        error.line = line;
+        error.column = column;
+        error.message = std::move(message);
+        return false;
+    }
+
+    static Result Failure(const Error& error) {
+        Result result;
+        result.status = error.status;
+        result.line = error.line;
+        result.column = error.column;
+        result.message = error.message;
+        return result;
+    }
+
+    static bool IsBlank(char c) { return c == ' ' || c == '\t' || c == '\r'; }
+
+    static const char* SkipBlanks(const char* p, const char* end) {
+        while (p < end && IsBlank(*p)) {
+            p++;
+        }
+        return p;
+    }
+
+    static bool IsBlankLine(const char* begin, const char* end) {
+        return SkipBlanks(begin, end) == end;
+    }
+
+    static const char* LineEnd(const char* p, const char* end) {
+        if (p >= end) {
+            return end;
+        }
+        const void* found = std::memchr(p, '\n', static_cast<std::size_t>(end - p));
+        return found ? static_cast<const char*>(found) : end;
+    }
+
+    // Dividir [begin, end) em partes terminadas em '\n'
+    static std::vector<Chunk> Split(const char* begin, const char* end, ThreadPool* pool) {
+        const std::size_t bytes = static_cast<std::size_t>(end - begin);
+        std::size_t count = 1;
+        if (pool) {
+            count = std::max<std::size_t>(1, std::min<std::size_t>(pool->ThreadCount() * 4, bytes / MIN_CHUNK_BYTES));
+        }
+        std::vector<Chunk> chunks;
+        const char* start = begin;
+        for (std::size_t k = 1; k <= count && start < end; k++) {
+            const char* stop = end;
+            if (k < count) {
+                stop = std::max(start, begin + bytes / count * k);
+                stop = LineEnd(stop, end);
+                stop = stop < end ? stop + 1 : end;
+            }
+            if (stop > start) {
+                Chunk chunk;
+                chunk.begin = start;
+                chunk.end = stop;
+                chunks.push_back(chunk);
+                start = stop;
+            }
+        }
+        return chunks;
+    }
+
+    // Contar em paralelo as linhas de dados de cada parte (isData decide) e
+    // preencher a linha inicial e o índice da primeira entrada
+    template <typename IsData>
+    static long long Count(std::vector<Chunk>& chunks, long long firstLine, ThreadPool* pool, IsData isData) {
+        std::vector<long long> newlines(chunks.size(), 0);
+        ParallelFor(pool, 0, static_cast<int>(chunks.size()), 1, [&](int first, int last) {
+            for (int c = first; c < last; c++) {
+                Chunk& chunk = chunks[c];
+                for (const char* p = chunk.begin; p < chunk.end;) {
+                    const char* stop = LineEnd(p, chunk.end);
+                    if (isData(p, stop)) {
+                        chunk.items++;
+                    }
+                    if (stop < chunk.end) {
+                        newlines[c]++;
+                    }
+                    p = stop + 1;
+                }
+            }
+        });
+        long long line = firstLine;
+        long long offset = 0;
+        for (std::size_t c = 0; c < chunks.size(); c++) {
+            chunks[c].firstLine = line;
+            chunks[c].offset = offset;
+            line += newlines[c];
+            offset += chunks[c].items;
+        }
+        return offset;
+    }
+
+    // Primeiro erro do arquivo: as partes estão em ordem
+    static const Error* FirstError(const std::vector<Chunk>& chunks) {
+        for (const Chunk& chunk : chunks) {
+            if (chunk.error.status != Status::SUCCESS) {
+                return &chunk.error;
+            }
+        }
+        return nullptr;
+    }
+
+    static bool NextToken(const char*& p, const char* end, const char*& tokenBegin, const char*& tokenEnd) {
+        p = SkipBlanks(p, end);
+        if (p == end) {
+            return false;
+        }
+        tokenBegin = p;
+        while (p < end && !IsBlank(*p)) {
+            p++;
+        }
+        tokenEnd = p;
+        return true;
+    }
+
+    static int Column(const char* lineBegin, const char* token) {
+        return static_cast<int>(token - lineBegin) + 1;
+    }
+
+    static std::string Token(const char* begin, const char* end) {
+        return std::string(begin, std::min(end, begin + 32));
+    }
+
+    static std::string Lower(std::string text) {
+        std::transform(text.begin(), text.end(), text.begin(),
+                       [](unsigned char c) { return static_cast<char>(std::tolower(c)); });
+        return text;
+    }
+
+    // Montar o CSR a partir das coordenadas (0-based), somando repetidas.
+    // A contagem e a distribuição por linha são sequenciais (O(nnz)); a
+    // ordenação e a compactação de cada linha, paralelas
+    static SparseMatrix BuildCsr(int rows, int cols, const std::vector<int>& entryRows,
+                                 const std::vector<Entry>& entries, ThreadPool* pool) {
+        std::vector<std::int64_t> rowPointers(static_cast<std::size_t>(rows) + 1, 0);
+        for (int row : entryRows) {
+            rowPointers[row + 1]++;
+        }
+        for (int i = 0; i < rows; i++) {
+            rowPointers[i + 1] += rowPointers[i];
+        }
+        std::vector<Entry> sorted(entries.size());
+        std::vector<std::int64_t> next(rowPointers.begin(), rowPointers.end() - 1);
+        for (std::size_t k = 0; k < entries.size(); k++) {
+            sorted[next[entryRows[k]]++] = entries[k];
+        }
+
+        std::vector<std::int64_t> unique(static_cast<std::size_t>(rows) + 1, 0);
+        ParallelFor(pool, 0, rows, 256, [&](int first, int last) {
+            for (int i = first; i < last; i++) {
+                Entry* begin = sorted.data() + rowPointers[i];
+                Entry* end = sorted.data() + rowPointers[i + 1];
+                std::sort(begin, end, [](const Entry& a, const Entry& b) { return a.column < b.column; });
+                Entry* out = begin;
+                for (Entry* p = begin; p < end; p++) {
+                    if (out > begin && (out - 1)->column == p->column) {
+                        (out - 1)->value += p->value;
+                    } else {
+                        *out++ = *p;
+                    }
+                }
+                unique[i + 1] = out - begin;
+            }
+        });
+        for (int i = 0; i < rows; i++) {
+            unique[i + 1] += unique[i];
+        }
+
+        std::vector<int> columnIndices(static_cast<std::size_t>(unique[rows]));
+        std::vector<double> values(columnIndices.size());
+        ParallelFor(pool, 0, rows, 256, [&](int first, int last) {
+            for (int i = first; i < last; i++) {
+                const Entry* source = sorted.data() + rowPointers[i];
+                for (std::int64_t q = unique[i]; q < unique[i + 1]; q++, source++) {
+                    columnIndices[q] = source->column;
+                    values[q] = source->value;
+                }
+            }
+        });
+        return SparseMatrix(rows, cols, std::move(unique), std::move(columnIndices), std::move(values));
+    }
+
+public:
+    static bool ReadFile(const std::filesystem::path& path, std::string& text) {
+        std::ifstream file(path, std::ios::binary | std::ios::ate);
+        if (!file) {
+            return false;
+        }
+        const std::streamsize size = file.tellg();
+        if (size < 0) {
+            return false;
+        }
+        text.resize(static_cast<std::size_t>(size));
+        file.seekg(0);
+        return static_cast<bool>(file.read(&text[0], size)) || size == 0;
+    }
+
+    // Matrix Market em memória: "coordinate" gera CSR e "array", matriz densa.
+    // Campos real, double, integer e pattern; simetrias general, symmetric e
+    // skew-symmetric (a metade omitida é preenchida)
+    static Result ParseMatrixMarket(const std::string& text, ThreadPool* pool = nullptr) {
+        Error error;
+        const char* p = text.data();
+        const char* end = p + text.size();
+
+        // Cabeçalho: %%MatrixMarket matrix <formato> <campo> <simetria>
+        const char* lineEnd = LineEnd(p, end);
+        std::vector<std::string> words;
+        const char* tokenBegin;
+        const char* tokenEnd;
+        for (const char* q = p; NextToken(q, lineEnd, tokenBegin, tokenEnd);) {
+            words.push_back(Lower(std::string(tokenBegin, tokenEnd)));
+        }
+        if (words.size() != 5 || words[0] != "%%matrixmarket" || words[1] != "matrix") {
+            Fail(error, Status::INVALID_HEADER, 1, 1,
+                 "Cabeçalho esperado: %%MatrixMarket matrix <formato> <campo> <simetria>");
+            return Failure(error);
+        }
+        const bool coordinate = words[2] == "coordinate";
+        const std::string& field = words[3];
+        const std::string& symmetry = words[4];
+        if (field == "complex" || symmetry == "hermitian") {
+            Fail(error, Status::UNSUPPORTED, 1, 1, "Matrizes complexas não são suportadas");
+            return Failure(error);
+        }
+        const bool pattern = field == "pattern";
+        if ((!coordinate && words[2] != "array") ||
+            (field != "real" && field != "double" && field != "integer" && !pattern) ||
+            (pattern && !coordinate) ||
+            (symmetry != "general" && symmetry != "symmetric" && symmetry != "skew-symmetric")) {
+            Fail(error, Status::INVALID_HEADER, 1, 1, "Formato, campo ou simetria desconhecidos no cabeçalho");
+            return Failure(error);
+        }
+        const bool symmetric = symmetry != "general";
+        const double mirrorSign = symmetry == "skew-symmetric" ? -1.0 : 1.0;
+
+        // Comentários e a linha de tamanho: linhas colunas [entradas]
+        long long line = 1;
+        p = lineEnd < end ? lineEnd + 1 : end;
+        for (; p < end; line++) {
+            lineEnd = LineEnd(p, end);
+            if (!IsBlankLine(p, lineEnd) && *SkipBlanks(p, lineEnd) != '%') {
+                break;
+            }
+            p = lineEnd < end ? lineEnd + 1 : end;
+        }
+        line++;
+        lineEnd = LineEnd(p, end);
+        long long sizes[3] = {0, 0, 0};
+        const int expectedSizes = coordinate ? 3 : 2;
+        int found = 0;
+        for (const char* q = p; NextToken(q, lineEnd, tokenBegin, tokenEnd); found++) {
+            if (found == expectedSizes || !NumberParser::ParseInteger(tokenBegin, tokenEnd, sizes[found]) ||
+                sizes[found] < 0) {
+                Fail(error, Status::INVALID_HEADER, line, Column(p, tokenBegin),
+                     "Tamanho inválido: \"" + Token(tokenBegin, tokenEnd) + "\"");
+                return Failure(error);
+            }
+        }
+        const long long limit = std::numeric_limits<int>::max();
+        if (found != expectedSizes || sizes[0] > limit || sizes[1] > limit ||
+            (symmetric && sizes[0] != sizes[1])) {
+            Fail(error, Status::INVALID_HEADER, line, 1,
+                 coordinate ? "Linha de tamanho esperada: linhas colunas entradas (quadrada se simétrica)"
+                            : "Linha de tamanho esperada: linhas colunas (quadrada se simétrica)");
+            return Failure(error);
+        }
+        const int rows = static_cast<int>(sizes[0]);
+        const int cols = static_cast<int>(sizes[1]);
+        long long expected = sizes[2];
+        if (!coordinate) {
+            const long long n = rows;
+            expected = !symmetric ? n * cols : mirrorSign > 0 ? n * (n + 1) / 2 : n * (n - 1) / 2;
+        }
+
+        // Entradas: uma por linha, nas partes paralelas
+        p = lineEnd < end ? lineEnd + 1 : end;
+        std::vector<Chunk> chunks = Split(p, end, pool);
+        const long long total = Count(chunks, line + 1, pool, [](const char* begin, const char* stop) {
+            const char* first = SkipBlanks(begin, stop);
+            return first < stop && *first != '%';
+        });
+
+        Result result;
+        std::vector<int> entryRows;
+        std::vector<Entry> entries;
+        if (coordinate) {
+            const std::size_t count = static_cast<std::size_t>(std::min(total, expected));
+            entryRows.resize(count);
+            entries.resize(count);
+        } else {
+            result.dense = DenseMatrix(rows, cols, 0.0);
+        }
+
+        ParallelFor(pool, 0, static_cast<int>(chunks.size()), 1, [&](int first, int last) {
+            for (int c = first; c < last; c++) {
+                Chunk& chunk = chunks[c];
+                long long index = chunk.offset;
+                long long lineNumber = chunk.firstLine;
+
+                // Posição (i, j) da entrada index de um array, em ordem de colunas
+                int arrayRow = 0;
+                int arrayColumn = 0;
+                if (!coordinate && index < expected) {
+                    long long remaining = index;
+                    for (;;) {
+                        const int start = !symmetric ? 0 : mirrorSign > 0 ? arrayColumn : arrayColumn + 1;
+                        const long long length = rows - start;
+                        if (remaining < length) {
+                            arrayRow = start + static_cast<int>(remaining);
+                            break;
+                        }
+                        remaining -= length;
+                        arrayColumn++;
+                    }
+                }
+
+                for (const char* q = chunk.begin; q < chunk.end; lineNumber++) {
+                    const char* stop = LineEnd(q, chunk.end);
+                    const char* lineBegin = q;
+                    q = stop + 1;
+                    const char* cursor = lineBegin;
+                    const char* fieldBegin;
+                    const char* fieldEnd;
+                    if (!NextToken(cursor, stop, fieldBegin, fieldEnd) || *fieldBegin == '%') {
+                        continue;
+                    }
+                    if (index >= expected) {
+                        Fail(chunk.error, Status::WRONG_ENTRY_COUNT, lineNumber, Column(lineBegin, fieldBegin),
+                             "Mais entradas que as " + std::to_string(expected) + " declaradas");
+                        break;
+                    }
+
+                    // Tokens: i j [valor] (coordinate) ou valor (array)
+                    const int tokenCount = coordinate ? (pattern ? 2 : 3) : 1;
+                    const char* tokens[3][2];
+                    int read = 0;
+                    tokens[0][0] = fieldBegin;
+                    tokens[0][1] = fieldEnd;
+                    for (read = 1; read < 4 && NextToken(cursor, stop, fieldBegin, fieldEnd); read++) {
+                        if (read < 3) {
+                            tokens[read][0] = fieldBegin;
+                            tokens[read][1] = fieldEnd;
+                        }
+                    }
+                    if (read != tokenCount) {
+                        Fail(chunk.error, Status::WRONG_FIELD_COUNT, lineNumber,
+                             read > tokenCount ? Column(lineBegin, fieldBegin) : Column(lineBegin, stop),
+                             std::string(read > tokenCount ? "Campos demais" : "Campos de menos") +
+                                 " na linha (esperados " + std::to_string(tokenCount) + ")");
+                        break;
+                    }
+
+                    double value = 1.0;
+                    const int valueToken = coordinate ? 2 : 0;
+                    if (!pattern && !NumberParser::ParseDouble(tokens[valueToken][0], tokens[valueToken][1], false, value)) {
+                        Fail(chunk.error, Status::MALFORMED_TOKEN, lineNumber, Column(lineBegin, tokens[valueToken][0]),
+                             "Número inválido: \"" + Token(tokens[valueToken][0], tokens[valueToken][1]) + "\"");
+                        break;
+                    }
+
+                    if (!coordinate) {
+                        result.dense(arrayRow, arrayColumn) = value;
+                        if (symmetric && arrayRow != arrayColumn) {
+                            result.dense(arrayColumn, arrayRow) = mirrorSign * value;
+                        }
+                        if (++arrayRow == rows) {
+                            arrayColumn++;
+                            arrayRow = !symmetric ? 0 : mirrorSign > 0 ? arrayColumn : arrayColumn + 1;
+                        }
+                        index++;
+                        continue;
+                    }
+
+                    long long position[2];
+                    bool valid = true;
+                    for (int t = 0; t < 2 && valid; t++) {
+                        if (!NumberParser::ParseInteger(tokens[t][0], tokens[t][1], position[t])) {
+                            Fail(chunk.error, Status::MALFORMED_TOKEN, lineNumber, Column(lineBegin, tokens[t][0]),
+                                 "Índice inválido: \"" + Token(tokens[t][0], tokens[t][1]) + "\"");
+                            valid = false;
+                        } else if (position[t] < 1 || position[t] > (t == 0 ? rows : cols)) {
+                            Fail(chunk.error, Status::INDEX_OUT_OF_RANGE, lineNumber, Column(lineBegin, tokens[t][0]),
+                                 "Índice " + std::to_string(position[t]) + " fora de 1.." +
+                                     std::to_string(t == 0 ? rows : cols));
+                            valid = false;
+                        }
+                    }
+                    if (!valid) {
+                        break;
+                    }
+                    entryRows[index] = static_cast<int>(position[0] - 1);
+                    entries[index] = {static_cast<int>(position[1] - 1), value};
+                    index++;
+                }
+            }
+        });
+
+        if (const Error* first = FirstError(chunks)) {
+            return Failure(*first);
+        }
+        if (total != expected) {
+            const long long lastLine = 1 + std::count(text.begin(), text.end(), '\n');
+            Fail(error, Status::WRONG_ENTRY_COUNT, lastLine, 1,
+                 "Esperadas " + std::to_string(expected) + " entradas, encontradas " + std::to_string(total));
+            return Failure(error);
+        }
+
+        if (coordinate) {
+            // A metade omitida das simétricas entra espelhada
+            if (symmetric) {
+                const std::size_t stored = entries.size();
+                entryRows.reserve(2 * stored);
+                entries.reserve(2 * stored);
+                for (std::size_t k = 0; k < stored; k++) {
+                    if (entryRows[k] != entries[k].column) {
+                        entryRows.push_back(entries[k].column);
+                        entries.push_back({entryRows[k], mirrorSign * entries[k].value});
+                    }
+                }
+            }
+            result.sparse = BuildCsr(rows, cols, entryRows, entries, pool);
+            result.isSparse = true;
+        }
+        result.status = Status::SUCCESS;
+        return result;
+    }
+
+    static Result ReadMatrixMarket(const std::filesystem::path& path, ThreadPool* pool = nullptr) {
+        std::string text;
+        if (!ReadFile(path, text)) {
+            Result result;
+            result.message = "Não foi possível ler o arquivo";
+            return result;
+        }
+        return ParseMatrixMarket(text, pool);
+    }
+
+    // CSV/TSV em memória, sempre como matriz densa. delimiter = 0 detecta pela
+    // primeira linha: tabulação, ';', ',' ou espaços. Com ';' ou tabulação a
+    // vírgula decimal ("1,5") também é aceita. header pula a primeira linha
+    static Result ParseDelimited(const std::string& text, ThreadPool* pool = nullptr,
+                                 char delimiter = 0, bool header = false) {
+        Error error;
+        const char* p = text.data();
+        const char* end = p + text.size();
+
+        // Primeira linha não vazia (cabeçalho ou primeira linha de dados)
+        long long line = 1;
+        const char* lineEnd = LineEnd(p, end);
+        while (p < end && IsBlankLine(p, lineEnd)) {
+            p = lineEnd < end ? lineEnd + 1 : end;
+            lineEnd = LineEnd(p, end);
+            line++;
+        }
+        if (header && p < end) {
+            p = lineEnd < end ? lineEnd + 1 : end;
+            line++;
+        }
+        if (delimiter == 0) {
+            const char* stop = LineEnd(p, end);
+            const char* candidates = "\t;,";
+            delimiter = ' ';
+            for (const char* c = candidates; *c; c++) {
+                if (std::memchr(p, *c, static_cast<std::size_t>(stop - p))) {
+                    delimiter = *c;
+                    break;
+                }
+            }
+        }
+        const bool spaces = delimiter == ' ';
+        const bool decimalComma = delimiter != ',';
+
+        // Separar os campos de uma linha; false no primeiro token inválido
+        auto parseLine = [&](const char* lineBegin, const char* stop, long long lineNumber,
+                             double* output, int expected, int& fields, Error& lineError) {
+            fields = 0;
+            const char* q = lineBegin;
+            for (bool lastField = false; !lastField;) {
+                const char* fieldBegin;
+                const char* fieldEnd;
+                if (spaces) {
+                    if (!NextToken(q, stop, fieldBegin, fieldEnd)) {
+                        return true;
+                    }
+                } else {
+                    const char* separator = std::find(q, stop, delimiter);
+                    fieldBegin = SkipBlanks(q, separator);
+                    fieldEnd = separator;
+                    while (fieldEnd > fieldBegin && IsBlank(*(fieldEnd - 1))) {
+                        fieldEnd--;
+                    }
+                    if (fieldEnd - fieldBegin >= 2 && *fieldBegin == '"' && *(fieldEnd - 1) == '"') {
+                        fieldBegin++;
+                        fieldEnd--;
+                    }
+                    lastField = separator == stop;
+                    q = lastField ? stop : separator + 1;
+                }
+                if (output && fields >= expected) {
+                    return Fail(lineError, Status::WRONG_FIELD_COUNT, lineNumber, Column(lineBegin, fieldBegin),
+                                "Mais de " + std::to_string(expected) + " campos na linha");
+                }
+                double value;
+                if (!NumberParser::ParseDouble(fieldBegin, fieldEnd, decimalComma, value)) {
+                    return Fail(lineError, Status::MALFORMED_TOKEN, lineNumber, Column(lineBegin, fieldBegin),
+                                fieldBegin == fieldEnd ? std::string("Campo vazio")
+                                                       : "Número inválido: \"" + Token(fieldBegin, fieldEnd) + "\"");
+                }
+                if (output) {
+                    output[fields] = value;
+                }
+                fields++;
+            }
+            return true;
+        };
+
+        // A primeira linha de dados define o número de colunas
+        lineEnd = LineEnd(p, end);
+        while (p < end && IsBlankLine(p, lineEnd)) {
+            p = lineEnd < end ? lineEnd + 1 : end;
+            lineEnd = LineEnd(p, end);
+            line++;
+        }
+        int cols = 0;
+        if (p < end && !parseLine(p, lineEnd, line, nullptr, 0, cols, error)) {
+            return Failure(error);
+        }
+
+        std::vector<Chunk> chunks = Split(p, end, pool);
+        const long long rows = Count(chunks, line, pool, [](const char* begin, const char* stop) {
+            return !IsBlankLine(begin, stop);
+        });
+        if (rows > std::numeric_limits<int>::max()) {
+            Fail(error, Status::WRONG_ENTRY_COUNT, line, 1, "Linhas demais para uma matriz");
+            return Failure(error);
+        }
+
+        Result result;
+        result.dense = DenseMatrix(static_cast<int>(rows), cols);
+        ParallelFor(pool, 0, static_cast<int>(chunks.size()), 1, [&](int first, int last) {
+            for (int c = first; c < last; c++) {
+                Chunk& chunk = chunks[c];
+                long long row = chunk.offset;
+                long long lineNumber = chunk.firstLine;
+                for (const char* q = chunk.begin; q < chunk.end; lineNumber++) {
+                    const char* stop = LineEnd(q, chunk.end);
+                    const char* lineBegin = q;
+                    q = stop + 1;
+                    if (IsBlankLine(lineBegin, stop)) {
+                        continue;
+                    }
+                    int fields = 0;
+                    if (!parseLine(lineBegin, stop, lineNumber, result.dense.Row(static_cast<int>(row)), cols,
+                                   fields, chunk.error)) {
+                        break;
+                    }
+                    if (fields != cols) {
+                        Fail(chunk.error, Status::WRONG_FIELD_COUNT, lineNumber, Column(lineBegin, stop),
+                             "Esperados " + std::to_string(cols) + " campos, encontrados " + std::to_string(fields));
+                        break;
+                    }
+                    row++;
+                }
+            }
+        });
+
+        if (const Error* first = FirstError(chunks)) {
+            return Failure(*first);
+        }
+        result.status = Status::SUCCESS;
+        return result;
+    }
+
+    static Result ReadDelimited(const std::filesystem::path& path, ThreadPool* pool = nullptr,
+                                char delimiter = 0, bool header = false) {
+        std::string text;
+        if (!ReadFile(path, text)) {
+            Result result;
+            result.message = "Não foi possível ler o arquivo";
+            return result;
+        }
+        return ParseDelimited(text, pool, delimiter, header);
+    }
+
+    // Escolher o leitor pela extensão: .mtx é Matrix Market; o resto, CSV/TSV
+    static Result Read(const std::filesystem::path& path, ThreadPool* pool = nullptr) {
+        if (Lower(path.extension().u8string()) == ".mtx") {
+            return ReadMatrixMarket(path, pool);
+        }
+        return ReadDelimited(path, pool);
+    }
+};
@@ -0,0 +1,492 @@
+#pragma once
+#include <vector>
+#include <cmath>
+#include <cstdint>
+#include <mutex>
+#include <algorithm>
+#include "DenseMatrix.h"
+#include "BigInt.h"
+#include "ExactSolver.h"
+#include "ThreadPool.h"
+#include "SimdKernels.h"
+
+// Solução racional exata por eliminação modular. Cada linha é multiplicada
+// pelo mmc dos seus denominadores, e o sistema inteiro resultante é eliminado
+// módulo vários primos de 31 bits, com aritmética de Montgomery de 32 bits (a
+// atualização das linhas usa o kernel SIMD do nível da CPU, até 16 faixas),
+// um primo por tarefa do pool. As soluções modulares são combinadas
+// pelo teorema chinês do resto (Garner), e a solução racional é reconstruída
+// (Euclides estendido com denominador comum) e verificada exatamente em
+// A·x = b. A eliminação para no primeiro lote de primos em que a verificação
+// passa, então o número de primos acompanha o tamanho da resposta, não o
+// limite de Hadamard. Sistemas singulares módulo todos os primos do primeiro
+// lote são classificados pelo Bareiss em BigInt (ExactSolver).
+// O determinante exato pode exigir primos além dos da solução (até o limite de
+// Hadamard dividido pelo denominador da solução); quem não precisa dele passa
+// determinant = false.
+class MultiModularSolver {
+public:
+    using Rational = ExactSolver::Rational;
+    using Outcome = ExactSolver::Outcome;
+
+    struct Result {
+        Outcome outcome = Outcome::NOT_INTEGRAL; // NOT_INTEGRAL: entrada inválida (tamanho, não finito, denominador 0)
+        int rank = -1;
+        Rational determinant;                    // Exato (0 se singular)
+        bool hasDeterminant = false;             // Pedido e certificado
+        std::vector<Rational> values;            // Só com solução única
+        int primes = 0;                          // Primos usados na eliminação modular
+        bool modular = false;                    // false: decidido pelo Bareiss
+    };
+
+    // Lote máximo de primos eliminados em paralelo entre duas reconstruções
+    static constexpr int MAX_BATCH = 64;
+
+private:
+    // Aritmética de Montgomery módulo um primo ímpar p < 2^31 (R = 2^32).
+    // Valores em forma de Montgomery (x·R mod p); zero continua zero. Com 32
+    // bits os produtos cabem em uint64 e a eliminação vetoriza em faixas de 32 bits
+    class Montgomery {
+    private:
+        std::uint32_t modulus;
+        std::uint32_t negativeInverse; // -p⁻¹ mod 2^32
+        std::uint32_t rSquared;        // R² mod p
+
+    public:
+        explicit Montgomery(std::uint32_t p) : modulus(p) {
+            // Newton: cada passo dobra os bits corretos de p⁻¹ (p·p ≡ 1 mod 8)
+            std::uint32_t inverse = p;
+            for (int i = 0; i < 4; i++) {
+                inverse *= 2 - p * inverse;
+            }
+            negativeInverse = 0 - inverse;
+            const std::uint64_t r = (std::uint64_t(1) << 32) % p;
+            rSquared = static_cast<std::uint32_t>(r * r % p);
+        }
+
+        std::uint32_t Modulus() const { return modulus; }
+        std::uint32_t NegativeInverse() const { return negativeInverse; }
+
+        // t·R⁻¹ mod p para t < p·R
+        std::uint32_t Reduce(std::uint64_t t) const {
+            return SimdDetail::MontgomeryReduce32(t, modulus, negativeInverse);
+        }
+
+        std::uint32_t Multiply(std::uint32_t a, std::uint32_t b) const {
+            return Reduce(static_cast<std::uint64_t>(a) * b);
+        }
+
+        std::uint32_t Subtract(std::uint32_t a, std::uint32_t b) const {
+            return a >= b ? a - b : a + modulus - b;
+        }
+
+        std::uint32_t Enter(std::uint32_t x) const { return Multiply(x, rSquared); }
+        std::uint32_t Leave(std::uint32_t x) const { return Reduce(x); }
+
+        std::uint32_t Power(std::uint32_t base, std::uint32_t exponent) const {
+            std::uint32_t result = Enter(1);
+            while (exponent != 0) {
+                if (exponent & 1) {
+                    result = Multiply(result, base);
+                }
+                base = Multiply(base, base);
+                exponent >>= 1;
+            }
+            return result;
+        }
+
+        // Inverso pelo pequeno teorema de Fermat (x != 0, ambos em forma de Montgomery)
+        std::uint32_t Inverse(std::uint32_t x) const { return Power(x, modulus - 2); }
+
+        // Operações em representação comum (reconstrução pelo resto chinês)
+        std::uint32_t MultiplyPlain(std::uint32_t a, std::uint32_t b) const { return Multiply(Enter(a), b); }
+        std::uint32_t InversePlain(std::uint32_t x) const { return Leave(Inverse(Enter(x))); }
+    };
+
+    // Miller-Rabin determinístico para n < 2^32 (bases 2, 7 e 61)
+    static bool IsPrime(std::uint32_t n) {
+        const Montgomery mod(n);
+        std::uint32_t d = n - 1;
+        int twos = 0;
+        while (d % 2 == 0) {
+            d /= 2;
+            twos++;
+        }
+        const std::uint32_t one = mod.Enter(1);
+        const std::uint32_t minusOne = mod.Enter(n - 1);
+        for (std::uint32_t base : {2u, 7u, 61u}) {
+            std::uint32_t x = mod.Power(mod.Enter(base), d);
+            if (x == one || x == minusOne) {
+                continue;
+            }
+            bool composite = true;
+            for (int i = 1; i < twos && composite; i++) {
+                x = mod.Multiply(x, x);
+                composite = x != minusOne;
+            }
+            if (composite) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    // index-ésimo primo abaixo de 2^31 (em ordem decrescente), gerado sob demanda
+    static std::uint32_t Prime(int index) {
+        static std::mutex mutex;
+        static std::vector<std::uint32_t> primes;
+        std::lock_guard<std::mutex> lock(mutex);
+        while (static_cast<int>(primes.size()) <= index) {
+            std::uint32_t candidate = primes.empty() ? (std::uint32_t(1) << 31) - 1 : primes.back() - 2;
+            while (!IsPrime(candidate)) {
+                candidate -= 2;
+            }
+            primes.push_back(candidate);
+        }
+        return primes[index];
+    }
+
+    // Eliminar [A|b] (inteira, n x (n + 1) em ordem de linhas) módulo p.
+    // residues recebe x mod p e, na posição n, det(A) mod p. false se A for
+    // singular módulo p (primo azarado ou matriz singular).
+    static bool SolveModulo(const std::vector<BigInt>& augmented, int n, const Montgomery& mod,
+                            std::vector<std::uint32_t>& work, std::vector<std::uint32_t>& residues) {
+        const int cols = n + 1;
+        const std::uint32_t p = mod.Modulus();
+        work.resize(augmented.size());
+        for (std::size_t k = 0; k < augmented.size(); k++) {
+            work[k] = mod.Enter(static_cast<std::uint32_t>(augmented[k].Mod(p)));
+        }
+
+        std::uint32_t determinant = mod.Enter(1);
+        bool negate = false;
+        for (int k = 0; k < n; k++) {
+            int pivotRow = k;
+            while (pivotRow < n && work[static_cast<std::size_t>(pivotRow) * cols + k] == 0) {
+                pivotRow++;
+            }
+            if (pivotRow == n) {
+                return false;
+            }
+            std::uint32_t* pivot = &work[static_cast<std::size_t>(k) * cols];
+            if (pivotRow != k) {
+                std::swap_ranges(pivot + k, pivot + cols, &work[static_cast<std::size_t>(pivotRow) * cols + k]);
+                negate = !negate;
+            }
+
+            // Linha do pivô normalizada: o pivô vira 1 e a substituição não divide
+            determinant = mod.Multiply(determinant, pivot[k]);
+            const std::uint32_t inverse = mod.Inverse(pivot[k]);
+            for (int j = k + 1; j < cols; j++) {
+                pivot[j] = mod.Multiply(pivot[j], inverse);
+            }
+            for (int i = k + 1; i < n; i++) {
+                std::uint32_t* row = &work[static_cast<std::size_t>(i) * cols];
+                const std::uint32_t factor = row[k];
+                if (factor == 0) {
+                    continue;
+                }
+                SimdSubMulMod(cols - k - 1, factor, pivot + k + 1, row + k + 1, p, mod.NegativeInverse());
+            }
+        }
+
+        residues.resize(n + 1);
+        for (int i = n - 1; i >= 0; i--) {
+            const std::uint32_t* row = &work[static_cast<std::size_t>(i) * cols];
+            std::uint32_t sum = row[n];
+            for (int j = i + 1; j < n; j++) {
+                sum = mod.Subtract(sum, mod.Multiply(row[j], residues[j]));
+            }
+            residues[i] = sum;
+        }
+        for (int i = 0; i < n; i++) {
+            residues[i] = mod.Leave(residues[i]);
+        }
+        determinant = mod.Leave(determinant);
+        residues[n] = (negate && determinant != 0) ? p - determinant : determinant;
+        return true;
+    }
+
+    // Garner incremental: values ≡ residues (mod p) e continua ≡ (mod modulus)
+    static void Combine(std::vector<BigInt>& values, BigInt& modulus, std::uint32_t p,
+                        const std::vector<std::uint32_t>& residues) {
+        const Montgomery mod(p);
+        const std::uint32_t inverse = mod.InversePlain(static_cast<std::uint32_t>(modulus.Mod(p)));
+        for (std::size_t i = 0; i < values.size(); i++) {
+            const std::uint32_t difference = mod.Subtract(residues[i], static_cast<std::uint32_t>(values[i].Mod(p)));
+            const std::uint32_t t = mod.MultiplyPlain(difference, inverse);
+            if (t != 0) {
+                values[i] += modulus * BigInt(static_cast<long long>(t));
+            }
+        }
+        modulus *= BigInt(static_cast<long long>(p));
+    }
+
+    // |x| <= sqrt(modulus / 2): limite da reconstrução racional
+    static bool Small(const BigInt& x, const BigInt& modulus) {
+        return x * x * BigInt(2) <= modulus;
+    }
+
+    // n/d ≡ u (mod modulus) com |n|, d <= sqrt(modulus / 2), se existir
+    static bool Lift(const BigInt& u, const BigInt& modulus, BigInt& numerator, BigInt& denominator) {
+        BigInt r0 = modulus;
+        BigInt r1 = u;
+        BigInt t0;
+        BigInt t1 = 1;
+        while (!Small(r1, modulus)) {
+            const BigInt quotient = r0 / r1;
+            BigInt r2 = r0 - quotient * r1;
+            BigInt t2 = t0 - quotient * t1;
+            r0 = std::move(r1);
+            r1 = std::move(r2);
+            t0 = std::move(t1);
+            t1 = std::move(t2);
+        }
+        if (t1.IsZero() || !Small(t1, modulus) || BigInt::Gcd(r1, t1) != BigInt(1)) {
+            return false;
+        }
+        numerator = t1.Sign() < 0 ? -r1 : r1;
+        denominator = t1.Abs();
+        return true;
+    }
+
+    // x_i = numerators[i] / denominator com um denominador comum: cada
+    // componente multiplicada pelo denominador acumulado quase sempre já é
+    // pequena e dispensa o Euclides
+    static bool Reconstruct(const std::vector<BigInt>& values, int n, const BigInt& modulus,
+                            std::vector<BigInt>& numerators, BigInt& denominator) {
+        const BigInt half = modulus / BigInt(2);
+        denominator = 1;
+        numerators.assign(n, BigInt());
+        for (int i = 0; i < n; i++) {
+            BigInt scaled = values[i] * denominator % modulus;
+            BigInt centered = scaled > half ? scaled - modulus : scaled;
+            if (Small(centered, modulus)) {
+                numerators[i] = std::move(centered);
+                continue;
+            }
+            BigInt numerator;
+            BigInt extra;
+            if (!Lift(scaled, modulus, numerator, extra)) {
+                return false;
+            }
+            for (int j = 0; j < i; j++) {
+                numerators[j] *= extra;
+            }
+            numerators[i] = std::move(numerator);
+            denominator *= extra;
+            if (!Small(denominator, modulus)) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    // A·numerators == denominator·b em inteiros
+    static bool Verify(const std::vector<BigInt>& augmented, int n, const std::vector<BigInt>& numerators,
+                       const BigInt& denominator) {
+        const int cols = n + 1;
+        for (int i = 0; i < n; i++) {
+            const BigInt* row = &augmented[static_cast<std::size_t>(i) * cols];
+            BigInt sum;
+            for (int j = 0; j < n; j++) {
+                if (!row[j].IsZero() && !numerators[j].IsZero()) {
+                    sum += row[j] * numerators[j];
+                }
+            }
+            if (sum != denominator * row[n]) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    // log2 do limite de Hadamard para det(A) e os numeradores de Cramer
+    static double HadamardBits(const std::vector<BigInt>& augmented, int n) {
+        const int cols = n + 1;
+        double bits = 1.0;
+        for (int i = 0; i < n; i++) {
+            double largest = 0.0;
+            for (int j = 0; j < cols; j++) {
+                largest = std::max(largest, augmented[static_cast<std::size_t>(i) * cols + j].LogAbs());
+            }
+            bits += (largest + 0.5 * std::log(static_cast<double>(cols))) / std::log(2.0);
+        }
+        return bits;
+    }
+
+    static Rational Reduce(BigInt numerator, BigInt denominator) {
+        if (denominator.Sign() < 0) {
+            numerator = -numerator;
+            denominator = -denominator;
+        }
+        const BigInt divisor = BigInt::Gcd(numerator, denominator);
+        if (!divisor.IsZero() && divisor != BigInt(1)) {
+            numerator /= divisor;
+            denominator /= divisor;
+        }
+        Rational result;
+        result.numerator = std::move(numerator);
+        result.denominator = std::move(denominator);
+        return result;
+    }
+
+    // Sistema singular (ou reconstrução que não fechou no limite): Bareiss decide
+    static Result Fallback(const std::vector<BigInt>& augmented, int n, const BigInt& scale, int primes) {
+        ExactSolver::Result exact = ExactSolver::SolveAugmented(augmented, n);
+        Result result;
+        result.outcome = exact.outcome;
+        result.rank = exact.rank;
+        result.determinant = Reduce(exact.determinant, scale);
+        result.hasDeterminant = true;
+        result.values = std::move(exact.values);
+        result.primes = primes;
+        return result;
+    }
+
+    // Núcleo: [A|b] inteira; scale é o produto dos fatores aplicados às linhas
+    static Result SolveIntegers(const std::vector<BigInt>& augmented, int n, const BigInt& scale, ThreadPool* pool,
+                                bool determinant) {
+        const double bound = HadamardBits(augmented, n);
+        const int maxPrimes = static_cast<int>((2.0 * bound + 2.0) / 30.0) + 2;
+
+        std::vector<BigInt> values(n + 1); // x e det(A) módulo o produto dos primos usados
+        BigInt modulus = 1;
+        std::vector<std::uint32_t> used;
+        std::vector<std::uint32_t> determinants;
+        std::vector<BigInt> numerators;
+        BigInt denominator;
+        bool verified = false;
+
+        int next = 0;
+        int batch = std::max(2, pool ? pool->ThreadCount() : 1);
+        std::vector<std::vector<std::uint32_t>> residues;
+        std::vector<char> nonsingular;
+        while (true) {
+            std::vector<std::uint32_t> primes(batch);
+            for (int k = 0; k < batch; k++) {
+                primes[k] = Prime(next + k);
+            }
+            next += batch;
+            residues.assign(batch, std::vector<std::uint32_t>());
+            nonsingular.assign(batch, 0);
+            ParallelFor(pool, 0, batch, 1, [&](int begin, int end) {
+                std::vector<std::uint32_t> work;
+                for (int k = begin; k < end; k++) {
+                    nonsingular[k] = SolveModulo(augmented, n, Montgomery(primes[k]), work, residues[k]);
+                }
+            });
+
+            for (int k = 0; k < batch; k++) {
+                if (nonsingular[k]) {
+                    Combine(values, modulus, primes[k], residues[k]);
+                    used.push_back(primes[k]);
+                    determinants.push_back(residues[k][n]);
+                }
+            }
+            if (used.empty()) {
+                return Fallback(augmented, n, scale, next);
+            }
+
+            if (!verified) {
+                verified = Reconstruct(values, n, modulus, numerators, denominator) &&
+                           Verify(augmented, n, numerators, denominator);
+            }
+            // O denominador comum divide det(A): basta recuperar det/denominador,
+            // que o módulo atual já certifica quando passa do limite restante
+            if (verified &&
+                (!determinant || modulus.BitLength() - 1 > bound - denominator.LogAbs() / std::log(2.0) + 1.0)) {
+                break;
+            }
+            if (static_cast<int>(used.size()) > maxPrimes) {
+                return Fallback(augmented, n, scale, next);
+            }
+            batch = std::min(batch * 2, MAX_BATCH);
+        }
+
+        Result result;
+        result.outcome = Outcome::UNIQUE_SOLUTION;
+        result.rank = n;
+        if (determinant) {
+            // det/denominador pelo resto chinês, levantado para o intervalo simétrico
+            std::vector<BigInt> quotient(1);
+            BigInt quotientModulus = 1;
+            for (std::size_t k = 0; k < used.size(); k++) {
+                const Montgomery mod(used[k]);
+                const std::uint32_t residue = mod.MultiplyPlain(
+                    determinants[k], mod.InversePlain(static_cast<std::uint32_t>(denominator.Mod(used[k]))));
+                Combine(quotient, quotientModulus, used[k], std::vector<std::uint32_t>(1, residue));
+            }
+            if (quotient[0] > quotientModulus / BigInt(2)) {
+                quotient[0] -= quotientModulus;
+            }
+            result.determinant = Reduce(quotient[0] * denominator, scale);
+            result.hasDeterminant = true;
+        }
+        result.values.resize(n);
+        for (int i = 0; i < n; i++) {
+            result.values[i] = Reduce(numerators[i], denominator);
+        }
+        result.primes = next;
+        result.modular = true;
+        return result;
+    }
+
+public:
+    // Resolver A·x = b com coeficientes racionais (denominadores não nulos)
+    static Result Solve(const std::vector<std::vector<Rational>>& a, const std::vector<Rational>& b,
+                        ThreadPool* pool = nullptr, bool determinant = true) {
+        const int n = static_cast<int>(a.size());
+        if (n == 0 || static_cast<int>(b.size()) != n) {
+            return Result();
+        }
+
+        // Linha i multiplicada pelo mmc dos seus denominadores
+        const int cols = n + 1;
+        std::vector<BigInt> augmented(static_cast<std::size_t>(n) * cols);
+        BigInt scale = 1;
+        for (int i = 0; i < n; i++) {
+            if (static_cast<int>(a[i].size()) != n) {
+                return Result();
+            }
+            BigInt lcm = 1;
+            for (int j = 0; j < cols; j++) {
+                const BigInt& denominator = (j < n ? a[i][j] : b[i]).denominator;
+                if (denominator.IsZero()) {
+                    return Result();
+                }
+                lcm = lcm / BigInt::Gcd(lcm, denominator) * denominator.Abs();
+            }
+            for (int j = 0; j < cols; j++) {
+                const Rational& value = j < n ? a[i][j] : b[i];
+                augmented[static_cast<std::size_t>(i) * cols + j] = value.numerator * (lcm / value.denominator);
+            }
+            scale *= lcm;
+        }
+        return SolveIntegers(augmented, n, scale, pool, determinant);
+    }
+
+    // Coeficientes double tomados pelo seu valor binário exato
+    static Result Solve(const DenseMatrix& a, const std::vector<double>& b, ThreadPool* pool = nullptr,
+                        bool determinant = true) {
+        const int n = a.Rows();
+        if (n == 0 || a.Cols() != n || static_cast<int>(b.size()) != n) {
+            return Result();
+        }
+        std::vector<std::vector<Rational>> rationals(n, std::vector<Rational>(n));
+        std::vector<Rational> constants(n);
+        for (int i = 0; i < n; i++) {
+            for (int j = 0; j < n; j++) {
+                if (!std::isfinite(a(i, j))) {
+                    return Result();
+                }
+                rationals[i][j] = Rational::FromDouble(a(i, j));
+            }
+            if (!std::isfinite(b[i])) {
+                return Result();
+            }
+            constants[i] = Rational::FromDouble(b[i]);
+        }
+        return Solve(rationals, constants, pool, determinant);
+    }
+};
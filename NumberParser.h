@@ -0,0 +1,49 @@
+#pragma once
+#include <charconv>
+#include <cmath>
+#include <cstring>
+#include <algorithm>
+
+// Conversão de números em texto com std::from_chars, compartilhada pela
+// leitura de arquivos (MatrixReader) e pelas células da interface (InputModel).
+// O intervalo [p, end) inteiro tem que ser o número: sem espaços, com '+'
+// inicial opcional e só valores finitos ("nan", "inf" e "+-1" são inválidos).
+class NumberParser {
+public:
+    // '+' inicial opcional (from_chars não o aceita); "+-1" continua inválido
+    static bool SkipPlus(const char*& p, const char* end) {
+        if (p < end && *p == '+') {
+            p++;
+            return p == end || (*p != '+' && *p != '-');
+        }
+        return true;
+    }
+
+    // Número real finito. decimalComma aceita "1,5" (CSV com ';' ou tabulação,
+    // comum com a vírgula decimal)
+    static bool ParseDouble(const char* p, const char* end, bool decimalComma, double& value) {
+        if (!SkipPlus(p, end) || p == end) {
+            return false;
+        }
+        if (decimalComma && std::memchr(p, ',', static_cast<std::size_t>(end - p))) {
+            char buffer[64];
+            const std::size_t length = static_cast<std::size_t>(end - p);
+            if (length >= sizeof(buffer)) {
+                return false;
+            }
+            std::replace_copy(p, end, buffer, ',', '.');
+            auto parsed = std::from_chars(buffer, buffer + length, value);
+            return parsed.ec == std::errc() && parsed.ptr == buffer + length && std::isfinite(value);
+        }
+        auto parsed = std::from_chars(p, end, value);
+        return parsed.ec == std::errc() && parsed.ptr == end && std::isfinite(value);
+    }
+
+    static bool ParseInteger(const char* p, const char* end, long long& value) {
+        if (!SkipPlus(p, end)) {
+            return false;
+        }
+        auto parsed = std::from_chars(p, end, value);
+        return p < end && parsed.ec == std::errc() && parsed.ptr == end;
+    }
+};
@@ -0,0 +1,660 @@
+#pragma once
+#include <vector>
+#include <string>
+#include <fstream>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <future>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <algorithm>
+#include "DenseMatrix.h"
+#include "SimdKernels.h"
+#include "ThreadPool.h"
+
+// Fatoração LU fora da memória (out-of-core) para matrizes densas maiores que
+// a RAM. A matriz fica em um arquivo dividido em painéis de colunas e a LU é
+// left-looking: para fatorar o painel j, os painéis de fatores 0..j-1 passam
+// um a um pela memória (U_kj = L_kk⁻¹·A_kj e A_j -= L_k·U_kj), e depois o
+// painel é fatorado com pivoteamento parcial. Uma thread de E/S lê o próximo
+// painel enquanto o atual é processado e grava o painel fatorado enquanto o
+// seguinte começa, de modo que só cinco painéis (atual, próximo, dois à
+// esquerda e o que está sendo gravado) ficam na memória.
+//
+// Os fatores vão para um segundo arquivo (path + ".lu") e a matriz original
+// nunca é alterada. Depois de gravar cada painel, um checkpoint (path +
+// ".ckpt") registra os painéis prontos, as trocas de linha e o determinante:
+// se o processo cair, Open() retoma do último painel completo.
+//
+// As trocas de um painel não são aplicadas aos painéis já gravados (isso
+// exigiria regravá-los); cada painel de L recebe as trocas posteriores na
+// memória, quando é lido de novo.
+class OutOfCoreLU {
+public:
+    static constexpr int DEFAULT_PANEL_WIDTH = 256;
+    static constexpr double DEFAULT_TOLERANCE = 1e-10;
+
+    enum class Status {
+        SUCCESS,    // Todos os painéis fatorados
+        INCOMPLETE, // Parou no limite de painéis pedido; Factor() continua do checkpoint
+        SINGULAR,   // Coluna sem pivô utilizável (SingularColumn())
+        IO_ERROR    // Falha ao ler ou gravar; o estado volta ao último checkpoint
+    };
+
+private:
+    static constexpr std::streamoff HEADER_BYTES = 64;
+
+    // Arquivo de painéis: cabeçalho de HEADER_BYTES bytes e depois o painel p
+    // (colunas [p·w, p·w + w)) como n linhas contíguas de doubles
+    class PanelFile {
+    private:
+        std::fstream file;
+        int size = 0;
+        int panelWidth = 0;
+
+        std::streamoff Offset(int panel, int row) const {
+            return HEADER_BYTES + (static_cast<std::streamoff>(panel) * panelWidth * size +
+                                   static_cast<std::streamoff>(row) * Width(panel)) *
+                                      static_cast<std::streamoff>(sizeof(double));
+        }
+
+    public:
+        int Width(int panel) const { return std::min(panelWidth, size - panel * panelWidth); }
+
+        // Criar com conteúdo zero (o arquivo só é estendido até o tamanho final)
+        bool Create(const std::string& path, const char* magic, int n, int width) {
+            file.close();
+            file.clear();
+            file.open(path, std::ios::in | std::ios::out | std::ios::binary | std::ios::trunc);
+            if (!file) {
+                return false;
+            }
+            size = n;
+            panelWidth = width;
+            char header[HEADER_BYTES] = {};
+            const std::int64_t fields[2] = {n, width};
+            std::memcpy(header, magic, 8);
+            std::memcpy(header + 8, fields, sizeof(fields));
+            file.write(header, HEADER_BYTES);
+            file.seekp(Offset(0, 0) + static_cast<std::streamoff>(n) * n * static_cast<std::streamoff>(sizeof(double)) - 1);
+            file.put('\0');
+            file.flush();
+            return !file.fail();
+        }
+
+        bool Open(const std::string& path, const char* magic) {
+            file.close();
+            file.clear();
+            file.open(path, std::ios::in | std::ios::out | std::ios::binary);
+            char header[HEADER_BYTES];
+            if (!file || !file.read(header, HEADER_BYTES) || std::memcmp(header, magic, 8) != 0) {
+                file.close();
+                return false;
+            }
+            std::int64_t fields[2];
+            std::memcpy(fields, header + 8, sizeof(fields));
+            size = static_cast<int>(fields[0]);
+            panelWidth = static_cast<int>(fields[1]);
+            return size > 0 && panelWidth > 0;
+        }
+
+        bool IsOpen() const { return file.is_open(); }
+        int Size() const { return size; }
+        int PanelWidth() const { return panelWidth; }
+
+        bool Read(int panel, DenseMatrix& target) {
+            const int width = Width(panel);
+            target.Resize(size, width);
+            file.clear();
+            file.seekg(Offset(panel, 0));
+            if (target.Stride() == width) {
+                file.read(reinterpret_cast<char*>(target.Row(0)),
+                          static_cast<std::streamsize>(size) * width * sizeof(double));
+            } else {
+                for (int i = 0; i < size && file; i++) {
+                    file.read(reinterpret_cast<char*>(target.Row(i)), width * sizeof(double));
+                }
+            }
+            return !file.fail();
+        }
+
+        bool Write(int panel, const DenseMatrix& source) {
+            const int width = Width(panel);
+            file.clear();
+            file.seekp(Offset(panel, 0));
+            if (source.Stride() == width) {
+                file.write(reinterpret_cast<const char*>(source.Row(0)),
+                           static_cast<std::streamsize>(size) * width * sizeof(double));
+            } else {
+                for (int i = 0; i < size && file; i++) {
+                    file.write(reinterpret_cast<const char*>(source.Row(i)), width * sizeof(double));
+                }
+            }
+            return !file.fail();
+        }
+
+        // count valores da linha row a partir da coluna col (dentro de um painel)
+        bool WriteSegment(int row, int col, const double* values, int count) {
+            const int panel = col / panelWidth;
+            file.clear();
+            file.seekp(Offset(panel, row) + static_cast<std::streamoff>(col - panel * panelWidth) * sizeof(double));
+            file.write(reinterpret_cast<const char*>(values), count * sizeof(double));
+            return !file.fail();
+        }
+
+        bool Flush() {
+            file.flush();
+            return !file.fail();
+        }
+    };
+
+    // Thread de E/S: leituras antecipadas e gravações adiadas, em ordem de
+    // chegada. O destrutor espera a fila esvaziar.
+    class IoThread {
+    private:
+        std::mutex mutex;
+        std::condition_variable wake;
+        std::deque<std::packaged_task<bool()>> tasks;
+        bool stopping = false;
+        std::thread worker; // Por último: só começa com o resto já construído
+
+        void Run() {
+            while (true) {
+                std::packaged_task<bool()> task;
+                {
+                    std::unique_lock<std::mutex> lock(mutex);
+                    wake.wait(lock, [&] { return stopping || !tasks.empty(); });
+                    if (tasks.empty()) {
+                        return;
+                    }
+                    task = std::move(tasks.front());
+                    tasks.pop_front();
+                }
+                task();
+            }
+        }
+
+    public:
+        IoThread() : worker(&IoThread::Run, this) {}
+
+        ~IoThread() {
+            {
+                std::lock_guard<std::mutex> lock(mutex);
+                stopping = true;
+            }
+            wake.notify_one();
+            worker.join();
+        }
+
+        std::future<bool> Submit(std::function<bool()> work) {
+            std::packaged_task<bool()> task(std::move(work));
+            std::future<bool> result = task.get_future();
+            {
+                std::lock_guard<std::mutex> lock(mutex);
+                tasks.push_back(std::move(task));
+            }
+            wake.notify_one();
+            return result;
+        }
+    };
+
+    // Micro-bloco da atualização A -= L·U (como na BlockedLU)
+    static constexpr int MR = 4;
+    static constexpr int NR = 8;
+
+    // Linhas mínimas por tarefa ao dividir a fatoração do painel entre threads
+    static constexpr int PANEL_MIN_ROWS = 1024;
+
+    std::string path;
+    PanelFile matrixFile;
+    PanelFile factorFile;
+    std::vector<int> pivots; // pivots[r]: linha trocada com r (índices globais)
+    int factoredPanels = 0;
+    int singularColumn = -1;
+    double logAbsDeterminant = 0.0;
+    int determinantSign = 1;
+
+    static std::string FactorPath(const std::string& path) { return path + ".lu"; }
+    static std::string CheckpointPath(const std::string& path) { return path + ".ckpt"; }
+
+    // Checkpoint: painéis prontos, determinante e trocas (gravado em um
+    // arquivo temporário e renomeado, para nunca ficar pela metade)
+    static bool WriteCheckpoint(const std::string& path, int n, int width, int panels, double logAbs, int sign,
+                                const std::vector<int>& rowSwaps) {
+        const std::string temporary = CheckpointPath(path) + ".tmp";
+        {
+            std::ofstream file(temporary, std::ios::binary | std::ios::trunc);
+            const std::int64_t fields[5] = {n, width, panels, sign, static_cast<std::int64_t>(rowSwaps.size())};
+            file.write("OOCLUCKP", 8);
+            file.write(reinterpret_cast<const char*>(fields), sizeof(fields));
+            file.write(reinterpret_cast<const char*>(&logAbs), sizeof(logAbs));
+            file.write(reinterpret_cast<const char*>(rowSwaps.data()), rowSwaps.size() * sizeof(int));
+            file.flush();
+            if (!file) {
+                return false;
+            }
+        }
+        std::remove(CheckpointPath(path).c_str());
+        return std::rename(temporary.c_str(), CheckpointPath(path).c_str()) == 0;
+    }
+
+    // Restaurar o estado do último checkpoint (ou do início, se não houver)
+    void LoadCheckpoint() {
+        const int n = Size();
+        pivots.resize(n);
+        for (int r = 0; r < n; r++) {
+            pivots[r] = r;
+        }
+        factoredPanels = 0;
+        singularColumn = -1;
+        logAbsDeterminant = 0.0;
+        determinantSign = 1;
+
+        std::ifstream file(CheckpointPath(path), std::ios::binary);
+        char magic[8];
+        std::int64_t fields[5];
+        double logAbs = 0.0;
+        if (!file.read(magic, 8) || std::memcmp(magic, "OOCLUCKP", 8) != 0 ||
+            !file.read(reinterpret_cast<char*>(fields), sizeof(fields)) ||
+            !file.read(reinterpret_cast<char*>(&logAbs), sizeof(logAbs)) || fields[0] != n ||
+            fields[1] != PanelWidth() || fields[4] != n || fields[2] < 0 || fields[2] > PanelCount()) {
+            return;
+        }
+        std::vector<int> rowSwaps(n);
+        if (!file.read(reinterpret_cast<char*>(rowSwaps.data()), n * sizeof(int))) {
+            return;
+        }
+        pivots.swap(rowSwaps);
+        factoredPanels = static_cast<int>(fields[2]);
+        determinantSign = static_cast<int>(fields[3]);
+        logAbsDeterminant = logAbs;
+    }
+
+    // Aplicar a current (painel j) o painel de fatores k < j
+    void ApplyLeftPanel(DenseMatrix& left, int k, int j, DenseMatrix& current, ThreadPool* pool) const {
+        const int n = Size();
+        const int width = PanelWidth();
+        const int k0 = k * width;
+        const int kEnd = k0 + width;
+
+        // Trocas dos painéis k+1..j-1, posteriores à gravação deste L
+        for (int r = kEnd; r < j * width; r++) {
+            left.SwapRows(r, pivots[r]);
+        }
+
+        // U_kj = L_kk⁻¹·A_kj (L_kk triangular inferior unitária)
+        const int cols = current.Cols();
+        for (int i = k0 + 1; i < kEnd; i++) {
+            const double* multipliers = left.Row(i);
+            for (int p = k0; p < i; p++) {
+                if (multipliers[p - k0] != 0.0) {
+                    SimdAxpy(cols, -multipliers[p - k0], current.Row(p), current.Row(i));
+                }
+            }
+        }
+
+        // A_j[abaixo] -= L_k[abaixo]·U_kj
+        const int colsFull = (cols / NR) * NR;
+        ParallelFor(pool, kEnd, n, 2 * MR, [&](int rowBegin, int rowEnd) {
+            int i = rowBegin;
+            for (; i + MR <= rowEnd; i += MR) {
+                for (int c = 0; c < colsFull; c += NR) {
+                    SimdGemm4x8(width, &left(i, 0), left.Stride(), &current(k0, c), current.Stride(), &current(i, c),
+                                current.Stride());
+                }
+                if (colsFull < cols) {
+                    for (int r = i; r < i + MR; r++) {
+                        for (int p = 0; p < width; p++) {
+                            SimdAxpy(cols - colsFull, -left(r, p), &current(k0 + p, colsFull), &current(r, colsFull));
+                        }
+                    }
+                }
+            }
+            for (; i < rowEnd; i++) {
+                for (int p = 0; p < width; p++) {
+                    if (left(i, p) != 0.0) {
+                        SimdAxpy(cols, -left(i, p), current.Row(k0 + p), current.Row(i));
+                    }
+                }
+            }
+        });
+    }
+
+    // Fatorar as linhas [j·w, n) do painel j com pivoteamento parcial.
+    // Retorna a coluna global sem pivô ou -1; logAbs e sign recebem a
+    // contribuição do painel para o determinante.
+    int FactorPanel(DenseMatrix& current, int j, double tolerance, double& logAbs, int& sign, ThreadPool* pool) {
+        const int n = Size();
+        const int r0 = j * PanelWidth();
+        const int cols = current.Cols();
+        for (int c = 0; c < cols; c++) {
+            const int k = r0 + c;
+            const int pivotRow = k + SimdIndexOfMaxAbs(n - k, &current(k, c), current.Stride());
+            const double pivot = current(pivotRow, c);
+            if (!(std::abs(pivot) > tolerance)) {
+                return k;
+            }
+            pivots[k] = pivotRow;
+            current.SwapRows(k, pivotRow);
+            logAbs += std::log(std::abs(pivot));
+            if ((pivot < 0.0) != (pivotRow != k)) {
+                sign = -sign;
+            }
+
+            const double* pivotData = current.Row(k);
+            const double inversePivot = 1.0 / pivot;
+            ParallelFor(pool, k + 1, n, PANEL_MIN_ROWS, [&](int rowBegin, int rowEnd) {
+                for (int i = rowBegin; i < rowEnd; i++) {
+                    double* rowData = current.Row(i);
+                    const double factor = rowData[c] * inversePivot;
+                    rowData[c] = factor;
+                    if (factor != 0.0) {
+                        SimdAxpy(cols - c - 1, -factor, pivotData + c + 1, rowData + c + 1);
+                    }
+                }
+            });
+        }
+        return -1;
+    }
+
+    static double Dot(int n, const double* x, const double* y) {
+        double sum = 0.0;
+        for (int i = 0; i < n; i++) {
+            sum += x[i] * y[i];
+        }
+        return sum;
+    }
+
+public:
+    OutOfCoreLU() = default;
+    OutOfCoreLU(const OutOfCoreLU&) = delete;
+    OutOfCoreLU& operator=(const OutOfCoreLU&) = delete;
+
+    // Criar o armazenamento de uma matriz n x n zerada em path (fatores em
+    // path + ".lu"). A largura dos painéis é arredondada para múltiplo de 8.
+    bool Create(const std::string& storePath, int n, int panelWidth = DEFAULT_PANEL_WIDTH) {
+        const int width = std::max(8, (std::min(panelWidth, n) + 7) / 8 * 8);
+        path = storePath;
+        std::remove(CheckpointPath(path).c_str());
+        if (n <= 0 || !matrixFile.Create(path, "OOCLUMAT", n, width) ||
+            !factorFile.Create(FactorPath(path), "OOCLUFAC", n, width)) {
+            return false;
+        }
+        LoadCheckpoint();
+        return true;
+    }
+
+    // Abrir um armazenamento existente, retomando do último checkpoint
+    bool Open(const std::string& storePath) {
+        path = storePath;
+        if (!matrixFile.Open(path, "OOCLUMAT")) {
+            return false;
+        }
+        if (!factorFile.Open(FactorPath(path), "OOCLUFAC") || factorFile.Size() != matrixFile.Size() ||
+            factorFile.PanelWidth() != matrixFile.PanelWidth()) {
+            std::remove(CheckpointPath(path).c_str());
+            if (!factorFile.Create(FactorPath(path), "OOCLUFAC", matrixFile.Size(), matrixFile.PanelWidth())) {
+                return false;
+            }
+        }
+        LoadCheckpoint();
+        return true;
+    }
+
+    // Apagar os arquivos de um armazenamento (matriz, fatores e checkpoint)
+    static void Remove(const std::string& storePath) {
+        std::remove(storePath.c_str());
+        std::remove(FactorPath(storePath).c_str());
+        std::remove(CheckpointPath(storePath).c_str());
+    }
+
+    int Size() const { return matrixFile.Size(); }
+    int PanelWidth() const { return matrixFile.PanelWidth(); }
+    int PanelCount() const { return Size() == 0 ? 0 : (Size() + PanelWidth() - 1) / PanelWidth(); }
+    int FactoredPanels() const { return factoredPanels; }
+    bool IsFactored() const { return Size() > 0 && factoredPanels == PanelCount(); }
+    int SingularColumn() const { return singularColumn; }
+    const std::vector<int>& Pivots() const { return pivots; }
+
+    // ln|det(A)| e sinal, válidos depois de fatorar
+    double LogAbsDeterminant() const { return logAbsDeterminant; }
+    int DeterminantSign() const { return determinantSign; }
+
+    // Memória de trabalho da fatoração: cinco painéis
+    std::size_t WorkingSetBytes() const {
+        return 5 * static_cast<std::size_t>(Size()) * PanelWidth() * sizeof(double);
+    }
+
+    // Gravar block na posição (row, col) da matriz. Editar a matriz descarta
+    // a fatoração e o checkpoint.
+    bool WriteBlock(int row, int col, const DenseMatrix& block) {
+        const int n = Size();
+        if (row < 0 || col < 0 || row + block.Rows() > n || col + block.Cols() > n) {
+            return false;
+        }
+        if (factoredPanels > 0) {
+            Discard();
+        }
+        const int width = PanelWidth();
+        for (int i = 0; i < block.Rows(); i++) {
+            for (int c = 0; c < block.Cols();) {
+                const int global = col + c;
+                const int count = std::min(block.Cols() - c, (global / width + 1) * width - global);
+                if (!matrixFile.WriteSegment(row + i, global, block.Row(i) + c, count)) {
+                    return false;
+                }
+                c += count;
+            }
+        }
+        return matrixFile.Flush();
+    }
+
+    // Descartar a fatoração e o checkpoint (a próxima Factor() começa do zero)
+    void Discard() {
+        std::remove(CheckpointPath(path).c_str());
+        LoadCheckpoint();
+    }
+
+    // Fatorar a partir do último checkpoint. panelLimit >= 0 para depois de
+    // tantos painéis (INCOMPLETE); a próxima chamada continua dali.
+    Status Factor(ThreadPool* pool = nullptr, double tolerance = DEFAULT_TOLERANCE, int panelLimit = -1) {
+        if (!matrixFile.IsOpen() || !factorFile.IsOpen()) {
+            return Status::IO_ERROR;
+        }
+        const int n = Size();
+        const int width = PanelWidth();
+        const int panels = PanelCount();
+        const int stop = panelLimit < 0 ? panels : std::min(panels, factoredPanels + panelLimit);
+        singularColumn = -1;
+
+        DenseMatrix current;
+        DenseMatrix next;
+        DenseMatrix left[2];
+        DenseMatrix pending;
+        std::future<bool> nextRead;
+        std::future<bool> leftRead[2];
+        std::future<bool> pendingWrite;
+        IoThread io; // Depois dos buffers: é destruída (e esvazia a fila) antes deles
+
+        Status status = Status::SUCCESS;
+        int j = factoredPanels;
+        if (j < stop) {
+            nextRead = io.Submit([this, &next, j] { return matrixFile.Read(j, next); });
+        }
+        for (; j < stop && status == Status::SUCCESS; j++) {
+            if (!nextRead.get()) {
+                status = Status::IO_ERROR;
+                break;
+            }
+            current.Swap(next);
+            if (j > 0) {
+                leftRead[0] = io.Submit([this, &left] { return factorFile.Read(0, left[0]); });
+            } else if (j + 1 < stop) {
+                nextRead = io.Submit([this, &next, j] { return matrixFile.Read(j + 1, next); });
+            }
+
+            // Trocas de linha de todos os painéis anteriores
+            for (int r = 0; r < j * width; r++) {
+                current.SwapRows(r, pivots[r]);
+            }
+
+            // Painéis de fatores à esquerda, com o seguinte já sendo lido
+            for (int k = 0; k < j; k++) {
+                const int slot = k % 2;
+                if (k + 1 < j) {
+                    leftRead[1 - slot] = io.Submit([this, &left, k, slot] { return factorFile.Read(k + 1, left[1 - slot]); });
+                } else if (j + 1 < stop) {
+                    nextRead = io.Submit([this, &next, j] { return matrixFile.Read(j + 1, next); });
+                }
+                if (!leftRead[slot].get()) {
+                    status = Status::IO_ERROR;
+                    break;
+                }
+                ApplyLeftPanel(left[slot], k, j, current, pool);
+            }
+            if (status != Status::SUCCESS) {
+                break;
+            }
+
+            double panelLogAbs = 0.0;
+            int panelSign = 1;
+            singularColumn = FactorPanel(current, j, tolerance, panelLogAbs, panelSign, pool);
+            if (singularColumn != -1) {
+                status = Status::SINGULAR;
+                break;
+            }
+            logAbsDeterminant += panelLogAbs;
+            determinantSign *= panelSign;
+
+            // Gravação adiada do painel e do checkpoint (um buffer por vez)
+            if (pendingWrite.valid() && !pendingWrite.get()) {
+                status = Status::IO_ERROR;
+                break;
+            }
+            factoredPanels = j;
+            pending.Swap(current);
+            pendingWrite = io.Submit([this, &pending, n, width, j, logAbs = logAbsDeterminant,
+                                      sign = determinantSign, rowSwaps = pivots] {
+                return factorFile.Write(j, pending) && factorFile.Flush() &&
+                       WriteCheckpoint(path, n, width, j + 1, logAbs, sign, rowSwaps);
+            });
+        }
+
+        // Esperar a última gravação antes de dar o painel como pronto
+        if (pendingWrite.valid()) {
+            if (pendingWrite.get()) {
+                factoredPanels++;
+            } else if (status == Status::SUCCESS) {
+                status = Status::IO_ERROR;
+            }
+        }
+        if (status == Status::IO_ERROR || status == Status::SINGULAR) {
+            const int column = singularColumn;
+            LoadCheckpoint();
+            singularColumn = column;
+            return status;
+        }
+        return factoredPanels == panels ? Status::SUCCESS : Status::INCOMPLETE;
+    }
+
+    // Resolver A·x = b in-place lendo os fatores painel a painel (duas
+    // passagens pelo arquivo, com leitura antecipada)
+    bool Solve(std::vector<double>& b) {
+        const int n = Size();
+        if (!IsFactored() || static_cast<int>(b.size()) != n) {
+            return false;
+        }
+        const int width = PanelWidth();
+        const int panels = PanelCount();
+
+        DenseMatrix buffers[2];
+        std::future<bool> reads[2];
+        IoThread io;
+
+        for (int r = 0; r < n; r++) {
+            std::swap(b[r], b[pivots[r]]);
+        }
+
+        // L·y = P·b
+        reads[0] = io.Submit([this, &buffers] { return factorFile.Read(0, buffers[0]); });
+        for (int k = 0; k < panels; k++) {
+            const int slot = k % 2;
+            if (k + 1 < panels) {
+                reads[1 - slot] = io.Submit([this, &buffers, k, slot] { return factorFile.Read(k + 1, buffers[1 - slot]); });
+            }
+            if (!reads[slot].get()) {
+                return false;
+            }
+            DenseMatrix& panel = buffers[slot];
+            const int k0 = k * width;
+            const int kEnd = k0 + panel.Cols();
+            for (int r = kEnd; r < n; r++) {
+                panel.SwapRows(r, pivots[r]);
+            }
+            for (int i = k0 + 1; i < kEnd; i++) {
+                b[i] -= Dot(i - k0, panel.Row(i), &b[k0]);
+            }
+            for (int i = kEnd; i < n; i++) {
+                b[i] -= Dot(kEnd - k0, panel.Row(i), &b[k0]);
+            }
+        }
+
+        // U·x = y, do último painel para o primeiro
+        reads[0] = io.Submit([this, &buffers, panels] { return factorFile.Read(panels - 1, buffers[0]); });
+        for (int k = panels - 1, step = 0; k >= 0; k--, step++) {
+            const int slot = step % 2;
+            if (k > 0) {
+                reads[1 - slot] = io.Submit([this, &buffers, k, slot] { return factorFile.Read(k - 1, buffers[1 - slot]); });
+            }
+            if (!reads[slot].get()) {
+                return false;
+            }
+            const DenseMatrix& panel = buffers[slot];
+            const int k0 = k * width;
+            const int kb = panel.Cols();
+            for (int i = k0 + kb - 1; i >= k0; i--) {
+                const double* row = panel.Row(i);
+                const int local = i - k0;
+                b[i] = (b[i] - Dot(kb - local - 1, row + local + 1, &b[i + 1])) / row[local];
+            }
+            for (int i = 0; i < k0; i++) {
+                b[i] -= Dot(kb, panel.Row(i), &b[k0]);
+            }
+        }
+        return true;
+    }
+
+    // y = A·x lendo a matriz original painel a painel (verificação do resíduo)
+    bool Multiply(const std::vector<double>& x, std::vector<double>& y) {
+        const int n = Size();
+        if (static_cast<int>(x.size()) != n) {
+            return false;
+        }
+        y.assign(n, 0.0);
+        DenseMatrix buffers[2];
+        std::future<bool> reads[2];
+        IoThread io;
+        const int panels = PanelCount();
+        reads[0] = io.Submit([this, &buffers] { return matrixFile.Read(0, buffers[0]); });
+        for (int k = 0; k < panels; k++) {
+            const int slot = k % 2;
+            if (k + 1 < panels) {
+                reads[1 - slot] = io.Submit([this, &buffers, k, slot] { return matrixFile.Read(k + 1, buffers[1 - slot]); });
+            }
+            if (!reads[slot].get()) {
+                return false;
+            }
+            const DenseMatrix& panel = buffers[slot];
+            const double* xPanel = &x[static_cast<std::size_t>(k) * PanelWidth()];
+            for (int i = 0; i < n; i++) {
+                y[i] += Dot(panel.Cols(), panel.Row(i), xPanel);
+            }
+        }
+        return true;
+    }
+};
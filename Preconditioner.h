@@ -0,0 +1,403 @@
+#pragma once
+#include <vector>
+#include <cmath>
+#include <cstdint>
+#include <algorithm>
+#include <queue>
+#include <functional>
+#include "SparseMatrix.h"
+
+// Precondicionadores para os métodos iterativos: aproximações M ≈ A
+// cuja aplicação z = M⁻¹·r é barata. Construídos uma vez por sistema (Setup)
+// e aplicados a cada iteração (Apply).
+class Preconditioner {
+public:
+    enum class Type {
+        NONE,                // Identidade
+        JACOBI,              // Diagonal de A
+        BLOCK_JACOBI,        // Blocos diagonais densos de A
+        INCOMPLETE_CHOLESKY, // IC(0): Cholesky restrita ao padrão de A (SPD)
+        INCOMPLETE_LU,       // ILU(0): LU restrita ao padrão de A
+        ILUT                 // LU incompleta com limiar de descarte e preenchimento limitado
+    };
+
+    static constexpr int DEFAULT_BLOCK_SIZE = 4;
+    static constexpr double DEFAULT_DROP_TOLERANCE = 1e-4;
+    static constexpr int DEFAULT_FILL_PER_ROW = 10;
+
+private:
+    static constexpr double EPSILON = 1e-10;
+    static constexpr double INITIAL_SHIFT = 1e-3;
+    static constexpr int MAX_SHIFT_ATTEMPTS = 10;
+
+    Type type = Type::NONE;
+    int n = 0;
+
+    // Jacobi: inverso da diagonal
+    std::vector<double> inverseDiagonal;
+
+    // Block-Jacobi: LU densa de cada bloco (com pivôs), blocos de blockSize linhas
+    int blockSize = DEFAULT_BLOCK_SIZE;
+    std::vector<double> blockFactors;
+    std::vector<int> blockPivots;
+
+    // IC(0): fator L em CSR (linhas ordenadas, diagonal como última entrada)
+    std::vector<std::int64_t> lowerPointers;
+    std::vector<int> lowerIndices;
+    std::vector<double> lowerValues;
+
+    // ILU: L estritamente inferior (diagonal unitária) e U estritamente
+    // superior em CSR, diagonal de U separada
+    std::vector<std::int64_t> iluLowerPointers;
+    std::vector<int> iluLowerIndices;
+    std::vector<double> iluLowerValues;
+    std::vector<std::int64_t> iluUpperPointers;
+    std::vector<int> iluUpperIndices;
+    std::vector<double> iluUpperValues;
+    std::vector<double> iluDiagonal;
+
+    bool SetupJacobi(const SparseMatrix& matrix) {
+        inverseDiagonal.assign(n, 0.0);
+        for (int i = 0; i < n; i++) {
+            double diagonal = matrix.At(i, i);
+            if (!(std::abs(diagonal) > EPSILON)) {
+                return false;
+            }
+            inverseDiagonal[i] = 1.0 / diagonal;
+        }
+        return true;
+    }
+
+    bool SetupBlockJacobi(const SparseMatrix& matrix) {
+        const auto& rowPointers = matrix.RowPointers();
+        const auto& columnIndices = matrix.ColumnIndices();
+        const auto& values = matrix.Values();
+        const int blockCount = (n + blockSize - 1) / blockSize;
+        blockFactors.assign(static_cast<std::size_t>(blockCount) * blockSize * blockSize, 0.0);
+        blockPivots.assign(static_cast<std::size_t>(blockCount) * blockSize, 0);
+
+        for (int block = 0; block < blockCount; block++) {
+            const int first = block * blockSize;
+            const int size = std::min(blockSize, n - first);
+            double* a = blockFactors.data() + static_cast<std::size_t>(block) * blockSize * blockSize;
+            int* pivots = blockPivots.data() + static_cast<std::size_t>(block) * blockSize;
+
+            for (int i = 0; i < size; i++) {
+                for (std::int64_t p = rowPointers[first + i]; p < rowPointers[first + i + 1]; p++) {
+                    int j = columnIndices[p] - first;
+                    if (j >= 0 && j < size) {
+                        a[i * blockSize + j] = values[p];
+                    }
+                }
+            }
+
+            // LU com pivoteamento parcial do bloco
+            for (int k = 0; k < size; k++) {
+                int pivotRow = k;
+                for (int i = k + 1; i < size; i++) {
+                    if (std::abs(a[i * blockSize + k]) > std::abs(a[pivotRow * blockSize + k])) {
+                        pivotRow = i;
+                    }
+                }
+                if (!(std::abs(a[pivotRow * blockSize + k]) > EPSILON)) {
+                    return false;
+                }
+                pivots[k] = pivotRow;
+                if (pivotRow != k) {
+                    std::swap_ranges(a + k * blockSize, a + k * blockSize + size, a + pivotRow * blockSize);
+                }
+                for (int i = k + 1; i < size; i++) {
+                    double factor = a[i * blockSize + k] / a[k * blockSize + k];
+                    a[i * blockSize + k] = factor;
+                    for (int j = k + 1; j < size; j++) {
+                        a[i * blockSize + j] -= factor * a[k * blockSize + j];
+                    }
+                }
+            }
+        }
+        return true;
+    }
+
+    // IC(0) linha a linha: L_ik = (a_ik - Σ L_ij·L_kj) / L_kk no padrão de tril(A).
+    // Se um pivô não for positivo, repete com A + shift·diag(A) (deslocamento de
+    // Manteuffel), dobrando o shift a cada tentativa.
+    bool SetupIncompleteCholesky(const SparseMatrix& matrix) {
+        const auto& rowPointers = matrix.RowPointers();
+        const auto& columnIndices = matrix.ColumnIndices();
+        const auto& values = matrix.Values();
+
+        lowerPointers.assign(n + 1, 0);
+        lowerIndices.clear();
+        std::vector<double> original;
+        for (int i = 0; i < n; i++) {
+            for (std::int64_t p = rowPointers[i]; p < rowPointers[i + 1]; p++) {
+                if (columnIndices[p] <= i) {
+                    lowerIndices.push_back(columnIndices[p]);
+                    original.push_back(values[p]);
+                }
+            }
+            lowerPointers[i + 1] = static_cast<std::int64_t>(lowerIndices.size());
+            if (lowerIndices.empty() || lowerIndices.back() != i) {
+                return false; // Diagonal ausente
+            }
+        }
+
+        double shift = 0.0;
+        for (int attempt = 0; attempt <= MAX_SHIFT_ATTEMPTS; attempt++) {
+            lowerValues = original;
+            if (FactorIncompleteCholesky(shift)) {
+                return true;
+            }
+            shift = shift == 0.0 ? INITIAL_SHIFT : shift * 2.0;
+        }
+        return false;
+    }
+
+    bool FactorIncompleteCholesky(double shift) {
+        for (int i = 0; i < n; i++) {
+            const std::int64_t rowBegin = lowerPointers[i];
+            const std::int64_t diagonalPosition = lowerPointers[i + 1] - 1;
+
+            for (std::int64_t p = rowBegin; p < diagonalPosition; p++) {
+                const int k = lowerIndices[p];
+                // Produto esparso das linhas i e k restrito às colunas < k
+                double sum = lowerValues[p];
+                std::int64_t q = lowerPointers[k];
+                const std::int64_t kDiagonal = lowerPointers[k + 1] - 1;
+                for (std::int64_t r = rowBegin; r < p && q < kDiagonal; ) {
+                    if (lowerIndices[r] == lowerIndices[q]) {
+                        sum -= lowerValues[r++] * lowerValues[q++];
+                    } else if (lowerIndices[r] < lowerIndices[q]) {
+                        r++;
+                    } else {
+                        q++;
+                    }
+                }
+                lowerValues[p] = sum / lowerValues[kDiagonal];
+            }
+
+            double diagonal = lowerValues[diagonalPosition] * (1.0 + shift);
+            for (std::int64_t p = rowBegin; p < diagonalPosition; p++) {
+                diagonal -= lowerValues[p] * lowerValues[p];
+            }
+            if (!(diagonal > 0.0)) {
+                return false;
+            }
+            lowerValues[diagonalPosition] = std::sqrt(diagonal);
+        }
+        return true;
+    }
+
+    // LU incompleta linha a linha (variante IKJ). Com fixedPattern só as
+    // posições de A são atualizadas (ILU(0)) e pivô nulo é falha. Sem ele (ILUT),
+    // entradas menores que dropTolerance·||a_i|| são descartadas, cada linha
+    // mantém as fillPerRow maiores entradas de L e de U e pivôs pequenos são
+    // substituídos pelo limiar da linha.
+    bool SetupIncompleteLU(const SparseMatrix& matrix, bool fixedPattern, double dropTolerance, int fillPerRow) {
+        const auto& rowPointers = matrix.RowPointers();
+        const auto& columnIndices = matrix.ColumnIndices();
+        const auto& values = matrix.Values();
+
+        iluLowerPointers.assign(n + 1, 0);
+        iluUpperPointers.assign(n + 1, 0);
+        iluLowerIndices.clear();
+        iluLowerValues.clear();
+        iluUpperIndices.clear();
+        iluUpperValues.clear();
+        iluDiagonal.assign(n, 0.0);
+
+        std::vector<double> work(n, 0.0);
+        std::vector<int> present(n, -1);   // Linha em que a coluna entrou no padrão
+        std::vector<int> pattern;
+        std::vector<std::pair<double, int>> candidates;
+        std::priority_queue<int, std::vector<int>, std::greater<int>> pending;
+
+        for (int i = 0; i < n; i++) {
+            pattern.clear();
+            double rowNorm = 0.0;
+            for (std::int64_t p = rowPointers[i]; p < rowPointers[i + 1]; p++) {
+                int j = columnIndices[p];
+                present[j] = i;
+                work[j] = values[p];
+                pattern.push_back(j);
+                rowNorm += values[p] * values[p];
+                if (j < i) pending.push(j);
+            }
+            const double threshold = fixedPattern ? 0.0 : dropTolerance * std::sqrt(rowNorm);
+
+            // Eliminar as colunas k < i em ordem crescente
+            while (!pending.empty()) {
+                const int k = pending.top();
+                pending.pop();
+                const double factor = work[k] / iluDiagonal[k];
+                if (!fixedPattern && std::abs(factor) < threshold) {
+                    work[k] = 0.0;
+                    continue;
+                }
+                work[k] = factor;
+                for (std::int64_t p = iluUpperPointers[k]; p < iluUpperPointers[k + 1]; p++) {
+                    const int j = iluUpperIndices[p];
+                    if (present[j] != i) {
+                        if (fixedPattern) continue;
+                        present[j] = i;
+                        work[j] = 0.0;
+                        pattern.push_back(j);
+                        if (j < i) pending.push(j);
+                    }
+                    work[j] -= factor * iluUpperValues[p];
+                }
+            }
+
+            // Guardar a linha: as maiores entradas de L e de U (todas em ILU(0))
+            const int keep = fixedPattern ? n : fillPerRow;
+            for (int part = 0; part < 2; part++) {
+                candidates.clear();
+                for (int j : pattern) {
+                    bool inPart = part == 0 ? j < i : j > i;
+                    if (inPart && work[j] != 0.0 && std::abs(work[j]) >= threshold) {
+                        candidates.push_back({std::abs(work[j]), j});
+                    }
+                }
+                if (static_cast<int>(candidates.size()) > keep) {
+                    std::nth_element(candidates.begin(), candidates.begin() + keep, candidates.end(),
+                                     std::greater<std::pair<double, int>>());
+                    candidates.resize(keep);
+                }
+                std::sort(candidates.begin(), candidates.end(),
+                          [](const std::pair<double, int>& a, const std::pair<double, int>& b) { return a.second < b.second; });
+                for (const auto& candidate : candidates) {
+                    if (part == 0) {
+                        iluLowerIndices.push_back(candidate.second);
+                        iluLowerValues.push_back(work[candidate.second]);
+                    } else {
+                        iluUpperIndices.push_back(candidate.second);
+                        iluUpperValues.push_back(work[candidate.second]);
+                    }
+                }
+            }
+            iluLowerPointers[i + 1] = static_cast<std::int64_t>(iluLowerIndices.size());
+            iluUpperPointers[i + 1] = static_cast<std::int64_t>(iluUpperIndices.size());
+
+            double diagonal = present[i] == i ? work[i] : 0.0;
+            if (!(std::abs(diagonal) > EPSILON)) {
+                if (fixedPattern) {
+                    return false;
+                }
+                const double replacement = std::max(threshold, EPSILON);
+                diagonal = diagonal < 0.0 ? -replacement : replacement;
+            }
+            iluDiagonal[i] = diagonal;
+
+            for (int j : pattern) {
+                work[j] = 0.0;
+            }
+        }
+        return true;
+    }
+
+public:
+    Type GetType() const { return type; }
+
+    // Construir para a matriz dada; retorna false se o precondicionador não
+    // existir (diagonal ou bloco singular, IC(0) sem pivô positivo, ILU(0) com
+    // pivô nulo)
+    bool Setup(const SparseMatrix& matrix, Type value, int blockSizeValue = DEFAULT_BLOCK_SIZE,
+               double dropTolerance = DEFAULT_DROP_TOLERANCE, int fillPerRow = DEFAULT_FILL_PER_ROW) {
+        type = value;
+        n = matrix.Rows();
+        blockSize = std::max(1, blockSizeValue);
+
+        switch (type) {
+            case Type::JACOBI:
+                return SetupJacobi(matrix);
+            case Type::BLOCK_JACOBI:
+                return SetupBlockJacobi(matrix);
+            case Type::INCOMPLETE_CHOLESKY:
+                return SetupIncompleteCholesky(matrix);
+            case Type::INCOMPLETE_LU:
+                return SetupIncompleteLU(matrix, true, 0.0, n);
+            case Type::ILUT:
+                return SetupIncompleteLU(matrix, false, dropTolerance, std::max(0, fillPerRow));
+            default:
+                return true;
+        }
+    }
+
+    // z = M⁻¹·r
+    void Apply(const double* r, double* z) const {
+        switch (type) {
+            case Type::JACOBI:
+                for (int i = 0; i < n; i++) {
+                    z[i] = inverseDiagonal[i] * r[i];
+                }
+                break;
+
+            case Type::BLOCK_JACOBI:
+                for (int first = 0, block = 0; first < n; first += blockSize, block++) {
+                    const int size = std::min(blockSize, n - first);
+                    const double* a = blockFactors.data() + static_cast<std::size_t>(block) * blockSize * blockSize;
+                    const int* pivots = blockPivots.data() + static_cast<std::size_t>(block) * blockSize;
+                    double* y = z + first;
+                    std::copy(r + first, r + first + size, y);
+                    for (int k = 0; k < size; k++) {
+                        std::swap(y[k], y[pivots[k]]);
+                    }
+                    for (int k = 0; k < size; k++) {
+                        for (int i = k + 1; i < size; i++) {
+                            y[i] -= a[i * blockSize + k] * y[k];
+                        }
+                    }
+                    for (int i = size - 1; i >= 0; i--) {
+                        for (int j = i + 1; j < size; j++) {
+                            y[i] -= a[i * blockSize + j] * y[j];
+                        }
+                        y[i] /= a[i * blockSize + i];
+                    }
+                }
+                break;
+
+            case Type::INCOMPLETE_CHOLESKY:
+                // L·y = r por linhas, depois Lᵀ·z = y espalhando pelas linhas de L
+                for (int i = 0; i < n; i++) {
+                    double sum = r[i];
+                    const std::int64_t diagonalPosition = lowerPointers[i + 1] - 1;
+                    for (std::int64_t p = lowerPointers[i]; p < diagonalPosition; p++) {
+                        sum -= lowerValues[p] * z[lowerIndices[p]];
+                    }
+                    z[i] = sum / lowerValues[diagonalPosition];
+                }
+                for (int i = n - 1; i >= 0; i--) {
+                    const std::int64_t diagonalPosition = lowerPointers[i + 1] - 1;
+                    z[i] /= lowerValues[diagonalPosition];
+                    const double value = z[i];
+                    for (std::int64_t p = lowerPointers[i]; p < diagonalPosition; p++) {
+                        z[lowerIndices[p]] -= lowerValues[p] * value;
+                    }
+                }
+                break;
+
+            case Type::INCOMPLETE_LU:
+            case Type::ILUT:
+                // L·y = r (diagonal unitária), depois U·z = y
+                for (int i = 0; i < n; i++) {
+                    double sum = r[i];
+                    for (std::int64_t p = iluLowerPointers[i]; p < iluLowerPointers[i + 1]; p++) {
+                        sum -= iluLowerValues[p] * z[iluLowerIndices[p]];
+                    }
+                    z[i] = sum;
+                }
+                for (int i = n - 1; i >= 0; i--) {
+                    double sum = z[i];
+                    for (std::int64_t p = iluUpperPointers[i]; p < iluUpperPointers[i + 1]; p++) {
+                        sum -= iluUpperValues[p] * z[iluUpperIndices[p]];
+                    }
+                    z[i] = sum / iluDiagonal[i];
+                }
+                break;
+
+            default:
+                std::copy(r, r + n, z);
+                break;
+        }
+    }
+};
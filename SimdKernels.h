@@ -0,0 +1,797 @@
+#pragma once
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+// Kernels vetoriais usados pela eliminação (AXPY, escala, busca de pivô e o
+// micro-kernel 4x8 da LU em blocos), pela eliminação modular (atualização de
+// linha em Montgomery de 32 bits) e o hash dos dados da cache de soluções.
+// Cada kernel existe em versão escalar, SSE2, AVX2+FMA e AVX-512; a versão
+// usada é escolhida uma única vez em tempo de execução via CPUID, de modo que
+// o mesmo executável aproveita o maior conjunto de instruções disponível em
+// cada máquina.
+#if (defined(__GNUC__) || defined(__clang__)) && (defined(__x86_64__) || defined(__i386__))
+#define LINEAR_SOLVER_SIMD_X86 1
+#include <immintrin.h>
+#endif
+
+enum class SimdLevel {
+    SCALAR,
+    SSE2,
+    AVX2,
+    AVX512
+};
+
+namespace SimdDetail {
+
+    // ---------- Versões escalares (referência e fallback) ----------
+
+    inline void AxpyScalar(int n, double alpha, const double* x, double* y) {
+        for (int i = 0; i < n; i++) {
+            y[i] += alpha * x[i];
+        }
+    }
+
+    inline void ScaleScalar(int n, double alpha, double* x) {
+        for (int i = 0; i < n; i++) {
+            x[i] *= alpha;
+        }
+    }
+
+    inline int IndexOfMaxAbsScalar(int n, const double* x, std::ptrdiff_t stride) {
+        int best = 0;
+        double maxAbs = n > 0 ? std::abs(x[0]) : 0.0;
+        for (int i = 1; i < n; i++) {
+            double currentAbs = std::abs(x[i * stride]);
+            if (currentAbs > maxAbs) {
+                maxAbs = currentAbs;
+                best = i;
+            }
+        }
+        return best;
+    }
+
+    // C[4x8] -= A[4xkb] · B[kbx8]; linhas com passos lda, ldb, ldc
+    inline void Gemm4x8Scalar(int kb, const double* a, std::ptrdiff_t lda,
+                              const double* b, std::ptrdiff_t ldb,
+                              double* c, std::ptrdiff_t ldc) {
+        double acc[4][8];
+        for (int r = 0; r < 4; r++) {
+            for (int j = 0; j < 8; j++) {
+                acc[r][j] = c[r * ldc + j];
+            }
+        }
+        for (int p = 0; p < kb; p++) {
+            const double* bRow = b + p * ldb;
+            for (int r = 0; r < 4; r++) {
+                const double factor = a[r * lda + p];
+                for (int j = 0; j < 8; j++) {
+                    acc[r][j] -= factor * bRow[j];
+                }
+            }
+        }
+        for (int r = 0; r < 4; r++) {
+            for (int j = 0; j < 8; j++) {
+                c[r * ldc + j] = acc[r][j];
+            }
+        }
+    }
+
+    // Redução de Montgomery com R = 2^32: t·R⁻¹ mod p para t < p·R, p ímpar
+    // menor que 2^31 e negativeInverse = -p⁻¹ mod 2^32
+    inline std::uint32_t MontgomeryReduce32(std::uint64_t t, std::uint32_t modulus, std::uint32_t negativeInverse) {
+        const std::uint32_t m = static_cast<std::uint32_t>(t) * negativeInverse;
+        const std::uint32_t r = static_cast<std::uint32_t>((t + static_cast<std::uint64_t>(m) * modulus) >> 32);
+        return r >= modulus ? r - modulus : r;
+    }
+
+    // y <- y - factor·x mod p, tudo em forma de Montgomery
+    inline void SubMulModScalar(int n, std::uint32_t factor, const std::uint32_t* x, std::uint32_t* y,
+                                std::uint32_t modulus, std::uint32_t negativeInverse) {
+        for (int i = 0; i < n; i++) {
+            const std::uint32_t r = MontgomeryReduce32(static_cast<std::uint64_t>(factor) * x[i], modulus, negativeInverse);
+            y[i] = y[i] >= r ? y[i] - r : y[i] + modulus - r;
+        }
+    }
+
+    // Versões em float (LU em precisão simples da precisão mista)
+    inline void AxpyFloatScalar(int n, float alpha, const float* x, float* y) {
+        for (int i = 0; i < n; i++) {
+            y[i] += alpha * x[i];
+        }
+    }
+
+    inline void Gemm4x8FloatScalar(int kb, const float* a, std::ptrdiff_t lda,
+                                   const float* b, std::ptrdiff_t ldb,
+                                   float* c, std::ptrdiff_t ldc) {
+        float acc[4][8];
+        for (int r = 0; r < 4; r++) {
+            for (int j = 0; j < 8; j++) {
+                acc[r][j] = c[r * ldc + j];
+            }
+        }
+        for (int p = 0; p < kb; p++) {
+            const float* bRow = b + p * ldb;
+            for (int r = 0; r < 4; r++) {
+                const float factor = a[r * lda + p];
+                for (int j = 0; j < 8; j++) {
+                    acc[r][j] -= factor * bRow[j];
+                }
+            }
+        }
+        for (int r = 0; r < 4; r++) {
+            for (int j = 0; j < 8; j++) {
+                c[r * ldc + j] = acc[r][j];
+            }
+        }
+    }
+
+    // Hash de 64 bits dos bits de x (não dos valores: -0.0 e 0.0 diferem).
+    // Oito acumuladores de 32 bits consomem 32 bytes por passo, como as oito
+    // faixas de um registrador AVX2, e o resultado é o mesmo em todos os níveis.
+    constexpr std::uint32_t HASH_PRIME1 = 0x9E3779B1u;
+    constexpr std::uint32_t HASH_PRIME2 = 0x85EBCA77u;
+    constexpr int HASH_LANES = 8;
+
+    inline std::uint64_t HashMix(std::uint64_t h) {
+        h ^= h >> 30;
+        h *= 0xBF58476D1CE4E5B9ull;
+        h ^= h >> 27;
+        h *= 0x94D049BB133111EBull;
+        return h ^ (h >> 31);
+    }
+
+    inline std::uint32_t HashLaneSeed(std::uint64_t seed, int lane) {
+        return static_cast<std::uint32_t>(seed ^ (seed >> 32)) + HASH_PRIME1 * static_cast<std::uint32_t>(lane + 1);
+    }
+
+    // Juntar as faixas, as componentes que sobraram (n % 4) e o tamanho
+    inline std::uint64_t HashFinish(const std::uint32_t* lanes, const double* tail, int count,
+                                    int n, std::uint64_t seed) {
+        std::uint64_t h = HashMix(seed ^ (static_cast<std::uint64_t>(n) * HASH_PRIME2));
+        for (int i = 0; i < HASH_LANES; i++) {
+            h = HashMix(h ^ lanes[i]);
+        }
+        for (int i = 0; i < count; i++) {
+            std::uint64_t bits;
+            std::memcpy(&bits, tail + i, sizeof(bits));
+            h = HashMix(h ^ bits);
+        }
+        return h;
+    }
+
+    inline std::uint64_t HashScalar(const double* x, int n, std::uint64_t seed) {
+        std::uint32_t lanes[HASH_LANES];
+        for (int i = 0; i < HASH_LANES; i++) {
+            lanes[i] = HashLaneSeed(seed, i);
+        }
+        int i = 0;
+        for (; i + 4 <= n; i += 4) {
+            std::uint32_t words[HASH_LANES];
+            std::memcpy(words, x + i, sizeof(words));
+            for (int lane = 0; lane < HASH_LANES; lane++) {
+                const std::uint32_t value = lanes[lane] + words[lane] * HASH_PRIME2;
+                lanes[lane] = ((value << 13) | (value >> 19)) * HASH_PRIME1;
+            }
+        }
+        return HashFinish(lanes, x + i, n - i, n, seed);
+    }
+
+#ifdef LINEAR_SOLVER_SIMD_X86
+
+    // ---------- SSE2 ----------
+
+    __attribute__((target("sse2")))
+    inline void AxpyFloatSse2(int n, float alpha, const float* x, float* y) {
+        const __m128 a = _mm_set1_ps(alpha);
+        int i = 0;
+        for (; i + 8 <= n; i += 8) {
+            __m128 y0 = _mm_add_ps(_mm_loadu_ps(y + i), _mm_mul_ps(a, _mm_loadu_ps(x + i)));
+            __m128 y1 = _mm_add_ps(_mm_loadu_ps(y + i + 4), _mm_mul_ps(a, _mm_loadu_ps(x + i + 4)));
+            _mm_storeu_ps(y + i, y0);
+            _mm_storeu_ps(y + i + 4, y1);
+        }
+        for (; i < n; i++) {
+            y[i] += alpha * x[i];
+        }
+    }
+
+    __attribute__((target("sse2")))
+    inline void AxpySse2(int n, double alpha, const double* x, double* y) {
+        const __m128d a = _mm_set1_pd(alpha);
+        int i = 0;
+        for (; i + 4 <= n; i += 4) {
+            __m128d y0 = _mm_add_pd(_mm_loadu_pd(y + i), _mm_mul_pd(a, _mm_loadu_pd(x + i)));
+            __m128d y1 = _mm_add_pd(_mm_loadu_pd(y + i + 2), _mm_mul_pd(a, _mm_loadu_pd(x + i + 2)));
+            _mm_storeu_pd(y + i, y0);
+            _mm_storeu_pd(y + i + 2, y1);
+        }
+        for (; i < n; i++) {
+            y[i] += alpha * x[i];
+        }
+    }
+
+    __attribute__((target("sse2")))
+    inline void ScaleSse2(int n, double alpha, double* x) {
+        const __m128d a = _mm_set1_pd(alpha);
+        int i = 0;
+        for (; i + 2 <= n; i += 2) {
+            _mm_storeu_pd(x + i, _mm_mul_pd(a, _mm_loadu_pd(x + i)));
+        }
+        for (; i < n; i++) {
+            x[i] *= alpha;
+        }
+    }
+
+    // Busca de pivô em 2 faixas; sem gather no SSE2, colunas (stride > 1) são
+    // carregadas elemento a elemento. Os índices ficam em double (exatos)
+    __attribute__((target("sse2")))
+    inline int IndexOfMaxAbsSse2(int n, const double* x, std::ptrdiff_t stride) {
+        if (n < 8) {
+            return IndexOfMaxAbsScalar(n, x, stride);
+        }
+        const __m128d signMask = _mm_set1_pd(-0.0);
+        const __m128d two = _mm_set1_pd(2.0);
+        __m128d best = _mm_set1_pd(-1.0);
+        __m128d bestIndex = _mm_setzero_pd();
+        __m128d index = _mm_set_pd(1.0, 0.0);
+
+        int i = 0;
+        for (; i + 2 <= n; i += 2) {
+            const __m128d loaded = stride == 1 ? _mm_loadu_pd(x + i)
+                                               : _mm_set_pd(x[(i + 1) * stride], x[i * stride]);
+            const __m128d values = _mm_andnot_pd(signMask, loaded);
+            const __m128d greater = _mm_cmpgt_pd(values, best);
+            best = _mm_or_pd(_mm_and_pd(greater, values), _mm_andnot_pd(greater, best));
+            bestIndex = _mm_or_pd(_mm_and_pd(greater, index), _mm_andnot_pd(greater, bestIndex));
+            index = _mm_add_pd(index, two);
+        }
+
+        double lanes[2];
+        double lanesIndex[2];
+        _mm_storeu_pd(lanes, best);
+        _mm_storeu_pd(lanesIndex, bestIndex);
+
+        // Em caso de empate prevalece o menor índice, como na versão escalar
+        const int bestLane = lanes[1] > lanes[0] || (lanes[1] == lanes[0] && lanesIndex[1] < lanesIndex[0]) ? 1 : 0;
+        int result = static_cast<int>(lanesIndex[bestLane]);
+        double maxAbs = lanes[bestLane];
+        for (; i < n; i++) {
+            double currentAbs = std::abs(x[i * stride]);
+            if (currentAbs > maxAbs) {
+                maxAbs = currentAbs;
+                result = i;
+            }
+        }
+        return result;
+    }
+
+    // Montgomery de 32 bits em 4 faixas: _mm_mul_epu32 multiplica as faixas
+    // pares, e as ímpares passam pelo deslocamento de 32 bits. Com p < 2^31 as
+    // correções "r - p" e "y - r" cabem em int32 e o sinal decide a soma de p
+    __attribute__((target("sse2")))
+    inline void SubMulModSse2(int n, std::uint32_t factor, const std::uint32_t* x, std::uint32_t* y,
+                              std::uint32_t modulus, std::uint32_t negativeInverse) {
+        const __m128i f = _mm_set1_epi32(static_cast<int>(factor));
+        const __m128i p = _mm_set1_epi32(static_cast<int>(modulus));
+        const __m128i inverse = _mm_set1_epi32(static_cast<int>(negativeInverse));
+        const __m128i high = _mm_set1_epi64x(static_cast<long long>(0xFFFFFFFF00000000ULL));
+        int i = 0;
+        for (; i + 4 <= n; i += 4) {
+            const __m128i values = _mm_loadu_si128(reinterpret_cast<const __m128i*>(x + i));
+            const __m128i even = _mm_mul_epu32(values, f);
+            const __m128i odd = _mm_mul_epu32(_mm_srli_epi64(values, 32), f);
+            const __m128i sumEven = _mm_add_epi64(even, _mm_mul_epu32(_mm_mul_epu32(even, inverse), p));
+            const __m128i sumOdd = _mm_add_epi64(odd, _mm_mul_epu32(_mm_mul_epu32(odd, inverse), p));
+            __m128i r = _mm_sub_epi32(_mm_or_si128(_mm_srli_epi64(sumEven, 32), _mm_and_si128(sumOdd, high)), p);
+            r = _mm_add_epi32(r, _mm_and_si128(_mm_srai_epi32(r, 31), p));
+            __m128i result = _mm_sub_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i*>(y + i)), r);
+            result = _mm_add_epi32(result, _mm_and_si128(_mm_srai_epi32(result, 31), p));
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(y + i), result);
+        }
+        SubMulModScalar(n - i, factor, x + i, y + i, modulus, negativeInverse);
+    }
+
+    // ---------- AVX2 + FMA ----------
+
+    __attribute__((target("avx2,fma")))
+    inline void AxpyAvx2(int n, double alpha, const double* x, double* y) {
+        const __m256d a = _mm256_set1_pd(alpha);
+        int i = 0;
+        for (; i + 8 <= n; i += 8) {
+            __m256d y0 = _mm256_fmadd_pd(a, _mm256_loadu_pd(x + i), _mm256_loadu_pd(y + i));
+            __m256d y1 = _mm256_fmadd_pd(a, _mm256_loadu_pd(x + i + 4), _mm256_loadu_pd(y + i + 4));
+            _mm256_storeu_pd(y + i, y0);
+            _mm256_storeu_pd(y + i + 4, y1);
+        }
+        for (; i + 4 <= n; i += 4) {
+            _mm256_storeu_pd(y + i, _mm256_fmadd_pd(a, _mm256_loadu_pd(x + i), _mm256_loadu_pd(y + i)));
+        }
+        for (; i < n; i++) {
+            y[i] += alpha * x[i];
+        }
+    }
+
+    __attribute__((target("avx2,fma")))
+    inline std::uint64_t HashAvx2(const double* x, int n, std::uint64_t seed) {
+        alignas(32) std::uint32_t lanes[HASH_LANES];
+        for (int i = 0; i < HASH_LANES; i++) {
+            lanes[i] = HashLaneSeed(seed, i);
+        }
+        __m256i state = _mm256_load_si256(reinterpret_cast<const __m256i*>(lanes));
+        const __m256i prime1 = _mm256_set1_epi32(static_cast<int>(HASH_PRIME1));
+        const __m256i prime2 = _mm256_set1_epi32(static_cast<int>(HASH_PRIME2));
+        int i = 0;
+        for (; i + 4 <= n; i += 4) {
+            const __m256i words = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(x + i));
+            const __m256i value = _mm256_add_epi32(state, _mm256_mullo_epi32(words, prime2));
+            const __m256i rotated = _mm256_or_si256(_mm256_slli_epi32(value, 13), _mm256_srli_epi32(value, 19));
+            state = _mm256_mullo_epi32(rotated, prime1);
+        }
+        _mm256_store_si256(reinterpret_cast<__m256i*>(lanes), state);
+        return HashFinish(lanes, x + i, n - i, n, seed);
+    }
+
+    __attribute__((target("avx2,fma")))
+    inline void ScaleAvx2(int n, double alpha, double* x) {
+        const __m256d a = _mm256_set1_pd(alpha);
+        int i = 0;
+        for (; i + 4 <= n; i += 4) {
+            _mm256_storeu_pd(x + i, _mm256_mul_pd(a, _mm256_loadu_pd(x + i)));
+        }
+        for (; i < n; i++) {
+            x[i] *= alpha;
+        }
+    }
+
+    // Busca de pivô com gather: funciona tanto em linhas quanto em colunas (stride)
+    __attribute__((target("avx2,fma")))
+    inline int IndexOfMaxAbsAvx2(int n, const double* x, std::ptrdiff_t stride) {
+        if (n < 8) {
+            return IndexOfMaxAbsScalar(n, x, stride);
+        }
+        const __m256d signMask = _mm256_set1_pd(-0.0);
+        const __m256i step = _mm256_set1_epi64x(4 * static_cast<long long>(stride));
+        __m256i offsets = _mm256_set_epi64x(3 * stride, 2 * stride, stride, 0);
+        __m256d best = _mm256_set1_pd(-1.0);
+        __m256i bestIndex = _mm256_setzero_si256();
+        __m256i index = _mm256_set_epi64x(3, 2, 1, 0);
+        const __m256i four = _mm256_set1_epi64x(4);
+
+        int i = 0;
+        for (; i + 4 <= n; i += 4) {
+            __m256d values = _mm256_andnot_pd(signMask, _mm256_i64gather_pd(x, offsets, 8));
+            __m256d greater = _mm256_cmp_pd(values, best, _CMP_GT_OQ);
+            best = _mm256_blendv_pd(best, values, greater);
+            bestIndex = _mm256_castpd_si256(_mm256_blendv_pd(
+                _mm256_castsi256_pd(bestIndex), _mm256_castsi256_pd(index), greater));
+            offsets = _mm256_add_epi64(offsets, step);
+            index = _mm256_add_epi64(index, four);
+        }
+
+        double lanes[4];
+        long long lanesIndex[4];
+        _mm256_storeu_pd(lanes, best);
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(lanesIndex), bestIndex);
+
+        // Em caso de empate prevalece o menor índice, como na versão escalar
+        int bestLane = 0;
+        for (int lane = 1; lane < 4; lane++) {
+            if (lanes[lane] > lanes[bestLane] ||
+                (lanes[lane] == lanes[bestLane] && lanesIndex[lane] < lanesIndex[bestLane])) {
+                bestLane = lane;
+            }
+        }
+        int result = static_cast<int>(lanesIndex[bestLane]);
+        double maxAbs = lanes[bestLane];
+        for (; i < n; i++) {
+            double currentAbs = std::abs(x[i * stride]);
+            if (currentAbs > maxAbs) {
+                maxAbs = currentAbs;
+                result = i;
+            }
+        }
+        return result;
+    }
+
+    __attribute__((target("avx2,fma")))
+    inline void Gemm4x8Avx2(int kb, const double* a, std::ptrdiff_t lda,
+                            const double* b, std::ptrdiff_t ldb,
+                            double* c, std::ptrdiff_t ldc) {
+        __m256d c00 = _mm256_loadu_pd(c), c01 = _mm256_loadu_pd(c + 4);
+        __m256d c10 = _mm256_loadu_pd(c + ldc), c11 = _mm256_loadu_pd(c + ldc + 4);
+        __m256d c20 = _mm256_loadu_pd(c + 2 * ldc), c21 = _mm256_loadu_pd(c + 2 * ldc + 4);
+        __m256d c30 = _mm256_loadu_pd(c + 3 * ldc), c31 = _mm256_loadu_pd(c + 3 * ldc + 4);
+
+        for (int p = 0; p < kb; p++) {
+            const __m256d b0 = _mm256_loadu_pd(b + p * ldb);
+            const __m256d b1 = _mm256_loadu_pd(b + p * ldb + 4);
+            __m256d factor = _mm256_broadcast_sd(a + p);
+            c00 = _mm256_fnmadd_pd(factor, b0, c00);
+            c01 = _mm256_fnmadd_pd(factor, b1, c01);
+            factor = _mm256_broadcast_sd(a + lda + p);
+            c10 = _mm256_fnmadd_pd(factor, b0, c10);
+            c11 = _mm256_fnmadd_pd(factor, b1, c11);
+            factor = _mm256_broadcast_sd(a + 2 * lda + p);
+            c20 = _mm256_fnmadd_pd(factor, b0, c20);
+            c21 = _mm256_fnmadd_pd(factor, b1, c21);
+            factor = _mm256_broadcast_sd(a + 3 * lda + p);
+            c30 = _mm256_fnmadd_pd(factor, b0, c30);
+            c31 = _mm256_fnmadd_pd(factor, b1, c31);
+        }
+
+        _mm256_storeu_pd(c, c00);
+        _mm256_storeu_pd(c + 4, c01);
+        _mm256_storeu_pd(c + ldc, c10);
+        _mm256_storeu_pd(c + ldc + 4, c11);
+        _mm256_storeu_pd(c + 2 * ldc, c20);
+        _mm256_storeu_pd(c + 2 * ldc + 4, c21);
+        _mm256_storeu_pd(c + 3 * ldc, c30);
+        _mm256_storeu_pd(c + 3 * ldc + 4, c31);
+    }
+
+    // Idem em 8 faixas
+    __attribute__((target("avx2,fma")))
+    inline void SubMulModAvx2(int n, std::uint32_t factor, const std::uint32_t* x, std::uint32_t* y,
+                              std::uint32_t modulus, std::uint32_t negativeInverse) {
+        const __m256i f = _mm256_set1_epi32(static_cast<int>(factor));
+        const __m256i p = _mm256_set1_epi32(static_cast<int>(modulus));
+        const __m256i inverse = _mm256_set1_epi32(static_cast<int>(negativeInverse));
+        const __m256i high = _mm256_set1_epi64x(static_cast<long long>(0xFFFFFFFF00000000ULL));
+        int i = 0;
+        for (; i + 8 <= n; i += 8) {
+            const __m256i values = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(x + i));
+            const __m256i even = _mm256_mul_epu32(values, f);
+            const __m256i odd = _mm256_mul_epu32(_mm256_srli_epi64(values, 32), f);
+            const __m256i sumEven = _mm256_add_epi64(even, _mm256_mul_epu32(_mm256_mul_epu32(even, inverse), p));
+            const __m256i sumOdd = _mm256_add_epi64(odd, _mm256_mul_epu32(_mm256_mul_epu32(odd, inverse), p));
+            __m256i r = _mm256_sub_epi32(_mm256_or_si256(_mm256_srli_epi64(sumEven, 32), _mm256_and_si256(sumOdd, high)), p);
+            r = _mm256_add_epi32(r, _mm256_and_si256(_mm256_srai_epi32(r, 31), p));
+            __m256i result = _mm256_sub_epi32(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(y + i)), r);
+            result = _mm256_add_epi32(result, _mm256_and_si256(_mm256_srai_epi32(result, 31), p));
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(y + i), result);
+        }
+        SubMulModScalar(n - i, factor, x + i, y + i, modulus, negativeInverse);
+    }
+
+    __attribute__((target("avx2,fma")))
+    inline void AxpyFloatAvx2(int n, float alpha, const float* x, float* y) {
+        const __m256 a = _mm256_set1_ps(alpha);
+        int i = 0;
+        for (; i + 16 <= n; i += 16) {
+            __m256 y0 = _mm256_fmadd_ps(a, _mm256_loadu_ps(x + i), _mm256_loadu_ps(y + i));
+            __m256 y1 = _mm256_fmadd_ps(a, _mm256_loadu_ps(x + i + 8), _mm256_loadu_ps(y + i + 8));
+            _mm256_storeu_ps(y + i, y0);
+            _mm256_storeu_ps(y + i + 8, y1);
+        }
+        for (; i + 8 <= n; i += 8) {
+            _mm256_storeu_ps(y + i, _mm256_fmadd_ps(a, _mm256_loadu_ps(x + i), _mm256_loadu_ps(y + i)));
+        }
+        for (; i < n; i++) {
+            y[i] += alpha * x[i];
+        }
+    }
+
+    // Uma linha de 8 floats cabe em um registrador: as colunas pares e ímpares
+    // de A acumulam em registradores separados, mantendo 8 FMAs independentes
+    __attribute__((target("avx2,fma")))
+    inline void Gemm4x8FloatAvx2(int kb, const float* a, std::ptrdiff_t lda,
+                                 const float* b, std::ptrdiff_t ldb,
+                                 float* c, std::ptrdiff_t ldc) {
+        __m256 c0 = _mm256_loadu_ps(c), c1 = _mm256_loadu_ps(c + ldc);
+        __m256 c2 = _mm256_loadu_ps(c + 2 * ldc), c3 = _mm256_loadu_ps(c + 3 * ldc);
+        __m256 d0 = _mm256_setzero_ps(), d1 = _mm256_setzero_ps();
+        __m256 d2 = _mm256_setzero_ps(), d3 = _mm256_setzero_ps();
+
+        int p = 0;
+        for (; p + 2 <= kb; p += 2) {
+            const __m256 b0 = _mm256_loadu_ps(b + p * ldb);
+            const __m256 b1 = _mm256_loadu_ps(b + (p + 1) * ldb);
+            c0 = _mm256_fnmadd_ps(_mm256_broadcast_ss(a + p), b0, c0);
+            c1 = _mm256_fnmadd_ps(_mm256_broadcast_ss(a + lda + p), b0, c1);
+            c2 = _mm256_fnmadd_ps(_mm256_broadcast_ss(a + 2 * lda + p), b0, c2);
+            c3 = _mm256_fnmadd_ps(_mm256_broadcast_ss(a + 3 * lda + p), b0, c3);
+            d0 = _mm256_fnmadd_ps(_mm256_broadcast_ss(a + p + 1), b1, d0);
+            d1 = _mm256_fnmadd_ps(_mm256_broadcast_ss(a + lda + p + 1), b1, d1);
+            d2 = _mm256_fnmadd_ps(_mm256_broadcast_ss(a + 2 * lda + p + 1), b1, d2);
+            d3 = _mm256_fnmadd_ps(_mm256_broadcast_ss(a + 3 * lda + p + 1), b1, d3);
+        }
+        if (p < kb) {
+            const __m256 b0 = _mm256_loadu_ps(b + p * ldb);
+            c0 = _mm256_fnmadd_ps(_mm256_broadcast_ss(a + p), b0, c0);
+            c1 = _mm256_fnmadd_ps(_mm256_broadcast_ss(a + lda + p), b0, c1);
+            c2 = _mm256_fnmadd_ps(_mm256_broadcast_ss(a + 2 * lda + p), b0, c2);
+            c3 = _mm256_fnmadd_ps(_mm256_broadcast_ss(a + 3 * lda + p), b0, c3);
+        }
+
+        _mm256_storeu_ps(c, _mm256_add_ps(c0, d0));
+        _mm256_storeu_ps(c + ldc, _mm256_add_ps(c1, d1));
+        _mm256_storeu_ps(c + 2 * ldc, _mm256_add_ps(c2, d2));
+        _mm256_storeu_ps(c + 3 * ldc, _mm256_add_ps(c3, d3));
+    }
+
+    // ---------- AVX-512 ----------
+
+    __attribute__((target("avx512f")))
+    inline void AxpyAvx512(int n, double alpha, const double* x, double* y) {
+        const __m512d a = _mm512_set1_pd(alpha);
+        int i = 0;
+        for (; i + 8 <= n; i += 8) {
+            _mm512_storeu_pd(y + i, _mm512_fmadd_pd(a, _mm512_loadu_pd(x + i), _mm512_loadu_pd(y + i)));
+        }
+        if (i < n) {
+            const __mmask8 mask = static_cast<__mmask8>((1u << (n - i)) - 1u);
+            __m512d tail = _mm512_fmadd_pd(a, _mm512_maskz_loadu_pd(mask, x + i), _mm512_maskz_loadu_pd(mask, y + i));
+            _mm512_mask_storeu_pd(y + i, mask, tail);
+        }
+    }
+
+    __attribute__((target("avx512f")))
+    inline void ScaleAvx512(int n, double alpha, double* x) {
+        const __m512d a = _mm512_set1_pd(alpha);
+        int i = 0;
+        for (; i + 8 <= n; i += 8) {
+            _mm512_storeu_pd(x + i, _mm512_mul_pd(a, _mm512_loadu_pd(x + i)));
+        }
+        if (i < n) {
+            const __mmask8 mask = static_cast<__mmask8>((1u << (n - i)) - 1u);
+            _mm512_mask_storeu_pd(x + i, mask, _mm512_mul_pd(a, _mm512_maskz_loadu_pd(mask, x + i)));
+        }
+    }
+
+    // Busca de pivô em 8 faixas: carga direta em linhas, gather em colunas
+    __attribute__((target("avx512f")))
+    inline int IndexOfMaxAbsAvx512(int n, const double* x, std::ptrdiff_t stride) {
+        if (n < 16) {
+            return IndexOfMaxAbsAvx2(n, x, stride);
+        }
+        const __m512i step = _mm512_set1_epi64(8 * static_cast<long long>(stride));
+        __m512i offsets = _mm512_set_epi64(7 * stride, 6 * stride, 5 * stride, 4 * stride, 3 * stride, 2 * stride, stride, 0);
+        __m512d best = _mm512_set1_pd(-1.0);
+        __m512i bestIndex = _mm512_setzero_si512();
+        __m512i index = _mm512_set_epi64(7, 6, 5, 4, 3, 2, 1, 0);
+        const __m512i eight = _mm512_set1_epi64(8);
+
+        int i = 0;
+        for (; i + 8 <= n; i += 8) {
+            const __m512d loaded = stride == 1 ? _mm512_loadu_pd(x + i) : _mm512_mask_i64gather_pd(_mm512_setzero_pd(), 0xFF, offsets, x, 8);
+            const __m512d values = _mm512_abs_pd(loaded);
+            const __mmask8 greater = _mm512_cmp_pd_mask(values, best, _CMP_GT_OQ);
+            best = _mm512_mask_blend_pd(greater, best, values);
+            bestIndex = _mm512_mask_blend_epi64(greater, bestIndex, index);
+            offsets = _mm512_add_epi64(offsets, step);
+            index = _mm512_add_epi64(index, eight);
+        }
+
+        double lanes[8];
+        long long lanesIndex[8];
+        _mm512_storeu_pd(lanes, best);
+        _mm512_storeu_si512(lanesIndex, bestIndex);
+
+        // Em caso de empate prevalece o menor índice, como na versão escalar
+        int bestLane = 0;
+        for (int lane = 1; lane < 8; lane++) {
+            if (lanes[lane] > lanes[bestLane] ||
+                (lanes[lane] == lanes[bestLane] && lanesIndex[lane] < lanesIndex[bestLane])) {
+                bestLane = lane;
+            }
+        }
+        int result = static_cast<int>(lanesIndex[bestLane]);
+        double maxAbs = lanes[bestLane];
+        for (; i < n; i++) {
+            double currentAbs = std::abs(x[i * stride]);
+            if (currentAbs > maxAbs) {
+                maxAbs = currentAbs;
+                result = i;
+            }
+        }
+        return result;
+    }
+
+    // Idem em 16 faixas, com o resto da linha em carga e escrita mascaradas
+    __attribute__((target("avx512f")))
+    inline void SubMulModAvx512(int n, std::uint32_t factor, const std::uint32_t* x, std::uint32_t* y,
+                                std::uint32_t modulus, std::uint32_t negativeInverse) {
+        // Formas maskz com máscara cheia: as versões sem máscara do GCC partem de
+        // um registrador indefinido e geram avisos de -Wmaybe-uninitialized
+        const __mmask8 all = 0xFF;
+        const __m512i f = _mm512_set1_epi32(static_cast<int>(factor));
+        const __m512i p = _mm512_set1_epi32(static_cast<int>(modulus));
+        const __m512i inverse = _mm512_set1_epi32(static_cast<int>(negativeInverse));
+        const __m512i high = _mm512_set1_epi64(static_cast<long long>(0xFFFFFFFF00000000ULL));
+        for (int i = 0; i < n; i += 16) {
+            const __mmask16 mask = n - i >= 16 ? static_cast<__mmask16>(0xFFFF)
+                                               : static_cast<__mmask16>((1u << (n - i)) - 1u);
+            const __m512i values = _mm512_maskz_loadu_epi32(mask, x + i);
+            const __m512i even = _mm512_maskz_mul_epu32(all, values, f);
+            const __m512i odd = _mm512_maskz_mul_epu32(all, _mm512_maskz_srli_epi64(all, values, 32), f);
+            const __m512i sumEven = _mm512_add_epi64(even, _mm512_maskz_mul_epu32(all, _mm512_maskz_mul_epu32(all, even, inverse), p));
+            const __m512i sumOdd = _mm512_add_epi64(odd, _mm512_maskz_mul_epu32(all, _mm512_maskz_mul_epu32(all, odd, inverse), p));
+            __m512i r = _mm512_sub_epi32(_mm512_or_si512(_mm512_maskz_srli_epi64(all, sumEven, 32), _mm512_and_si512(sumOdd, high)), p);
+            r = _mm512_add_epi32(r, _mm512_and_si512(_mm512_maskz_srai_epi32(0xFFFF, r, 31), p));
+            __m512i result = _mm512_sub_epi32(_mm512_maskz_loadu_epi32(mask, y + i), r);
+            result = _mm512_add_epi32(result, _mm512_and_si512(_mm512_maskz_srai_epi32(0xFFFF, result, 31), p));
+            _mm512_mask_storeu_epi32(y + i, mask, result);
+        }
+    }
+
+    __attribute__((target("avx512f")))
+    inline void Gemm4x8Avx512(int kb, const double* a, std::ptrdiff_t lda,
+                              const double* b, std::ptrdiff_t ldb,
+                              double* c, std::ptrdiff_t ldc) {
+        __m512d c0 = _mm512_loadu_pd(c);
+        __m512d c1 = _mm512_loadu_pd(c + ldc);
+        __m512d c2 = _mm512_loadu_pd(c + 2 * ldc);
+        __m512d c3 = _mm512_loadu_pd(c + 3 * ldc);
+
+        for (int p = 0; p < kb; p++) {
+            const __m512d bRow = _mm512_loadu_pd(b + p * ldb);
+            c0 = _mm512_fnmadd_pd(_mm512_set1_pd(a[p]), bRow, c0);
+            c1 = _mm512_fnmadd_pd(_mm512_set1_pd(a[lda + p]), bRow, c1);
+            c2 = _mm512_fnmadd_pd(_mm512_set1_pd(a[2 * lda + p]), bRow, c2);
+            c3 = _mm512_fnmadd_pd(_mm512_set1_pd(a[3 * lda + p]), bRow, c3);
+        }
+
+        _mm512_storeu_pd(c, c0);
+        _mm512_storeu_pd(c + ldc, c1);
+        _mm512_storeu_pd(c + 2 * ldc, c2);
+        _mm512_storeu_pd(c + 3 * ldc, c3);
+    }
+
+#endif // LINEAR_SOLVER_SIMD_X86
+
+} // namespace SimdDetail
+
+// Tabela de kernels para um nível de SIMD
+struct SimdKernelTable {
+    SimdLevel level;
+    void (*axpy)(int n, double alpha, const double* x, double* y);
+    void (*scale)(int n, double alpha, double* x);
+    int (*indexOfMaxAbs)(int n, const double* x, std::ptrdiff_t stride);
+    void (*gemm4x8)(int kb, const double* a, std::ptrdiff_t lda,
+                    const double* b, std::ptrdiff_t ldb,
+                    double* c, std::ptrdiff_t ldc);
+    void (*axpyFloat)(int n, float alpha, const float* x, float* y);
+    void (*gemm4x8Float)(int kb, const float* a, std::ptrdiff_t lda,
+                         const float* b, std::ptrdiff_t ldb,
+                         float* c, std::ptrdiff_t ldc);
+    std::uint64_t (*hash)(const double* x, int n, std::uint64_t seed);
+    void (*subMulMod)(int n, std::uint32_t factor, const std::uint32_t* x, std::uint32_t* y,
+                      std::uint32_t modulus, std::uint32_t negativeInverse);
+};
+
+// Detectar o maior nível suportado pela CPU (e pelo sistema operacional)
+inline SimdLevel DetectSimdLevel() {
+#ifdef LINEAR_SOLVER_SIMD_X86
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx512f")) {
+        return SimdLevel::AVX512;
+    }
+    if (__builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma")) {
+        return SimdLevel::AVX2;
+    }
+    if (__builtin_cpu_supports("sse2")) {
+        return SimdLevel::SSE2;
+    }
+#endif
+    return SimdLevel::SCALAR;
+}
+
+// Kernels de um nível específico (níveis não suportados pela compilação caem no escalar)
+inline SimdKernelTable SimdKernelsFor(SimdLevel level) {
+    using namespace SimdDetail;
+    SimdKernelTable table = { SimdLevel::SCALAR, AxpyScalar, ScaleScalar, IndexOfMaxAbsScalar, Gemm4x8Scalar,
+                              AxpyFloatScalar, Gemm4x8FloatScalar, HashScalar, SubMulModScalar };
+#ifdef LINEAR_SOLVER_SIMD_X86
+    switch (level) {
+        case SimdLevel::AVX512:
+            // Em float uma linha do micro-bloco ocupa só 256 bits: os kernels AVX2 bastam
+            table = { SimdLevel::AVX512, AxpyAvx512, ScaleAvx512, IndexOfMaxAbsAvx512, Gemm4x8Avx512,
+                      AxpyFloatAvx2, Gemm4x8FloatAvx2, HashAvx2, SubMulModAvx512 };
+            break;
+        case SimdLevel::AVX2:
+            table = { SimdLevel::AVX2, AxpyAvx2, ScaleAvx2, IndexOfMaxAbsAvx2, Gemm4x8Avx2,
+                      AxpyFloatAvx2, Gemm4x8FloatAvx2, HashAvx2, SubMulModAvx2 };
+            break;
+        case SimdLevel::SSE2:
+            // Sem multiplicação de 32 bits por faixa no SSE2: hash escalar
+            table = { SimdLevel::SSE2, AxpySse2, ScaleSse2, IndexOfMaxAbsSse2, Gemm4x8Scalar,
+                      AxpyFloatSse2, Gemm4x8FloatScalar, HashScalar, SubMulModSse2 };
+            break;
+        default:
+            break;
+    }
+#else
+    (void)level;
+#endif
+    return table;
+}
+
+// Tabela ativa, escolhida na primeira chamada
+inline const SimdKernelTable& SimdKernels() {
+    static const SimdKernelTable table = SimdKernelsFor(DetectSimdLevel());
+    return table;
+}
+
+// Fachadas genéricas: para double (e float, nos kernels da LU) usam a tabela
+// ativa; outros tipos usam laços simples
+template <typename T>
+inline void SimdAxpy(int n, T alpha, const T* x, T* y) {
+    for (int i = 0; i < n; i++) {
+        y[i] += alpha * x[i];
+    }
+}
+
+inline void SimdAxpy(int n, double alpha, const double* x, double* y) {
+    SimdKernels().axpy(n, alpha, x, y);
+}
+
+inline void SimdAxpy(int n, float alpha, const float* x, float* y) {
+    SimdKernels().axpyFloat(n, alpha, x, y);
+}
+
+template <typename T>
+inline void SimdScale(int n, T alpha, T* x) {
+    for (int i = 0; i < n; i++) {
+        x[i] *= alpha;
+    }
+}
+
+inline void SimdScale(int n, double alpha, double* x) {
+    SimdKernels().scale(n, alpha, x);
+}
+
+template <typename T>
+inline int SimdIndexOfMaxAbs(int n, const T* x, std::ptrdiff_t stride) {
+    int best = 0;
+    T maxAbs = n > 0 ? std::abs(x[0]) : T(0);
+    for (int i = 1; i < n; i++) {
+        T currentAbs = std::abs(x[i * stride]);
+        if (currentAbs > maxAbs) {
+            maxAbs = currentAbs;
+            best = i;
+        }
+    }
+    return best;
+}
+
+inline int SimdIndexOfMaxAbs(int n, const double* x, std::ptrdiff_t stride) {
+    return SimdKernels().indexOfMaxAbs(n, x, stride);
+}
+
+template <typename T>
+inline void SimdGemm4x8(int kb, const T* a, std::ptrdiff_t lda,
+                        const T* b, std::ptrdiff_t ldb,
+                        T* c, std::ptrdiff_t ldc) {
+    for (int r = 0; r < 4; r++) {
+        for (int p = 0; p < kb; p++) {
+            const T factor = a[r * lda + p];
+            for (int j = 0; j < 8; j++) {
+                c[r * ldc + j] -= factor * b[p * ldb + j];
+            }
+        }
+    }
+}
+
+inline void SimdGemm4x8(int kb, const double* a, std::ptrdiff_t lda,
+                        const double* b, std::ptrdiff_t ldb,
+                        double* c, std::ptrdiff_t ldc) {
+    SimdKernels().gemm4x8(kb, a, lda, b, ldb, c, ldc);
+}
+
+inline void SimdGemm4x8(int kb, const float* a, std::ptrdiff_t lda,
+                        const float* b, std::ptrdiff_t ldb,
+                        float* c, std::ptrdiff_t ldc) {
+    SimdKernels().gemm4x8Float(kb, a, lda, b, ldb, c, ldc);
+}
+
+inline std::uint64_t SimdHash(const double* x, int n, std::uint64_t seed) {
+    return SimdKernels().hash(x, n, seed);
+}
+
+// y <- y - factor·x mod p em forma de Montgomery (R = 2^32, p ímpar < 2^31)
+inline void SimdSubMulMod(int n, std::uint32_t factor, const std::uint32_t* x, std::uint32_t* y,
+                          std::uint32_t modulus, std::uint32_t negativeInverse) {
+    SimdKernels().subMulMod(n, factor, x, y, modulus, negativeInverse);
+}
@@ -0,0 +1,368 @@
+#pragma once
+#include <vector>
+#include <list>
+#include <unordered_map>
+#include <memory>
+#include <mutex>
+#include <cstdint>
+#include <cstring>
+#include "LinearSolver.h"
+#include "SimdKernels.h"
+
+// Cache LRU endereçada pelo conteúdo, na frente do LinearSolver::Solve.
+// Guarda soluções (chave: hash de n, A, b e da configuração do solver) e
+// matrizes (chave: hash de n e A).
+// Uma matriz vista de novo com outro b é fatorada e a LU fica guardada, então
+// os próximos b contra a mesma A custam só as substituições, O(n²). O hash
+// escolhe a entrada; um acerto só vale se os bits de A e b e a configuração
+// forem idênticos aos guardados. O total de bytes guardados não passa de GetMemoryLimit(): as
+// entradas usadas há mais tempo saem primeiro. Thread-safe; a resolução em si
+// acontece fora do lock.
+class SolutionCache {
+public:
+    static constexpr std::size_t DEFAULT_MEMORY_LIMIT = std::size_t(64) << 20; // 64 MiB
+
+    struct Statistics {
+        long long solutionHits = 0;
+        long long solutionMisses = 0;
+        long long factorizationHits = 0;   // Soluções novas a partir de uma LU guardada
+        long long factorizationMisses = 0; // Soluções novas sem LU guardada
+        long long evictions = 0;
+        std::size_t entries = 0;
+        std::size_t memoryUsed = 0;        // Bytes
+    };
+
+private:
+    // O que no LinearSolver muda o resultado de um Solve denso: uma solução
+    // calculada com outra configuração (ex.: sem aritmética exata) não é servida.
+    // A LU guardada vale para todas; Solve(LUFactorization) aplica a do chamador.
+    struct Configuration {
+        LinearSolver::Algorithm algorithm = LinearSolver::Algorithm::AUTOMATIC;
+        int blockSize = 0;
+        int blockedThreshold = 0;
+        bool estimateCondition = false;
+        bool exactArithmetic = false;
+
+        Configuration() = default;
+
+        explicit Configuration(const LinearSolver& solver)
+            : algorithm(solver.GetAlgorithm()), blockSize(solver.GetBlockSize()),
+              blockedThreshold(solver.GetBlockedThreshold()), estimateCondition(solver.GetConditionEstimation()),
+              exactArithmetic(solver.GetExactArithmetic()) {}
+
+        bool operator==(const Configuration& other) const {
+            return algorithm == other.algorithm && blockSize == other.blockSize &&
+                   blockedThreshold == other.blockedThreshold && estimateCondition == other.estimateCondition &&
+                   exactArithmetic == other.exactArithmetic;
+        }
+
+        std::uint64_t Hash(std::uint64_t seed) const {
+            const double fields[] = {static_cast<double>(algorithm), static_cast<double>(blockSize),
+                                     static_cast<double>(blockedThreshold), estimateCondition ? 1.0 : 0.0,
+                                     exactArithmetic ? 1.0 : 0.0};
+            return SimdHash(fields, 5, seed);
+        }
+    };
+
+    struct Entry {
+        bool isMatrix;
+        std::uint64_t key;
+        std::size_t bytes;
+
+        // Matriz: a cópia de A fica dentro da fatoração depois que ela existe
+        DenseMatrix matrix;
+        std::shared_ptr<const LUFactorization> factorization;
+        bool factorable = false;
+
+        // Solução: b, a configuração e o resultado; A fica na entrada da matriz (matrixKey)
+        std::uint64_t matrixKey = 0;
+        std::vector<double> constants;
+        Configuration configuration;
+        LinearSolver::Solution solution;
+
+        const DenseMatrix& Matrix() const {
+            return factorization ? factorization->Coefficients() : matrix;
+        }
+    };
+    using EntryList = std::list<Entry>;
+
+    mutable std::mutex mutex;
+    EntryList entries; // Mais recente na frente
+    std::unordered_map<std::uint64_t, EntryList::iterator> matrices;
+    std::unordered_map<std::uint64_t, EntryList::iterator> solutions;
+    std::size_t memoryLimit;
+    Statistics statistics;
+
+    // Hash linha a linha (o preenchimento do stride não entra)
+    static std::uint64_t HashMatrix(const DenseMatrix& matrix) {
+        std::uint64_t h = (static_cast<std::uint64_t>(matrix.Rows()) << 32) | static_cast<std::uint32_t>(matrix.Cols());
+        for (int i = 0; i < matrix.Rows(); i++) {
+            h = SimdHash(matrix.Row(i), matrix.Cols(), h);
+        }
+        return h;
+    }
+
+    static bool SameBits(const DenseMatrix& a, const DenseMatrix& b) {
+        if (a.Rows() != b.Rows() || a.Cols() != b.Cols()) {
+            return false;
+        }
+        for (int i = 0; i < a.Rows(); i++) {
+            if (std::memcmp(a.Row(i), b.Row(i), sizeof(double) * a.Cols()) != 0) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    static bool SameBits(const std::vector<double>& a, const std::vector<double>& b) {
+        return a.size() == b.size() && std::memcmp(a.data(), b.data(), sizeof(double) * a.size()) == 0;
+    }
+
+    static std::size_t MatrixBytes(const DenseMatrix& matrix) {
+        return sizeof(double) * static_cast<std::size_t>(matrix.Rows()) * matrix.Stride();
+    }
+
+    static std::size_t EntryBytes(const Entry& entry) {
+        std::size_t bytes = sizeof(Entry);
+        if (entry.isMatrix) {
+            bytes += MatrixBytes(entry.Matrix());
+            if (entry.factorization) {
+                bytes += MatrixBytes(entry.factorization->Factors()) +
+                         sizeof(int) * entry.factorization->Pivots().size();
+            }
+        } else {
+            bytes += sizeof(double) * (entry.constants.size() + entry.solution.values.size() +
+                                       entry.solution.residualHistory.size()) +
+                     sizeof(int) * entry.solution.pivots.size() + entry.solution.diagnostics.size();
+            for (const ExactSolver::Rational& value : entry.solution.exactValues) {
+                bytes += sizeof(value) + (value.numerator.BitLength() + value.denominator.BitLength()) / 8;
+            }
+        }
+        return bytes;
+    }
+
+    void Touch(EntryList::iterator entry) {
+        entries.splice(entries.begin(), entries, entry);
+    }
+
+    void Erase(EntryList::iterator entry) {
+        (entry->isMatrix ? matrices : solutions).erase(entry->key);
+        statistics.memoryUsed -= entry->bytes;
+        entries.erase(entry);
+    }
+
+    void Evict() {
+        while (statistics.memoryUsed > memoryLimit && !entries.empty()) {
+            Erase(std::prev(entries.end()));
+            statistics.evictions++;
+        }
+    }
+
+    // Entrada da matriz com os mesmos bits de A (end() se não houver)
+    EntryList::iterator FindMatrix(std::uint64_t key, const DenseMatrix& matrix) {
+        auto found = matrices.find(key);
+        if (found == matrices.end() || !SameBits(found->second->Matrix(), matrix)) {
+            return entries.end();
+        }
+        return found->second;
+    }
+
+    void Insert(Entry&& entry) {
+        entry.bytes = EntryBytes(entry);
+        if (entry.bytes > memoryLimit) {
+            return;
+        }
+        auto& index = entry.isMatrix ? matrices : solutions;
+        auto previous = index.find(entry.key);
+        if (previous != index.end()) {
+            Erase(previous->second); // Mesma chave com conteúdo diferente (colisão) ou resultado novo
+        }
+        statistics.memoryUsed += entry.bytes;
+        entries.push_front(std::move(entry));
+        index[entries.front().key] = entries.begin();
+        Evict();
+    }
+
+    void InsertMatrix(std::uint64_t key, const DenseMatrix& matrix, bool factorable) {
+        Entry entry;
+        entry.isMatrix = true;
+        entry.key = key;
+        entry.matrix = matrix;
+        entry.factorable = factorable;
+        Insert(std::move(entry));
+    }
+
+    void InsertSolution(std::uint64_t key, std::uint64_t matrixKey, const std::vector<double>& constants,
+                        const Configuration& configuration, const LinearSolver::Solution& solution) {
+        Entry entry;
+        entry.isMatrix = false;
+        entry.key = key;
+        entry.matrixKey = matrixKey;
+        entry.constants = constants;
+        entry.configuration = configuration;
+        entry.solution = solution;
+        Insert(std::move(entry));
+    }
+
+    // Só vale guardar a LU quando ela é o caminho normal do Solve: sistemas
+    // pequenos já usam o solver de tamanho fixo e matrizes em banda, a LU em banda
+    static bool WorthFactoring(const DenseMatrix& matrix) {
+        const int n = matrix.Rows();
+        int lower = 0;
+        int upper = 0;
+        return n > FixedLinearSolver<1>::MAX_SIZE &&
+               !BandMatrix::DetectBandwidth(matrix, n / LinearSolver::BAND_DETECTION_RATIO, lower, upper);
+    }
+
+    static std::uint64_t SolutionKey(std::uint64_t matrixKey, const std::vector<double>& constants,
+                                     const Configuration& configuration) {
+        return configuration.Hash(SimdHash(constants.data(), static_cast<int>(constants.size()), matrixKey));
+    }
+
+    // Procurar (A, b) já sob o lock; também devolve o que se sabe sobre A
+    bool FindLocked(std::uint64_t matrixKey, std::uint64_t solutionKey, const DenseMatrix& matrix,
+                    const std::vector<double>& constants, const Configuration& configuration,
+                    LinearSolver::Solution& solution) {
+        auto found = solutions.find(solutionKey);
+        if (found != solutions.end() && found->second->matrixKey == matrixKey &&
+            found->second->configuration == configuration && SameBits(found->second->constants, constants)) {
+            auto matrixEntry = FindMatrix(matrixKey, matrix);
+            if (matrixEntry != entries.end()) {
+                Touch(matrixEntry);
+                Touch(found->second);
+                solution = found->second->solution;
+                statistics.solutionHits++;
+                return true;
+            }
+        }
+        statistics.solutionMisses++;
+        return false;
+    }
+
+public:
+    explicit SolutionCache(std::size_t memoryLimit = DEFAULT_MEMORY_LIMIT) : memoryLimit(memoryLimit) {}
+
+    SolutionCache(const SolutionCache&) = delete;
+    SolutionCache& operator=(const SolutionCache&) = delete;
+
+    // Resolver A·x = b pela cache: solução guardada, LU guardada ou Solve completo
+    LinearSolver::Solution Solve(const LinearSolver& solver, const DenseMatrix& coefficients,
+                                 const std::vector<double>& constants) {
+        const int n = coefficients.Rows();
+        if (coefficients.Empty() || coefficients.Cols() != n || static_cast<int>(constants.size()) != n) {
+            return solver.Solve(coefficients, constants);
+        }
+
+        const Configuration configuration(solver);
+        const std::uint64_t matrixKey = HashMatrix(coefficients);
+        const std::uint64_t solutionKey = SolutionKey(matrixKey, constants, configuration);
+        LinearSolver::Solution solution;
+        std::shared_ptr<const LUFactorization> factorization;
+        bool knownMatrix = false;
+        bool factor = false;
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            if (FindLocked(matrixKey, solutionKey, coefficients, constants, configuration, solution)) {
+                return solution;
+            }
+            auto matrixEntry = FindMatrix(matrixKey, coefficients);
+            if (matrixEntry != entries.end()) {
+                Touch(matrixEntry);
+                knownMatrix = true;
+                factorization = matrixEntry->factorization;
+                factor = !factorization && matrixEntry->factorable;
+            }
+            (factorization ? statistics.factorizationHits : statistics.factorizationMisses)++;
+        }
+
+        // A já conhecida com outro b: fatorar agora e guardar a LU para os próximos
+        if (factor) {
+            factorization = std::make_shared<const LUFactorization>(solver.Factorize(coefficients));
+        }
+        solution = factorization ? solver.Solve(*factorization, constants) : solver.Solve(coefficients, constants);
+        const bool factorable = knownMatrix || WorthFactoring(coefficients);
+
+        std::lock_guard<std::mutex> lock(mutex);
+        auto matrixEntry = FindMatrix(matrixKey, coefficients);
+        if (matrixEntry == entries.end()) {
+            InsertMatrix(matrixKey, coefficients, factorable);
+        } else if (factor && !matrixEntry->factorization) {
+            // A LU substitui a cópia de A (ela guarda a sua)
+            statistics.memoryUsed -= matrixEntry->bytes;
+            matrixEntry->factorization = factorization;
+            matrixEntry->matrix = DenseMatrix();
+            matrixEntry->bytes = EntryBytes(*matrixEntry);
+            statistics.memoryUsed += matrixEntry->bytes;
+            Touch(matrixEntry);
+            Evict();
+        }
+        InsertSolution(solutionKey, matrixKey, constants, configuration, solution);
+        return solution;
+    }
+
+    // Adaptador para o formato vector<vector<double>>
+    LinearSolver::Solution Solve(const LinearSolver& solver, const std::vector<std::vector<double>>& coefficients,
+                                 const std::vector<double>& constants) {
+        return Solve(solver, DenseMatrix(coefficients), constants);
+    }
+
+    // Para quem resolve por outro caminho (ex.: a interface, que corrige o
+    // veredito pela aritmética exata): consultar e depois guardar o resultado.
+    // solver é o que resolveu (ou vai resolver): só a configuração dele conta.
+    bool Find(const LinearSolver& solver, const DenseMatrix& coefficients, const std::vector<double>& constants,
+              LinearSolver::Solution& solution) {
+        if (coefficients.Empty() || static_cast<int>(constants.size()) != coefficients.Rows()) {
+            return false;
+        }
+        const Configuration configuration(solver);
+        const std::uint64_t matrixKey = HashMatrix(coefficients);
+        const std::uint64_t solutionKey = SolutionKey(matrixKey, constants, configuration);
+        std::lock_guard<std::mutex> lock(mutex);
+        return FindLocked(matrixKey, solutionKey, coefficients, constants, configuration, solution);
+    }
+
+    void Store(const LinearSolver& solver, const DenseMatrix& coefficients, const std::vector<double>& constants,
+               const LinearSolver::Solution& solution) {
+        if (coefficients.Empty() || static_cast<int>(constants.size()) != coefficients.Rows()) {
+            return;
+        }
+        const Configuration configuration(solver);
+        const std::uint64_t matrixKey = HashMatrix(coefficients);
+        const std::uint64_t solutionKey = SolutionKey(matrixKey, constants, configuration);
+        std::lock_guard<std::mutex> lock(mutex);
+        auto matrixEntry = FindMatrix(matrixKey, coefficients);
+        if (matrixEntry == entries.end()) {
+            InsertMatrix(matrixKey, coefficients, false);
+        } else {
+            Touch(matrixEntry);
+        }
+        InsertSolution(solutionKey, matrixKey, constants, configuration, solution);
+    }
+
+    void SetMemoryLimit(std::size_t bytes) {
+        std::lock_guard<std::mutex> lock(mutex);
+        memoryLimit = bytes;
+        Evict();
+    }
+
+    std::size_t GetMemoryLimit() const {
+        std::lock_guard<std::mutex> lock(mutex);
+        return memoryLimit;
+    }
+
+    Statistics GetStatistics() const {
+        std::lock_guard<std::mutex> lock(mutex);
+        Statistics result = statistics;
+        result.entries = entries.size();
+        return result;
+    }
+
+    // Esvaziar a cache (os contadores continuam)
+    void Clear() {
+        std::lock_guard<std::mutex> lock(mutex);
+        entries.clear();
+        matrices.clear();
+        solutions.clear();
+        statistics.memoryUsed = 0;
+    }
+};
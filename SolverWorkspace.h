@@ -0,0 +1,69 @@
+#pragma once
+#include <vector>
+#include <algorithm>
+#include "DenseMatrix.h"
+#include "BandLU.h"
+
+// Memória de trabalho do LinearSolver reaproveitada entre chamadas de Solve.
+// Cada buffer cresce até o maior sistema já resolvido e depois só é reutilizado,
+// então resolver repetidamente sistemas do mesmo tamanho (laços de simulação,
+// muitos sistemas pequenos) não faz nenhuma alocação no heap. Não é
+// thread-safe: use um workspace por thread.
+class SolverWorkspace {
+private:
+    friend class LinearSolver;
+
+    // Fatores deixados pela última resolução (usados pelo estimador de
+    // condicionamento e pelo refinamento iterativo)
+    enum class FactorKind {
+        NONE,
+        CROUT,       // augmented: P·A = M·U, pivôs na diagonal de M, U unitária
+        LU,          // factors + pivots (LU em blocos)
+        SINGLE_LU,   // singleFactors + pivots (precisão mista)
+        CHOLESKY,    // factors
+        LDLT,        // factors + pivots + offDiagonal
+        BAND,        // band
+        TRIDIAGONAL  // lower, diagonal, upper (Thomas)
+    };
+    FactorKind factorKind = FactorKind::NONE;
+
+    DenseMatrix input;                 // Cópia do formato vector<vector<double>>
+    DenseMatrix augmented;             // [A|b] da eliminação clássica
+    DenseMatrix factors;               // LU em blocos, Cholesky ou LDLᵀ
+    DenseMatrix panel;                 // Painel transposto das fatorações simétricas
+    DenseMatrix columns;               // W do Bunch-Kaufman
+    DenseMatrixT<float> singleFactors; // LU em float da precisão mista
+    std::vector<int> pivots;
+    std::vector<int> pivotColumns;
+    std::vector<double> offDiagonal;
+    std::vector<double> residual;
+    std::vector<double> values;        // Cópia de trabalho (Thomas, refinamento)
+    std::vector<float> correction;
+    std::vector<double> lower;         // Diagonais do algoritmo de Thomas
+    std::vector<double> diagonal;
+    std::vector<double> upper;
+    std::vector<double> modifiedUpper;
+    std::vector<double> columnSums;    // ‖A‖₁
+    std::vector<double> estimate;      // Vetores do estimador de Hager
+    std::vector<double> signs;
+    BandLU band;
+
+public:
+    // Reservar os buffers dos caminhos densos para sistemas n x n, para que
+    // nem a primeira chamada precise alocar
+    void Reserve(int n) {
+        n = std::max(0, n);
+        augmented.Resize(n, n + 1);
+        factors.Resize(n, n);
+        pivots.reserve(n);
+        pivotColumns.reserve(n);
+        offDiagonal.reserve(n);
+        residual.reserve(n);
+        values.reserve(n);
+    }
+
+    // Devolver toda a memória
+    void Release() {
+        *this = SolverWorkspace();
+    }
+};
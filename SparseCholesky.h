@@ -0,0 +1,187 @@
+#pragma once
+#include <vector>
+#include <cmath>
+#include <cstdint>
+#include "SparseMatrix.h"
+
+// Cholesky esparsa up-looking: P·A·Pᵀ = L·Lᵀ para A simétrica positiva
+// definida. A análise simbólica usa a árvore de eliminação: o padrão da linha
+// k de L é o conjunto de nós alcançados subindo a árvore a partir das entradas
+// de A(0:k, k), o que permite contar as colunas antes da fase numérica e
+// alocar L exatamente. L fica em CSC com a diagonal como primeira entrada.
+class SparseCholesky {
+private:
+    int n = 0;
+    std::vector<std::int64_t> pointers;
+    std::vector<int> indices;
+    std::vector<double> values;
+    std::vector<int> permutation; // posição -> índice original
+
+    // Padrão da linha k de L em pattern[top..n), em ordem topológica
+    static int RowPattern(int k, const std::vector<std::int64_t>& upperPointers,
+                          const std::vector<int>& upperIndices, const std::vector<int>& parent,
+                          std::vector<int>& mark, std::vector<int>& pattern, std::vector<int>& path) {
+        const int size = static_cast<int>(parent.size());
+        int top = size;
+        mark[k] = k;
+        for (std::int64_t p = upperPointers[k]; p < upperPointers[k + 1]; p++) {
+            int i = upperIndices[p];
+            if (i > k) continue;
+            int length = 0;
+            for (; mark[i] != k; i = parent[i]) {
+                path[length++] = i;
+                mark[i] = k;
+            }
+            while (length > 0) {
+                pattern[--top] = path[--length];
+            }
+        }
+        return top;
+    }
+
+public:
+    int Size() const { return n; }
+    std::int64_t NonZeros() const { return static_cast<std::int64_t>(indices.size()); }
+
+    // Fatorar com a permutação simétrica dada; retorna false se a matriz não
+    // for positiva definida (pivô <= tolerance)
+    bool Factor(const SparseMatrix& matrix, const std::vector<int>& order, double tolerance) {
+        n = matrix.Rows();
+        permutation = order;
+        std::vector<int> inverse(n);
+        for (int k = 0; k < n; k++) {
+            inverse[permutation[k]] = k;
+        }
+
+        // Triângulo superior de C = P·A·Pᵀ em CSC (A simétrica: linha i = coluna i)
+        const auto& rowPointers = matrix.RowPointers();
+        const auto& columnIndices = matrix.ColumnIndices();
+        const auto& matrixValues = matrix.Values();
+        std::vector<std::int64_t> upperPointers(n + 1, 0);
+        for (int i = 0; i < n; i++) {
+            for (std::int64_t p = rowPointers[i]; p < rowPointers[i + 1]; p++) {
+                int row = inverse[i];
+                int column = inverse[columnIndices[p]];
+                if (row <= column) upperPointers[column + 1]++;
+            }
+        }
+        for (int k = 0; k < n; k++) {
+            upperPointers[k + 1] += upperPointers[k];
+        }
+        std::vector<int> upperIndices(upperPointers[n]);
+        std::vector<double> upperValues(upperPointers[n]);
+        {
+            std::vector<std::int64_t> next(upperPointers.begin(), upperPointers.end() - 1);
+            for (int i = 0; i < n; i++) {
+                for (std::int64_t p = rowPointers[i]; p < rowPointers[i + 1]; p++) {
+                    int row = inverse[i];
+                    int column = inverse[columnIndices[p]];
+                    if (row <= column) {
+                        std::int64_t q = next[column]++;
+                        upperIndices[q] = row;
+                        upperValues[q] = matrixValues[p];
+                    }
+                }
+            }
+        }
+
+        // Árvore de eliminação (com compressão de caminho pelos ancestrais)
+        std::vector<int> parent(n, -1);
+        {
+            std::vector<int> ancestor(n, -1);
+            for (int k = 0; k < n; k++) {
+                for (std::int64_t p = upperPointers[k]; p < upperPointers[k + 1]; p++) {
+                    int i = upperIndices[p];
+                    while (i != -1 && i < k) {
+                        int next = ancestor[i];
+                        ancestor[i] = k;
+                        if (next == -1) parent[i] = k;
+                        i = next;
+                    }
+                }
+            }
+        }
+
+        // Contagem de entradas por coluna de L
+        std::vector<int> mark(n, -1);
+        std::vector<int> pattern(n);
+        std::vector<int> path(n);
+        pointers.assign(n + 1, 0);
+        for (int k = 0; k < n; k++) {
+            pointers[k + 1]++; // Diagonal
+            int top = RowPattern(k, upperPointers, upperIndices, parent, mark, pattern, path);
+            for (int p = top; p < n; p++) {
+                pointers[pattern[p] + 1]++;
+            }
+        }
+        for (int k = 0; k < n; k++) {
+            pointers[k + 1] += pointers[k];
+        }
+        indices.assign(pointers[n], 0);
+        values.assign(pointers[n], 0.0);
+
+        // Fase numérica: linha k de L por substituição triangular esparsa
+        std::vector<std::int64_t> next(pointers.begin(), pointers.end() - 1);
+        std::vector<double> x(n, 0.0);
+        std::fill(mark.begin(), mark.end(), -1);
+        for (int k = 0; k < n; k++) {
+            int top = RowPattern(k, upperPointers, upperIndices, parent, mark, pattern, path);
+            for (std::int64_t p = upperPointers[k]; p < upperPointers[k + 1]; p++) {
+                if (upperIndices[p] <= k) x[upperIndices[p]] += upperValues[p];
+            }
+            double diagonal = x[k];
+            x[k] = 0.0;
+
+            for (; top < n; top++) {
+                int i = pattern[top];
+                double value = x[i] / values[pointers[i]];
+                x[i] = 0.0;
+                for (std::int64_t p = pointers[i] + 1; p < next[i]; p++) {
+                    x[indices[p]] -= values[p] * value;
+                }
+                diagonal -= value * value;
+                std::int64_t position = next[i]++;
+                indices[position] = k;
+                values[position] = value;
+            }
+
+            if (!(diagonal > tolerance)) {
+                return false;
+            }
+            std::int64_t position = next[k]++;
+            indices[position] = k;
+            values[position] = std::sqrt(diagonal);
+        }
+        return true;
+    }
+
+    // Resolver A·x = b sobrescrevendo b
+    void SolveInPlace(double* b) const {
+        std::vector<double> y(n);
+        for (int k = 0; k < n; k++) {
+            y[k] = b[permutation[k]];
+        }
+
+        // L·z = y
+        for (int j = 0; j < n; j++) {
+            y[j] /= values[pointers[j]];
+            const double value = y[j];
+            for (std::int64_t p = pointers[j] + 1; p < pointers[j + 1]; p++) {
+                y[indices[p]] -= values[p] * value;
+            }
+        }
+
+        // Lᵀ·x = z
+        for (int j = n - 1; j >= 0; j--) {
+            double value = y[j];
+            for (std::int64_t p = pointers[j] + 1; p < pointers[j + 1]; p++) {
+                value -= values[p] * y[indices[p]];
+            }
+            y[j] = value / values[pointers[j]];
+        }
+
+        for (int k = 0; k < n; k++) {
+            b[permutation[k]] = y[k];
+        }
+    }
+};
@@ -0,0 +1,204 @@
+#pragma once
+#include <vector>
+#include <cmath>
+#include <cstdint>
+#include "SparseMatrix.h"
+
+// LU esparsa left-looking (Gilbert-Peierls): P·A·Q = L·U, com Q dada pela
+// ordenação e P escolhida por pivoteamento com limiar. A coluna k é obtida
+// resolvendo L·x = A(:, q[k]) só sobre o padrão alcançável no grafo de L
+// (busca em profundidade), de modo que o custo é proporcional às operações
+// realmente feitas. Entre os candidatos com |x_i| >= limiar·max, a linha da
+// diagonal é preferida, preservando o efeito da ordenação simétrica.
+// L (diagonal unitária, guardada como primeira entrada) e U (diagonal como
+// última entrada) ficam em CSC.
+class SparseLU {
+public:
+    static constexpr double DEFAULT_PIVOT_THRESHOLD = 0.1;
+
+private:
+    int n = 0;
+    std::vector<std::int64_t> lowerPointers;
+    std::vector<int> lowerIndices;
+    std::vector<double> lowerValues;
+    std::vector<std::int64_t> upperPointers;
+    std::vector<int> upperIndices;
+    std::vector<double> upperValues;
+    std::vector<int> rowPosition;  // linha original -> posição do pivô
+    std::vector<int> columnOrder;  // posição -> coluna original
+
+    // Busca em profundidade a partir da linha start no grafo de L; empilha os
+    // nós terminados em order[top..n) (ordem topológica)
+    int DepthFirst(int start, int top, int stamp, std::vector<int>& mark,
+                   std::vector<int>& stack, std::vector<std::int64_t>& resume,
+                   std::vector<int>& order) const {
+        int head = 0;
+        stack[0] = start;
+        while (head >= 0) {
+            int row = stack[head];
+            int column = rowPosition[row];
+            if (mark[row] != stamp) {
+                mark[row] = stamp;
+                resume[head] = column < 0 ? 0 : lowerPointers[column] + 1;
+            }
+
+            bool finished = true;
+            std::int64_t end = column < 0 ? 0 : lowerPointers[column + 1];
+            for (std::int64_t p = resume[head]; p < end; p++) {
+                int next = lowerIndices[p];
+                if (mark[next] == stamp) continue;
+                resume[head] = p + 1;
+                stack[++head] = next;
+                finished = false;
+                break;
+            }
+
+            if (finished) {
+                head--;
+                order[--top] = row;
+            }
+        }
+        return top;
+    }
+
+public:
+    int Size() const { return n; }
+    std::int64_t NonZeros() const {
+        return static_cast<std::int64_t>(lowerIndices.size() + upperIndices.size()) - n;
+    }
+
+    // Fatorar A com a ordem de colunas dada; retorna false se algum pivô
+    // disponível for menor que tolerance (matriz numericamente singular)
+    bool Factor(const SparseMatrix& matrix, const std::vector<int>& order,
+                double pivotThreshold, double tolerance) {
+        n = matrix.Rows();
+        columnOrder = order;
+        const SparseMatrix columns = matrix.Transpose(); // CSC de A
+
+        lowerPointers.assign(n + 1, 0);
+        upperPointers.assign(n + 1, 0);
+        lowerIndices.clear();
+        lowerValues.clear();
+        upperIndices.clear();
+        upperValues.clear();
+        const std::int64_t estimate = 4 * matrix.NonZeros() + n;
+        lowerIndices.reserve(estimate);
+        lowerValues.reserve(estimate);
+        upperIndices.reserve(estimate);
+        upperValues.reserve(estimate);
+        rowPosition.assign(n, -1);
+
+        std::vector<double> x(n, 0.0);
+        std::vector<int> pattern(n);
+        std::vector<int> mark(n, -1);
+        std::vector<int> stack(n);
+        std::vector<std::int64_t> resume(n);
+
+        for (int k = 0; k < n; k++) {
+            const int column = columnOrder[k];
+            const std::int64_t begin = columns.RowPointers()[column];
+            const std::int64_t end = columns.RowPointers()[column + 1];
+
+            // Padrão de x = L \ A(:, column)
+            int top = n;
+            for (std::int64_t p = begin; p < end; p++) {
+                int row = columns.ColumnIndices()[p];
+                if (mark[row] != k) {
+                    top = DepthFirst(row, top, k, mark, stack, resume, pattern);
+                }
+            }
+
+            // Substituição progressiva esparsa
+            for (int p = top; p < n; p++) {
+                x[pattern[p]] = 0.0;
+            }
+            for (std::int64_t p = begin; p < end; p++) {
+                x[columns.ColumnIndices()[p]] = columns.Values()[p];
+            }
+            for (int p = top; p < n; p++) {
+                int row = pattern[p];
+                int position = rowPosition[row];
+                if (position < 0) continue;
+                const double value = x[row];
+                for (std::int64_t q = lowerPointers[position] + 1; q < lowerPointers[position + 1]; q++) {
+                    x[lowerIndices[q]] -= lowerValues[q] * value;
+                }
+            }
+
+            // Parte de U e escolha do pivô entre as linhas ainda não usadas
+            int pivotRow = -1;
+            double maxAbs = 0.0;
+            for (int p = top; p < n; p++) {
+                int row = pattern[p];
+                if (rowPosition[row] >= 0) {
+                    upperIndices.push_back(rowPosition[row]);
+                    upperValues.push_back(x[row]);
+                } else if (std::abs(x[row]) > maxAbs) {
+                    maxAbs = std::abs(x[row]);
+                    pivotRow = row;
+                }
+            }
+
+            if (pivotRow < 0 || !(maxAbs > tolerance)) {
+                return false;
+            }
+            // Preferir a diagonal; fora do padrão desta coluna x[column] é
+            // resto de uma coluna anterior (o valor real é zero)
+            if (mark[column] == k && rowPosition[column] < 0 &&
+                std::abs(x[column]) >= pivotThreshold * maxAbs) {
+                pivotRow = column;
+            }
+
+            const double pivot = x[pivotRow];
+            upperIndices.push_back(k);
+            upperValues.push_back(pivot);
+            upperPointers[k + 1] = static_cast<std::int64_t>(upperIndices.size());
+
+            rowPosition[pivotRow] = k;
+            lowerIndices.push_back(pivotRow);
+            lowerValues.push_back(1.0);
+            const double inversePivot = 1.0 / pivot;
+            for (int p = top; p < n; p++) {
+                int row = pattern[p];
+                if (rowPosition[row] < 0) {
+                    lowerIndices.push_back(row);
+                    lowerValues.push_back(x[row] * inversePivot);
+                }
+            }
+            lowerPointers[k + 1] = static_cast<std::int64_t>(lowerIndices.size());
+        }
+
+        // Índices de linha de L passam a ser posições de pivô
+        for (int& row : lowerIndices) {
+            row = rowPosition[row];
+        }
+        return true;
+    }
+
+    // Resolver A·x = b sobrescrevendo b
+    void SolveInPlace(double* b) const {
+        std::vector<double> y(n);
+        for (int i = 0; i < n; i++) {
+            y[rowPosition[i]] = b[i];
+        }
+
+        for (int j = 0; j < n; j++) {
+            const double value = y[j];
+            for (std::int64_t p = lowerPointers[j] + 1; p < lowerPointers[j + 1]; p++) {
+                y[lowerIndices[p]] -= lowerValues[p] * value;
+            }
+        }
+
+        for (int j = n - 1; j >= 0; j--) {
+            y[j] /= upperValues[upperPointers[j + 1] - 1];
+            const double value = y[j];
+            for (std::int64_t p = upperPointers[j]; p < upperPointers[j + 1] - 1; p++) {
+                y[upperIndices[p]] -= upperValues[p] * value;
+            }
+        }
+
+        for (int k = 0; k < n; k++) {
+            b[columnOrder[k]] = y[k];
+        }
+    }
+};
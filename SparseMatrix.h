@@ -0,0 +1,251 @@
+#pragma once
+#include <vector>
+#include <cmath>
+#include <cstdint>
+#include <memory>
+#include <algorithm>
+#include "DenseMatrix.h"
+
+// Vetor somente leitura sem posse (ponteiro e tamanho), usado para expor os
+// arrays CSR tanto de vetores próprios quanto de memória mapeada
+template <typename T>
+class ArrayView {
+private:
+    const T* pointer;
+    std::size_t count;
+
+public:
+    ArrayView() : pointer(nullptr), count(0) {}
+    ArrayView(const T* pointer, std::size_t count) : pointer(pointer), count(count) {}
+    ArrayView(const std::vector<T>& source) : pointer(source.data()), count(source.size()) {}
+
+    const T& operator[](std::size_t i) const { return pointer[i]; }
+    const T* data() const { return pointer; }
+    std::size_t size() const { return count; }
+    bool empty() const { return count == 0; }
+    const T* begin() const { return pointer; }
+    const T* end() const { return pointer + count; }
+
+    bool operator==(const ArrayView& other) const {
+        return count == other.count && std::equal(begin(), end(), other.begin());
+    }
+    bool operator!=(const ArrayView& other) const { return !(*this == other); }
+};
+
+// Entrada (linha, coluna, valor) usada para montar matrizes esparsas
+struct Triplet {
+    int row;
+    int col;
+    double value;
+};
+
+// Matriz esparsa no formato CSR (compressed sparse row).
+// Os índices de coluna de cada linha ficam ordenados e sem repetição; o
+// formato CSC de uma matriz é o CSR da sua transposta (Transpose()).
+// Uma visão (View) lê os três arrays de memória externa, como um arquivo
+// mapeado, sem copiar; cópias da visão compartilham essa memória.
+class SparseMatrix {
+private:
+    int rows;
+    int cols;
+    std::vector<std::int64_t> rowPointers; // rows + 1 posições
+    std::vector<int> columnIndices;
+    std::vector<double> values;
+
+    // Arrays externos da visão (nulos quando a matriz usa os vetores acima)
+    const std::int64_t* externalPointers = nullptr;
+    const int* externalIndices = nullptr;
+    const double* externalValues = nullptr;
+    std::shared_ptr<void> owner;
+
+public:
+    SparseMatrix() : rows(0), cols(0), rowPointers(1, 0) {}
+
+    SparseMatrix(int rows, int cols)
+        : rows(rows), cols(cols), rowPointers(static_cast<std::size_t>(rows) + 1, 0) {}
+
+    // Construir diretamente a partir dos vetores CSR (devem estar ordenados)
+    SparseMatrix(int rows, int cols,
+                 std::vector<std::int64_t> rowPointers,
+                 std::vector<int> columnIndices,
+                 std::vector<double> values)
+        : rows(rows), cols(cols),
+          rowPointers(std::move(rowPointers)),
+          columnIndices(std::move(columnIndices)),
+          values(std::move(values)) {}
+
+    // Montar a partir de triplas; entradas repetidas são somadas
+    static SparseMatrix FromTriplets(int rows, int cols, std::vector<Triplet> triplets) {
+        SparseMatrix result(rows, cols);
+        std::sort(triplets.begin(), triplets.end(), [](const Triplet& a, const Triplet& b) {
+            return a.row != b.row ? a.row < b.row : a.col < b.col;
+        });
+
+        result.columnIndices.reserve(triplets.size());
+        result.values.reserve(triplets.size());
+        int lastRow = -1;
+        int lastCol = -1;
+        for (const Triplet& t : triplets) {
+            if (t.row < 0 || t.row >= rows || t.col < 0 || t.col >= cols) {
+                continue; // Entradas fora da matriz são ignoradas
+            }
+            if (t.row == lastRow && t.col == lastCol) {
+                result.values.back() += t.value;
+                continue;
+            }
+            result.columnIndices.push_back(t.col);
+            result.values.push_back(t.value);
+            result.rowPointers[t.row + 1]++;
+            lastRow = t.row;
+            lastCol = t.col;
+        }
+
+        for (int i = 0; i < rows; i++) {
+            result.rowPointers[i + 1] += result.rowPointers[i];
+        }
+        return result;
+    }
+
+    // Converter uma matriz densa, descartando entradas com |a| <= dropTolerance
+    static SparseMatrix FromDense(const DenseMatrix& dense, double dropTolerance = 0.0) {
+        SparseMatrix result(dense.Rows(), dense.Cols());
+        for (int i = 0; i < dense.Rows(); i++) {
+            const double* rowData = dense.Row(i);
+            for (int j = 0; j < dense.Cols(); j++) {
+                if (std::abs(rowData[j]) > dropTolerance) {
+                    result.columnIndices.push_back(j);
+                    result.values.push_back(rowData[j]);
+                }
+            }
+            result.rowPointers[i + 1] = static_cast<std::int64_t>(result.columnIndices.size());
+        }
+        return result;
+    }
+
+    // Visão sem cópia: rowPointers com rows + 1 posições e columnIndices e
+    // values com rowPointers[rows] posições, ordenados como no construtor CSR
+    static SparseMatrix View(int rows, int cols,
+                             const std::int64_t* rowPointers,
+                             const int* columnIndices,
+                             const double* values,
+                             std::shared_ptr<void> owner = nullptr) {
+        SparseMatrix view(rows, cols, std::vector<std::int64_t>(), std::vector<int>(), std::vector<double>());
+        view.externalPointers = rowPointers;
+        view.externalIndices = columnIndices;
+        view.externalValues = values;
+        view.owner = std::move(owner);
+        return view;
+    }
+
+    int Rows() const { return rows; }
+    int Cols() const { return cols; }
+    bool IsView() const { return externalPointers != nullptr; }
+    std::int64_t NonZeros() const {
+        if (IsView()) {
+            return externalPointers[rows];
+        }
+        return rowPointers.empty() ? 0 : rowPointers[rows];
+    }
+
+    ArrayView<std::int64_t> RowPointers() const {
+        return IsView() ? ArrayView<std::int64_t>(externalPointers, static_cast<std::size_t>(rows) + 1)
+                        : ArrayView<std::int64_t>(rowPointers);
+    }
+    ArrayView<int> ColumnIndices() const {
+        return IsView() ? ArrayView<int>(externalIndices, static_cast<std::size_t>(NonZeros()))
+                        : ArrayView<int>(columnIndices);
+    }
+    ArrayView<double> Values() const {
+        return IsView() ? ArrayView<double>(externalValues, static_cast<std::size_t>(NonZeros()))
+                        : ArrayView<double>(values);
+    }
+
+    // Valor de (i, j) por busca binária na linha (0 se não armazenado)
+    double At(int i, int j) const {
+        const auto rowPointers = RowPointers();
+        const auto columnIndices = ColumnIndices();
+        auto begin = columnIndices.begin() + rowPointers[i];
+        auto end = columnIndices.begin() + rowPointers[i + 1];
+        auto it = std::lower_bound(begin, end, j);
+        return (it != end && *it == j) ? Values()[it - columnIndices.begin()] : 0.0;
+    }
+
+    // y = A·x
+    void Multiply(const double* x, double* y) const {
+        const auto rowPointers = RowPointers();
+        const auto columnIndices = ColumnIndices();
+        const auto values = Values();
+        for (int i = 0; i < rows; i++) {
+            double sum = 0.0;
+            for (std::int64_t p = rowPointers[i]; p < rowPointers[i + 1]; p++) {
+                sum += values[p] * x[columnIndices[p]];
+            }
+            y[i] = sum;
+        }
+    }
+
+    // Transposta (também serve como conversão CSR -> CSC)
+    SparseMatrix Transpose() const {
+        const auto rowPointers = RowPointers();
+        const auto columnIndices = ColumnIndices();
+        const auto values = Values();
+        SparseMatrix result(cols, rows);
+        const std::int64_t nnz = NonZeros();
+        result.columnIndices.resize(nnz);
+        result.values.resize(nnz);
+
+        for (std::int64_t p = 0; p < nnz; p++) {
+            result.rowPointers[columnIndices[p] + 1]++;
+        }
+        for (int j = 0; j < cols; j++) {
+            result.rowPointers[j + 1] += result.rowPointers[j];
+        }
+
+        std::vector<std::int64_t> next(result.rowPointers.begin(), result.rowPointers.end() - 1);
+        for (int i = 0; i < rows; i++) {
+            for (std::int64_t p = rowPointers[i]; p < rowPointers[i + 1]; p++) {
+                std::int64_t q = next[columnIndices[p]]++;
+                result.columnIndices[q] = i;
+                result.values[q] = values[p];
+            }
+        }
+        return result;
+    }
+
+    // Simetria numérica: |a_ij - a_ji| <= tolerance * max|a|
+    bool IsSymmetric(double tolerance = 1e-12) const {
+        if (rows != cols) {
+            return false;
+        }
+        const auto rowPointers = RowPointers();
+        const auto columnIndices = ColumnIndices();
+        const auto values = Values();
+        double maxAbs = 0.0;
+        for (double v : values) {
+            maxAbs = std::max(maxAbs, std::abs(v));
+        }
+        SparseMatrix transpose = Transpose();
+        if (transpose.ColumnIndices() != columnIndices || transpose.RowPointers() != rowPointers) {
+            return false;
+        }
+        for (std::size_t p = 0; p < values.size(); p++) {
+            if (std::abs(values[p] - transpose.values[p]) > tolerance * maxAbs) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    DenseMatrix ToDense() const {
+        const auto rowPointers = RowPointers();
+        const auto columnIndices = ColumnIndices();
+        const auto values = Values();
+        DenseMatrix dense(rows, cols);
+        for (int i = 0; i < rows; i++) {
+            for (std::int64_t p = rowPointers[i]; p < rowPointers[i + 1]; p++) {
+                dense(i, columnIndices[p]) = values[p];
+            }
+        }
+        return dense;
+    }
+};
@@ -0,0 +1,269 @@
+#pragma once
+#include <vector>
+#include <cstdint>
+#include <algorithm>
+#include "SparseMatrix.h"
+
+// Ordenações que reduzem o preenchimento (fill-in) das fatorações esparsas.
+// Todas trabalham sobre o grafo de A + Aᵀ e devolvem uma permutação simétrica
+// perm, em que perm[k] é o índice original da k-ésima variável eliminada.
+class SparseOrdering {
+public:
+    enum class Method {
+        NATURAL,        // Sem reordenação
+        RCM,            // Reverse Cuthill-McKee (reduz a banda)
+        MINIMUM_DEGREE  // Grau mínimo (reduz o preenchimento)
+    };
+
+private:
+    // Grafo de adjacência de A + Aᵀ sem a diagonal, listas ordenadas
+    static std::vector<std::vector<int>> SymmetricAdjacency(const SparseMatrix& matrix) {
+        const int n = matrix.Rows();
+        const auto& rowPointers = matrix.RowPointers();
+        const auto& columnIndices = matrix.ColumnIndices();
+
+        std::vector<std::vector<int>> adjacency(n);
+        for (int i = 0; i < n; i++) {
+            for (std::int64_t p = rowPointers[i]; p < rowPointers[i + 1]; p++) {
+                int j = columnIndices[p];
+                if (j != i && j < n) {
+                    adjacency[i].push_back(j);
+                    adjacency[j].push_back(i);
+                }
+            }
+        }
+        for (auto& neighbors : adjacency) {
+            std::sort(neighbors.begin(), neighbors.end());
+            neighbors.erase(std::unique(neighbors.begin(), neighbors.end()), neighbors.end());
+        }
+        return adjacency;
+    }
+
+    // Busca em largura a partir de start; devolve os níveis visitados em ordem
+    static int BreadthFirst(const std::vector<std::vector<int>>& adjacency, int start,
+                            std::vector<int>& level, std::vector<int>& order) {
+        order.clear();
+        order.push_back(start);
+        level[start] = 0;
+        int depth = 0;
+        for (std::size_t head = 0; head < order.size(); head++) {
+            int node = order[head];
+            for (int neighbor : adjacency[node]) {
+                if (level[neighbor] < 0) {
+                    level[neighbor] = level[node] + 1;
+                    depth = std::max(depth, level[neighbor]);
+                    order.push_back(neighbor);
+                }
+            }
+        }
+        return depth;
+    }
+
+public:
+    static std::vector<int> Natural(int n) {
+        std::vector<int> permutation(n);
+        for (int i = 0; i < n; i++) {
+            permutation[i] = i;
+        }
+        return permutation;
+    }
+
+    // Reverse Cuthill-McKee: BFS por componente, a partir de um nó
+    // pseudo-periférico, visitando vizinhos em ordem crescente de grau
+    static std::vector<int> ReverseCuthillMcKee(const SparseMatrix& matrix) {
+        const int n = matrix.Rows();
+        auto adjacency = SymmetricAdjacency(matrix);
+        auto degree = [&](int node) { return static_cast<int>(adjacency[node].size()); };
+
+        std::vector<int> permutation;
+        permutation.reserve(n);
+        std::vector<bool> visited(n, false);
+        std::vector<int> level(n, -1);
+        std::vector<int> component;
+
+        for (int seed = 0; seed < n; seed++) {
+            if (visited[seed]) continue;
+
+            // Nó pseudo-periférico (George-Liu): repetir a BFS a partir do nó de
+            // menor grau do último nível enquanto a excentricidade aumentar
+            int start = seed;
+            int depth = BreadthFirst(adjacency, start, level, component);
+            for (;;) {
+                int candidate = -1;
+                for (int node : component) {
+                    if (level[node] == depth && (candidate < 0 || degree(node) < degree(candidate))) {
+                        candidate = node;
+                    }
+                }
+                for (int node : component) level[node] = -1;
+                int candidateDepth = BreadthFirst(adjacency, candidate, level, component);
+                if (candidateDepth <= depth) {
+                    for (int node : component) level[node] = -1;
+                    break;
+                }
+                start = candidate;
+                depth = candidateDepth;
+            }
+
+            // Cuthill-McKee a partir do nó escolhido
+            std::size_t head = permutation.size();
+            permutation.push_back(start);
+            visited[start] = true;
+            std::vector<int> neighbors;
+            for (; head < permutation.size(); head++) {
+                neighbors.clear();
+                for (int neighbor : adjacency[permutation[head]]) {
+                    if (!visited[neighbor]) {
+                        visited[neighbor] = true;
+                        neighbors.push_back(neighbor);
+                    }
+                }
+                std::sort(neighbors.begin(), neighbors.end(), [&](int a, int b) {
+                    return degree(a) != degree(b) ? degree(a) < degree(b) : a < b;
+                });
+                permutation.insert(permutation.end(), neighbors.begin(), neighbors.end());
+            }
+        }
+
+        std::reverse(permutation.begin(), permutation.end());
+        return permutation;
+    }
+
+    // Grau mínimo aproximado sobre o grafo quociente (AMD sem supervariáveis):
+    // cada nó eliminado vira um "elemento" cuja lista de variáveis representa o
+    // clique criado, sem formar as arestas de preenchimento explicitamente. O grau
+    // de cada variável afetada é estimado por |A_i| + |L_p| + soma |L_e \ L_p|,
+    // em tempo proporcional às listas percorridas. Elementos contidos em L_p são
+    // absorvidos. As variáveis ficam em listas encadeadas por grau (baldes), com
+    // atualização em O(1).
+    static std::vector<int> MinimumDegree(const SparseMatrix& matrix) {
+        const int n = matrix.Rows();
+        auto variables = SymmetricAdjacency(matrix);     // A_i: variáveis adjacentes
+        std::vector<std::vector<int>> elements(n);       // E_i: elementos adjacentes
+        std::vector<std::vector<int>> elementPattern(n); // L_e: variáveis do elemento e
+        std::vector<int> degree(n);
+        std::vector<bool> eliminated(n, false);
+        std::vector<bool> absorbed(n, false);
+
+        // Baldes de grau: head[d] é o primeiro nó com grau d
+        std::vector<int> head(n + 1, -1), next(n, -1), previous(n, -1);
+        int minDegree = n;
+        auto insert = [&](int node) {
+            int d = degree[node];
+            previous[node] = -1;
+            next[node] = head[d];
+            if (head[d] >= 0) previous[head[d]] = node;
+            head[d] = node;
+            minDegree = std::min(minDegree, d);
+        };
+        auto remove = [&](int node) {
+            if (previous[node] >= 0) next[previous[node]] = next[node];
+            else head[degree[node]] = next[node];
+            if (next[node] >= 0) previous[next[node]] = previous[node];
+        };
+        for (int i = n - 1; i >= 0; i--) {
+            degree[i] = static_cast<int>(variables[i].size());
+            insert(i);
+        }
+
+        std::vector<int> permutation;
+        permutation.reserve(n);
+        std::vector<int> mark(n, -1);            // Marcação de L_p pelo passo atual
+        std::vector<int> external(n, 0);         // |L_e \ L_p| para elementos vistos
+        std::vector<int> externalMark(n, -1);
+
+        for (int step = 0; step < n; step++) {
+            while (head[minDegree] < 0) {
+                minDegree++;
+            }
+            const int pivot = head[minDegree];
+            remove(pivot);
+            eliminated[pivot] = true;
+            permutation.push_back(pivot);
+
+            // L_p = (A_p ∪ L_e para e em E_p) \ {p}; os elementos de E_p são absorvidos
+            std::vector<int>& pattern = elementPattern[pivot];
+            mark[pivot] = step;
+            for (int i : variables[pivot]) {
+                if (!eliminated[i] && mark[i] != step) {
+                    mark[i] = step;
+                    pattern.push_back(i);
+                }
+            }
+            for (int e : elements[pivot]) {
+                if (absorbed[e]) continue;
+                for (int i : elementPattern[e]) {
+                    if (!eliminated[i] && mark[i] != step) {
+                        mark[i] = step;
+                        pattern.push_back(i);
+                    }
+                }
+                absorbed[e] = true;
+                std::vector<int>().swap(elementPattern[e]);
+            }
+            std::vector<int>().swap(variables[pivot]);
+            std::vector<int>().swap(elements[pivot]);
+
+            // |L_e \ L_p| para os elementos vizinhos das variáveis de L_p
+            for (int i : pattern) {
+                for (int e : elements[i]) {
+                    if (absorbed[e]) continue;
+                    if (externalMark[e] != step) {
+                        externalMark[e] = step;
+                        external[e] = static_cast<int>(elementPattern[e].size());
+                    }
+                    external[e]--;
+                }
+            }
+
+            const int patternSize = static_cast<int>(pattern.size());
+            const int remaining = n - step - 1;
+            for (int i : pattern) {
+                // Elementos: descartar absorvidos e os contidos em L_p; acrescentar p
+                std::vector<int>& adjacentElements = elements[i];
+                int externalSum = 0;
+                std::size_t kept = 0;
+                for (int e : adjacentElements) {
+                    if (absorbed[e]) continue;
+                    if (external[e] == 0) {
+                        absorbed[e] = true; // Absorção agressiva
+                        std::vector<int>().swap(elementPattern[e]);
+                        continue;
+                    }
+                    externalSum += external[e];
+                    adjacentElements[kept++] = e;
+                }
+                adjacentElements.resize(kept);
+                adjacentElements.push_back(pivot);
+
+                // Variáveis: arestas cobertas por L_p deixam de ser necessárias
+                std::vector<int>& adjacentVariables = variables[i];
+                kept = 0;
+                for (int j : adjacentVariables) {
+                    if (!eliminated[j] && mark[j] != step) {
+                        adjacentVariables[kept++] = j;
+                    }
+                }
+                adjacentVariables.resize(kept);
+
+                int estimate = static_cast<int>(kept) + (patternSize - 1) + externalSum;
+                remove(i);
+                degree[i] = std::min(remaining, estimate);
+                insert(i);
+            }
+        }
+
+        return permutation;
+    }
+
+    static std::vector<int> Compute(const SparseMatrix& matrix, Method method) {
+        switch (method) {
+            case Method::RCM:
+                return ReverseCuthillMcKee(matrix);
+            case Method::MINIMUM_DEGREE:
+                return MinimumDegree(matrix);
+            default:
+                return Natural(matrix.Rows());
+        }
+    }
+};
@@ -0,0 +1,386 @@
+#pragma once
+#include <vector>
+#include <cmath>
+#include <algorithm>
+#include <utility>
+#include "DenseMatrix.h"
+#include "SimdKernels.h"
+#include "ThreadPool.h"
+
+// Fatorações em blocos para matrizes simétricas, usando apenas o triângulo
+// inferior (o superior não é lido; recebe lixo perto da diagonal):
+//   - Cholesky: A = L·Lᵀ, para matrizes positivas definidas;
+//   - Bunch-Kaufman: P·A·Pᵀ = L·D·Lᵀ, com D em blocos 1x1 e 2x2, para
+//     matrizes indefinidas.
+// Ambas fazem cerca de n³/3 operações, metade da LU. Cada painel é fatorado sem
+// blocos e a submatriz restante recebe uma atualização simétrica
+// (A22 -= L21·W21ᵀ) só no triângulo inferior, com o mesmo micro-kernel 4x8 da
+// LU em blocos. No Bunch-Kaufman as atualizações do painel são adiadas (como
+// no dlasyf do LAPACK): W guarda as colunas já atualizadas (W = L·D) e cada
+// nova coluna é obtida por A(:, k) - L·W(k, :)ᵀ.
+template <typename T>
+class SymmetricFactorization {
+public:
+    static constexpr int DEFAULT_BLOCK_SIZE = 64;
+
+private:
+    static constexpr int MR = 4;
+    static constexpr int NR = 8;
+    static constexpr int COLUMN_TILE = 128;
+
+    // Constante de Bunch-Kaufman (1 + √17) / 8, que limita o crescimento dos fatores
+    static constexpr double BUNCH_KAUFMAN_ALPHA = 0.6403882032022076;
+
+    // Produto escalar com quatro acumuladores (quebra a cadeia de dependência
+    // e permite vetorização sem reassociar a soma como -ffast-math faria)
+    static T Dot(int n, const T* x, const T* y) {
+        T s0 = T(0), s1 = T(0), s2 = T(0), s3 = T(0);
+        int i = 0;
+        for (; i + 4 <= n; i += 4) {
+            s0 += x[i] * y[i];
+            s1 += x[i + 1] * y[i + 1];
+            s2 += x[i + 2] * y[i + 2];
+            s3 += x[i + 3] * y[i + 3];
+        }
+        for (; i < n; i++) {
+            s0 += x[i] * y[i];
+        }
+        return (s0 + s1) + (s2 + s3);
+    }
+
+    // a(i, j) -= a(i, k0:k1) · panel(:, j) para k1 <= j <= i, linhas [rowBegin, rowEnd).
+    // panel guarda o painel transposto (linha t = coluna k0 + t de W)
+    static void UpdateLowerTrailing(DenseMatrixT<T>& a, int k0, int k1, const DenseMatrixT<T>& panel,
+                                    int rowBegin, int rowEnd) {
+        const std::ptrdiff_t stride = a.Stride();
+        const std::ptrdiff_t panelStride = panel.Stride();
+        const int kb = k1 - k0;
+
+        auto updateEdge = [&](int row, int colBegin, int colEnd) {
+            T* target = a.Row(row);
+            for (int p = 0; p < kb; p++) {
+                const T factor = target[k0 + p];
+                if (factor == T(0)) continue;
+                SimdAxpy(colEnd - colBegin, -factor, panel.Row(p) + colBegin, target + colBegin);
+            }
+        };
+
+        // Faixas de COLUMN_TILE colunas mantêm a parte usada do painel na cache
+        for (int jj = k1; jj < rowEnd; jj += COLUMN_TILE) {
+            const int jEnd = std::min(rowEnd, jj + COLUMN_TILE);
+            int i = std::max(rowBegin, jj);
+            for (; i + MR <= rowEnd; i += MR) {
+                // Micro-blocos até a diagonal do bloco de linhas; o resto por linha
+                const int limit = std::min(jEnd, i + MR);
+                int j = jj;
+                for (; j + NR <= limit; j += NR) {
+                    SimdGemm4x8(kb, &a(i, k0), stride, &panel(0, j), panelStride, &a(i, j), stride);
+                }
+                for (int r = 0; r < MR; r++) {
+                    const int end = std::min(jEnd, i + r + 1);
+                    if (j < end) {
+                        updateEdge(i + r, j, end);
+                    }
+                }
+            }
+            for (; i < rowEnd; i++) {
+                updateEdge(i, jj, std::min(jEnd, i + 1));
+            }
+        }
+    }
+
+public:
+    // Cholesky em blocos in-place (triângulo inferior). Retorna -1 em caso de
+    // sucesso ou a primeira coluna cujo pivô (antes da raiz) não passa de tolerance.
+    static int FactorCholesky(DenseMatrixT<T>& a, int blockSize, T tolerance, ThreadPool* pool = nullptr) {
+        DenseMatrixT<T> panel;
+        return FactorCholesky(a, blockSize, tolerance, panel, pool);
+    }
+
+    // Mesma fatoração com o painel auxiliar do chamador (reaproveitado entre chamadas)
+    static int FactorCholesky(DenseMatrixT<T>& a, int blockSize, T tolerance, DenseMatrixT<T>& panel,
+                              ThreadPool* pool = nullptr) {
+        const int n = a.Rows();
+        if (blockSize < 1) {
+            blockSize = DEFAULT_BLOCK_SIZE;
+        }
+        panel.Resize(std::min(blockSize, n), n);
+
+        for (int k0 = 0; k0 < n; k0 += blockSize) {
+            const int k1 = std::min(n, k0 + blockSize);
+
+            // Bloco diagonal sem blocos
+            for (int j = k0; j < k1; j++) {
+                const T* rowJ = a.Row(j);
+                for (int i = j; i < k1; i++) {
+                    T* rowI = a.Row(i);
+                    const T sum = rowI[j] - Dot(j - k0, rowI + k0, rowJ + k0);
+                    if (i == j) {
+                        if (!(sum > tolerance)) {
+                            return j;
+                        }
+                        rowI[j] = std::sqrt(sum);
+                    } else {
+                        rowI[j] = sum / rowJ[j];
+                    }
+                }
+            }
+
+            if (k1 >= n) {
+                break;
+            }
+
+            // L21 = A21 · L11⁻ᵀ (linhas independentes)
+            ParallelFor(pool, k1, n, 2 * MR, [&](int rowBegin, int rowEnd) {
+                for (int i = rowBegin; i < rowEnd; i++) {
+                    T* rowI = a.Row(i);
+                    for (int j = k0; j < k1; j++) {
+                        const T* rowJ = a.Row(j);
+                        const T sum = rowI[j] - Dot(j - k0, rowI + k0, rowJ + k0);
+                        rowI[j] = sum / rowJ[j];
+                    }
+                }
+            });
+
+            for (int t = 0; t < k1 - k0; t++) {
+                T* panelRow = panel.Row(t);
+                for (int j = k1; j < n; j++) {
+                    panelRow[j] = a(j, k0 + t);
+                }
+            }
+
+            ParallelFor(pool, k1, n, 2 * MR, [&](int rowBegin, int rowEnd) {
+                UpdateLowerTrailing(a, k0, k1, panel, rowBegin, rowEnd);
+            });
+        }
+
+        return -1;
+    }
+
+    // Bunch-Kaufman em blocos in-place. pivots[k] >= 0 indica bloco 1x1 com troca
+    // k <-> pivots[k]; pivots[k] = pivots[k + 1] = -(p + 1) indica bloco 2x2 com
+    // troca k + 1 <-> p. D fica na diagonal e offDiagonal[k] guarda o elemento
+    // fora da diagonal dos blocos 2x2 (a(k + 1, k) passa a ser zero em L).
+    // Retorna -1 em caso de sucesso ou a coluna em que a matriz se mostrou singular.
+    static int FactorLDLT(DenseMatrixT<T>& a, std::vector<int>& pivots, std::vector<T>& offDiagonal,
+                          int blockSize, T tolerance, ThreadPool* pool = nullptr) {
+        DenseMatrixT<T> w;
+        DenseMatrixT<T> panel;
+        return FactorLDLT(a, pivots, offDiagonal, blockSize, tolerance, w, panel, pool);
+    }
+
+    // Mesma fatoração com W e o painel auxiliares do chamador
+    static int FactorLDLT(DenseMatrixT<T>& a, std::vector<int>& pivots, std::vector<T>& offDiagonal,
+                          int blockSize, T tolerance, DenseMatrixT<T>& w, DenseMatrixT<T>& panel,
+                          ThreadPool* pool = nullptr) {
+        const int n = a.Rows();
+        if (blockSize < 1) {
+            blockSize = DEFAULT_BLOCK_SIZE;
+        }
+        pivots.assign(n, 0);
+        offDiagonal.assign(n, T(0));
+
+        // W: colunas atualizadas do painel (um bloco 2x2 pode usar a coluna extra)
+        const int maxPanel = std::min(blockSize, n) + 1;
+        w.Resize(n, maxPanel);
+        panel.Resize(maxPanel, n);
+        const T alpha = static_cast<T>(BUNCH_KAUFMAN_ALPHA);
+
+        // Coluna "source" de A atualizada pelas "done" colunas já fatoradas do
+        // painel, gravada em w(:, target) nas linhas [k, n)
+        auto updatedColumn = [&](int source, int k, int k0, int done, int target) {
+            const T* wSource = w.Row(source);
+            for (int i = k; i < n; i++) {
+                const T* rowI = a.Row(i);
+                const T value = i < source ? a(source, i) : rowI[source];
+                w(i, target) = value - Dot(done, rowI + k0, wSource);
+            }
+        };
+
+        int k = 0;
+        while (k < n) {
+            const int k0 = k;
+            int c = 0;
+
+            while (k < n && c < blockSize) {
+                updatedColumn(k, k, k0, c, c);
+
+                const T absakk = std::abs(w(k, c));
+                int imax = k;
+                T colmax = T(0);
+                for (int i = k + 1; i < n; i++) {
+                    if (std::abs(w(i, c)) > colmax) {
+                        colmax = std::abs(w(i, c));
+                        imax = i;
+                    }
+                }
+                if (!(std::max(absakk, colmax) > tolerance)) {
+                    return k;
+                }
+
+                int kstep = 1;
+                int p = k;
+                if (absakk < alpha * colmax) {
+                    updatedColumn(imax, k, k0, c, c + 1);
+                    T rowmax = T(0);
+                    for (int i = k; i < n; i++) {
+                        if (i != imax) {
+                            rowmax = std::max(rowmax, std::abs(w(i, c + 1)));
+                        }
+                    }
+
+                    if (absakk >= alpha * colmax * (colmax / rowmax)) {
+                        p = k;
+                    } else if (std::abs(w(imax, c + 1)) >= alpha * rowmax) {
+                        p = imax;
+                        for (int i = k; i < n; i++) {
+                            w(i, c) = w(i, c + 1);
+                        }
+                    } else {
+                        p = imax;
+                        kstep = 2;
+                    }
+                }
+
+                // Troca simétrica kk <-> p: parte ainda não atualizada (triângulo
+                // inferior), linhas à esquerda (L já calculado) e linhas de W
+                const int kk = k + kstep - 1;
+                if (p != kk) {
+                    std::swap(a(kk, kk), a(p, p));
+                    for (int i = kk + 1; i < p; i++) {
+                        std::swap(a(i, kk), a(p, i));
+                    }
+                    for (int i = p + 1; i < n; i++) {
+                        std::swap(a(i, kk), a(i, p));
+                    }
+                    std::swap_ranges(a.Row(kk), a.Row(kk) + kk, a.Row(p));
+                    std::swap_ranges(w.Row(kk), w.Row(kk) + c + kstep, w.Row(p));
+                }
+
+                if (kstep == 1) {
+                    const T d = w(k, c);
+                    const T inverse = T(1) / d;
+                    a(k, k) = d;
+                    for (int i = k + 1; i < n; i++) {
+                        a(i, k) = w(i, c) * inverse;
+                    }
+                    pivots[k] = p;
+                } else {
+                    const T d11 = w(k, c);
+                    const T d21 = w(k + 1, c);
+                    const T d22 = w(k + 1, c + 1);
+                    const T det = d11 * d22 - d21 * d21;
+                    if (!(std::abs(det) > T(0))) {
+                        return k;
+                    }
+                    // [l1 l2] = [w1 w2] · D⁻¹
+                    for (int i = k + 2; i < n; i++) {
+                        const T w1 = w(i, c);
+                        const T w2 = w(i, c + 1);
+                        a(i, k) = (w1 * d22 - w2 * d21) / det;
+                        a(i, k + 1) = (w2 * d11 - w1 * d21) / det;
+                    }
+                    a(k, k) = d11;
+                    a(k + 1, k + 1) = d22;
+                    a(k + 1, k) = T(0);
+                    offDiagonal[k] = d21;
+                    pivots[k] = pivots[k + 1] = -(p + 1);
+                }
+
+                k += kstep;
+                c += kstep;
+            }
+
+            // Atualização adiada da submatriz restante: A22 -= L21·W21ᵀ
+            const int k1 = k;
+            if (k1 < n) {
+                for (int t = 0; t < c; t++) {
+                    T* panelRow = panel.Row(t);
+                    for (int j = k1; j < n; j++) {
+                        panelRow[j] = w(j, t);
+                    }
+                }
+                ParallelFor(pool, k1, n, 2 * MR, [&](int rowBegin, int rowEnd) {
+                    UpdateLowerTrailing(a, k0, k1, panel, rowBegin, rowEnd);
+                });
+            }
+        }
+
+        return -1;
+    }
+
+    // Resolver L·Lᵀ·x = b in-place
+    static void SolveCholeskyInPlace(const DenseMatrixT<T>& factors, T* b) {
+        const int n = factors.Rows();
+        for (int i = 0; i < n; i++) {
+            const T* rowData = factors.Row(i);
+            T sum = b[i];
+            for (int j = 0; j < i; j++) {
+                sum -= rowData[j] * b[j];
+            }
+            b[i] = sum / rowData[i];
+        }
+        for (int i = n - 1; i >= 0; i--) {
+            b[i] /= factors(i, i);
+            SimdAxpy(i, -b[i], factors.Row(i), b);
+        }
+    }
+
+    // Resolver P·A·Pᵀ = L·D·Lᵀ in-place: x = Pᵀ·L⁻ᵀ·D⁻¹·L⁻¹·P·b
+    static void SolveLDLTInPlace(const DenseMatrixT<T>& factors, const std::vector<int>& pivots,
+                                 const std::vector<T>& offDiagonal, T* b) {
+        const int n = factors.Rows();
+
+        for (int k = 0; k < n; ) {
+            if (pivots[k] >= 0) {
+                std::swap(b[k], b[pivots[k]]);
+                k++;
+            } else {
+                std::swap(b[k + 1], b[-pivots[k] - 1]);
+                k += 2;
+            }
+        }
+
+        // L unitária (a(k + 1, k) = 0 nos blocos 2x2)
+        for (int i = 1; i < n; i++) {
+            const T* rowData = factors.Row(i);
+            T sum = b[i];
+            for (int j = 0; j < i; j++) {
+                sum -= rowData[j] * b[j];
+            }
+            b[i] = sum;
+        }
+
+        for (int k = 0; k < n; ) {
+            if (pivots[k] >= 0) {
+                b[k] /= factors(k, k);
+                k++;
+            } else {
+                const T d11 = factors(k, k);
+                const T d21 = offDiagonal[k];
+                const T d22 = factors(k + 1, k + 1);
+                const T det = d11 * d22 - d21 * d21;
+                const T b1 = b[k];
+                const T b2 = b[k + 1];
+                b[k] = (d22 * b1 - d21 * b2) / det;
+                b[k + 1] = (d11 * b2 - d21 * b1) / det;
+                k += 2;
+            }
+        }
+
+        for (int i = n - 1; i > 0; i--) {
+            SimdAxpy(i, -b[i], factors.Row(i), b);
+        }
+
+        // Trocas desfeitas na ordem inversa
+        for (int k = n - 1; k >= 0; ) {
+            if (pivots[k] >= 0) {
+                std::swap(b[k], b[pivots[k]]);
+                k--;
+            } else {
+                std::swap(b[k], b[-pivots[k] - 1]); // k é a segunda coluna do bloco
+                k -= 2;
+            }
+        }
+    }
+};
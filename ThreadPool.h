@@ -0,0 +1,154 @@
+#pragma once
+#include <vector>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <atomic>
+#include <functional>
+#include <algorithm>
+#include <cstdint>
+
+// Pool de threads persistente para laços paralelos (ParallelFor).
+// As threads são criadas uma única vez e dormem entre as chamadas; a thread
+// que chama ParallelFor também processa partes do intervalo. Chamadas de
+// threads diferentes são serializadas; ParallelFor não deve ser aninhado.
+class ThreadPool {
+private:
+    std::vector<std::thread> workers;
+    std::mutex mutex;
+    std::mutex submitMutex;
+    std::condition_variable wakeCondition;
+    std::condition_variable doneCondition;
+
+    // Tarefa atual (escrita apenas quando nenhuma thread está trabalhando)
+    const std::function<void(int, int)>* jobBody = nullptr;
+    int jobBegin = 0;
+    int jobEnd = 0;
+    int jobChunkSize = 1;
+    int jobChunkCount = 0;
+    std::atomic<int> nextChunk{0};
+    std::atomic<int> remainingChunks{0};
+    int activeWorkers = 0;
+    std::uint64_t generation = 0;
+    bool stopping = false;
+
+    // Processar partes do intervalo até acabarem
+    void RunChunks() {
+        for (;;) {
+            int chunk = nextChunk.fetch_add(1);
+            if (chunk >= jobChunkCount) {
+                break;
+            }
+            int begin = jobBegin + chunk * jobChunkSize;
+            int end = std::min(jobEnd, begin + jobChunkSize);
+            (*jobBody)(begin, end);
+            if (remainingChunks.fetch_sub(1) == 1) {
+                std::lock_guard<std::mutex> lock(mutex);
+                doneCondition.notify_all();
+            }
+        }
+    }
+
+    void WorkerLoop() {
+        std::uint64_t seenGeneration = 0;
+        for (;;) {
+            {
+                std::unique_lock<std::mutex> lock(mutex);
+                wakeCondition.wait(lock, [&] { return stopping || generation != seenGeneration; });
+                if (stopping) {
+                    return;
+                }
+                seenGeneration = generation;
+                activeWorkers++;
+            }
+
+            RunChunks();
+
+            {
+                std::lock_guard<std::mutex> lock(mutex);
+                activeWorkers--;
+                doneCondition.notify_all();
+            }
+        }
+    }
+
+public:
+    // threadCount inclui a thread chamadora; 0 usa o número de núcleos
+    explicit ThreadPool(int threadCount = 0) {
+        if (threadCount <= 0) {
+            threadCount = static_cast<int>(std::max(1u, std::thread::hardware_concurrency()));
+        }
+        for (int i = 1; i < threadCount; i++) {
+            workers.emplace_back(&ThreadPool::WorkerLoop, this);
+        }
+    }
+
+    ~ThreadPool() {
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            stopping = true;
+        }
+        wakeCondition.notify_all();
+        for (auto& worker : workers) {
+            worker.join();
+        }
+    }
+
+    ThreadPool(const ThreadPool&) = delete;
+    ThreadPool& operator=(const ThreadPool&) = delete;
+
+    int ThreadCount() const { return static_cast<int>(workers.size()) + 1; }
+
+    // Executar body(begin, end) sobre partes de [begin, end) com pelo menos
+    // minChunk iterações cada; retorna quando todas as partes terminaram
+    void ParallelFor(int begin, int end, int minChunk, const std::function<void(int, int)>& body) {
+        if (end <= begin) {
+            return;
+        }
+
+        const int range = end - begin;
+        minChunk = std::max(1, minChunk);
+        int chunkCount = std::min(ThreadCount() * 4, (range + minChunk - 1) / minChunk);
+
+        if (workers.empty() || chunkCount <= 1) {
+            body(begin, end);
+            return;
+        }
+
+        std::lock_guard<std::mutex> submitLock(submitMutex);
+        {
+            // Threads atrasadas da tarefa anterior precisam sair antes da nova ser publicada
+            std::unique_lock<std::mutex> lock(mutex);
+            doneCondition.wait(lock, [&] { return activeWorkers == 0; });
+            jobBody = &body;
+            jobBegin = begin;
+            jobEnd = end;
+            jobChunkSize = (range + chunkCount - 1) / chunkCount;
+            jobChunkCount = (range + jobChunkSize - 1) / jobChunkSize;
+            nextChunk.store(0);
+            remainingChunks.store(jobChunkCount);
+            generation++;
+        }
+        wakeCondition.notify_all();
+
+        RunChunks();
+
+        // Esperar as partes restantes e a saída de todas as threads da tarefa
+        std::unique_lock<std::mutex> lock(mutex);
+        doneCondition.wait(lock, [&] { return remainingChunks.load() == 0 && activeWorkers == 0; });
+        jobBody = nullptr;
+    }
+};
+
+// Executar em paralelo quando houver pool; caso contrário, em sequência.
+// O corpo é repassado por std::ref: a std::function do pool só guarda a
+// referência (sem alocação no heap, mesmo com lambdas de muitas capturas) e o
+// caminho sequencial chama o lambda diretamente.
+template <typename Body>
+inline void ParallelFor(ThreadPool* pool, int begin, int end, int minChunk, Body&& body) {
+    if (pool) {
+        pool->ParallelFor(begin, end, minChunk, std::ref(body));
+    } else if (end > begin) {
+        body(begin, end);
+    }
+}
@@ -0,0 +1,232 @@
+#pragma once
+#include <vector>
+#include <cmath>
+#include <memory>
+#include <algorithm>
+#include "LinearSolver.h"
+#include "BatchSolver.h"
+#include "ThreadPool.h"
+
+// Lote de sistemas tridiagonais independentes do mesmo tamanho em layout SoA:
+// a mesma posição de todos os sistemas fica contígua, então cada passo do
+// algoritmo de Thomas é aplicado a vários sistemas por instrução SIMD.
+// Diagonais como no dgtsv: lower[i] = a(i + 1, i) e upper[i] = a(i, i + 1).
+struct TridiagonalBatch {
+    int size;   // Número de variáveis de cada sistema
+    int count;  // Número de sistemas
+    std::vector<double> lower;     // [i * count + sistema], i < size - 1
+    std::vector<double> diagonal;  // [i * count + sistema]
+    std::vector<double> upper;     // [i * count + sistema], i < size - 1
+    std::vector<double> constants; // [i * count + sistema]
+
+    TridiagonalBatch() : size(0), count(0) {}
+
+    TridiagonalBatch(int size, int count)
+        : size(size), count(count),
+          lower(static_cast<std::size_t>(std::max(0, size - 1)) * count, 0.0),
+          diagonal(static_cast<std::size_t>(size) * count, 0.0),
+          upper(static_cast<std::size_t>(std::max(0, size - 1)) * count, 0.0),
+          constants(static_cast<std::size_t>(size) * count, 0.0) {}
+
+    double& Lower(int system, int i) { return lower[static_cast<std::size_t>(i) * count + system]; }
+    double& Diagonal(int system, int i) { return diagonal[static_cast<std::size_t>(i) * count + system]; }
+    double& Upper(int system, int i) { return upper[static_cast<std::size_t>(i) * count + system]; }
+    double& Constant(int system, int i) { return constants[static_cast<std::size_t>(i) * count + system]; }
+    double Lower(int system, int i) const { return lower[static_cast<std::size_t>(i) * count + system]; }
+    double Diagonal(int system, int i) const { return diagonal[static_cast<std::size_t>(i) * count + system]; }
+    double Upper(int system, int i) const { return upper[static_cast<std::size_t>(i) * count + system]; }
+    double Constant(int system, int i) const { return constants[static_cast<std::size_t>(i) * count + system]; }
+};
+
+// Resolve lotes de sistemas tridiagonais pelo algoritmo de Thomas, com os
+// sistemas nas faixas SIMD: blocos de SYSTEMS_PER_CHUNK sistemas vizinhos
+// avançam juntos (sem desvios por sistema) e os blocos são distribuídos entre
+// as threads. Sistemas com pivô nulo (Thomas não pivoteia) são refeitos
+// individualmente pela LU em banda do LinearSolver.
+class BatchTridiagonalSolver {
+public:
+    static constexpr int SYSTEMS_PER_CHUNK = 64;
+
+private:
+    static constexpr double EPSILON = 1e-10;
+
+    std::shared_ptr<ThreadPool> threadPool;
+    LinearSolver fallbackSolver;
+
+    // Thomas sobre "lanes" sistemas; os ponteiros já apontam para o primeiro
+    // sistema do bloco e as linhas ficam a "count" posições umas das outras.
+    // work ([i * lanes + l]) guarda o inverso do pivô da linha i até a linha
+    // seguinte trocá-lo pelo coeficiente superior modificado.
+#if defined(__GNUC__) || defined(__clang__)
+    __attribute__((always_inline))
+#endif
+    static inline void SolveChunkKernel(int n, int count, int lanes,
+                                        const double* lower, const double* diagonal,
+                                        const double* upper, const double* constants,
+                                        double* work, double* x, bool* singular) {
+        for (int l = 0; l < lanes; l++) {
+            const double pivot = diagonal[l];
+            const bool zeroPivot = !(std::abs(pivot) > EPSILON);
+            const double inversePivot = zeroPivot ? 0.0 : 1.0 / (zeroPivot ? 1.0 : pivot);
+            singular[l] = zeroPivot;
+            x[l] = constants[l] * inversePivot;
+            work[l] = inversePivot;
+        }
+
+        for (int i = 1; i < n; i++) {
+            const std::size_t row = static_cast<std::size_t>(i) * count;
+            const std::size_t previous = row - count;
+            const double* __restrict sub = lower + previous;
+            const double* __restrict super = upper + previous;
+            double* __restrict previousWork = work + static_cast<std::size_t>(i - 1) * lanes;
+            double* __restrict currentWork = work + static_cast<std::size_t>(i) * lanes;
+            for (int l = 0; l < lanes; l++) {
+                // previousWork ainda guarda 1 / pivô da linha anterior
+                const double modifiedUpper = super[l] * previousWork[l];
+                previousWork[l] = modifiedUpper;
+                const double pivot = diagonal[row + l] - sub[l] * modifiedUpper;
+                const bool zeroPivot = !(std::abs(pivot) > EPSILON);
+                const double inversePivot = zeroPivot ? 0.0 : 1.0 / (zeroPivot ? 1.0 : pivot);
+                singular[l] |= zeroPivot;
+                x[row + l] = (constants[row + l] - sub[l] * x[previous + l]) * inversePivot;
+                currentWork[l] = inversePivot;
+            }
+        }
+
+        for (int i = n - 2; i >= 0; i--) {
+            const std::size_t row = static_cast<std::size_t>(i) * count;
+            const double* __restrict currentWork = work + static_cast<std::size_t>(i) * lanes;
+            for (int l = 0; l < lanes; l++) {
+                x[row + l] -= currentWork[l] * x[row + count + l];
+            }
+        }
+    }
+
+    static void SolveChunkDefault(int n, int count, int lanes, const double* lower, const double* diagonal,
+                                  const double* upper, const double* constants,
+                                  double* work, double* x, bool* singular) {
+        SolveChunkKernel(n, count, lanes, lower, diagonal, upper, constants, work, x, singular);
+    }
+
+#ifdef LINEAR_SOLVER_SIMD_X86
+    __attribute__((target("avx2,fma")))
+    static void SolveChunkAvx2(int n, int count, int lanes, const double* lower, const double* diagonal,
+                               const double* upper, const double* constants,
+                               double* work, double* x, bool* singular) {
+        SolveChunkKernel(n, count, lanes, lower, diagonal, upper, constants, work, x, singular);
+    }
+
+    __attribute__((target("avx512f")))
+    static void SolveChunkAvx512(int n, int count, int lanes, const double* lower, const double* diagonal,
+                                 const double* upper, const double* constants,
+                                 double* work, double* x, bool* singular) {
+        SolveChunkKernel(n, count, lanes, lower, diagonal, upper, constants, work, x, singular);
+    }
+#endif
+
+    // Variante escolhida pelo mesmo despacho em tempo de execução dos kernels SIMD
+    static void SolveChunk(int n, int count, int lanes, const double* lower, const double* diagonal,
+                           const double* upper, const double* constants,
+                           double* work, double* x, bool* singular) {
+#ifdef LINEAR_SOLVER_SIMD_X86
+        switch (SimdKernels().level) {
+            case SimdLevel::AVX512:
+                SolveChunkAvx512(n, count, lanes, lower, diagonal, upper, constants, work, x, singular);
+                return;
+            case SimdLevel::AVX2:
+                SolveChunkAvx2(n, count, lanes, lower, diagonal, upper, constants, work, x, singular);
+                return;
+            default:
+                break;
+        }
+#endif
+        SolveChunkDefault(n, count, lanes, lower, diagonal, upper, constants, work, x, singular);
+    }
+
+    // Resolver um sistema isolado pela LU em banda com pivoteamento
+    void SolveSingle(const TridiagonalBatch& batch, int system, BatchSolution& result) const {
+        const int n = batch.size;
+        BandMatrix matrix(n, 1, 1);
+        std::vector<double> constants(n);
+        for (int i = 0; i < n; i++) {
+            matrix(i, i) = batch.Diagonal(system, i);
+            if (i + 1 < n) {
+                matrix(i + 1, i) = batch.Lower(system, i);
+                matrix(i, i + 1) = batch.Upper(system, i);
+            }
+            constants[i] = batch.Constant(system, i);
+        }
+
+        auto solution = fallbackSolver.Solve(matrix, constants);
+        result.status[system] = solution.status;
+        for (int i = 0; i < n; i++) {
+            result.values[static_cast<std::size_t>(i) * batch.count + system] =
+                solution.hasSolution ? solution.values[i] : 0.0;
+        }
+    }
+
+    // Resolver os blocos [chunkBegin, chunkEnd)
+    void SolveChunks(const TridiagonalBatch& batch, int chunkBegin, int chunkEnd, BatchSolution& result) const {
+        const int n = batch.size;
+        const int count = batch.count;
+        std::vector<double> work(static_cast<std::size_t>(n) * SYSTEMS_PER_CHUNK);
+        bool singular[SYSTEMS_PER_CHUNK];
+
+        for (int chunk = chunkBegin; chunk < chunkEnd; chunk++) {
+            const int first = chunk * SYSTEMS_PER_CHUNK;
+            const int lanes = std::min(SYSTEMS_PER_CHUNK, count - first);
+
+            SolveChunk(n, count, lanes, batch.lower.data() + first, batch.diagonal.data() + first,
+                       batch.upper.data() + first, batch.constants.data() + first,
+                       work.data(), result.values.data() + first, singular);
+
+            for (int l = 0; l < lanes; l++) {
+                bool finite = true;
+                for (int i = 0; i < n; i++) {
+                    finite = finite && std::isfinite(result.values[static_cast<std::size_t>(i) * count + first + l]);
+                }
+
+                if (singular[l] || !finite) {
+                    SolveSingle(batch, first + l, result);
+                } else {
+                    result.status[first + l] = LinearSolver::SolutionStatus::UNIQUE_SOLUTION;
+                }
+            }
+        }
+    }
+
+public:
+    // Número de threads (1 = sequencial, 0 = todos os núcleos)
+    void SetThreadCount(int count) {
+        if (count == 1) {
+            threadPool.reset();
+        } else {
+            threadPool = std::make_shared<ThreadPool>(count);
+        }
+    }
+
+    void SetThreadPool(std::shared_ptr<ThreadPool> pool) { threadPool = std::move(pool); }
+
+    // Resolver todos os sistemas do lote
+    BatchSolution Solve(const TridiagonalBatch& batch) const {
+        BatchSolution result;
+        const std::size_t offDiagonal = static_cast<std::size_t>(std::max(0, batch.size - 1)) * batch.count;
+        if (batch.size <= 0 || batch.count <= 0 ||
+            batch.diagonal.size() != static_cast<std::size_t>(batch.size) * batch.count ||
+            batch.constants.size() != batch.diagonal.size() ||
+            batch.lower.size() != offDiagonal || batch.upper.size() != offDiagonal) {
+            return result;
+        }
+
+        result.count = batch.count;
+        result.values.assign(static_cast<std::size_t>(batch.size) * batch.count, 0.0);
+        result.status.assign(batch.count, LinearSolver::SolutionStatus::CALCULATION_ERROR);
+
+        const int chunkCount = (batch.count + SYSTEMS_PER_CHUNK - 1) / SYSTEMS_PER_CHUNK;
+        ParallelFor(threadPool.get(), 0, chunkCount, 1, [&](int chunkBegin, int chunkEnd) {
+            SolveChunks(batch, chunkBegin, chunkEnd, result);
+        });
+
+        return result;
+    }
+};
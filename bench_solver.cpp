@@ -0,0 +1,677 @@
+#include <iostream>
+#include <iomanip>
+#include <vector>
+#include <chrono>
+#include <thread>
+#include <cmath>
+#include <atomic>
+#include <cstdlib>
+#include <new>
+#include <fstream>
+#include <cstdio>
+#include <sstream>
+#include "LinearSolver.h"
+#include "SolutionCache.h"
+#include "BatchSolver.h"
+#include "TridiagonalBatch.h"
+#include "MatrixReader.h"
+
+// Benchmark do LinearSolver: tempo por tamanho de sistema e escalabilidade forte
+// (mesmo problema, número crescente de threads).
+
+// Contagem global de alocações no heap (operator new substituído). O GCC não
+// enxerga que o free abaixo casa com o malloc do operator new substituído.
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic ignored "-Wmismatched-new-delete"
+#endif
+static std::atomic<long long> allocationCount{0};
+
+void* operator new(std::size_t size) {
+    allocationCount.fetch_add(1, std::memory_order_relaxed);
+    if (void* pointer = std::malloc(size ? size : 1)) {
+        return pointer;
+    }
+    throw std::bad_alloc();
+}
+
+void* operator new(std::size_t size, std::align_val_t alignment) {
+    allocationCount.fetch_add(1, std::memory_order_relaxed);
+    const std::size_t align = static_cast<std::size_t>(alignment);
+    if (void* pointer = std::aligned_alloc(align, (std::max<std::size_t>(size, 1) + align - 1) / align * align)) {
+        return pointer;
+    }
+    throw std::bad_alloc();
+}
+
+void operator delete(void* pointer) noexcept { std::free(pointer); }
+void operator delete(void* pointer, std::size_t) noexcept { std::free(pointer); }
+void operator delete(void* pointer, std::align_val_t) noexcept { std::free(pointer); }
+void operator delete(void* pointer, std::size_t, std::align_val_t) noexcept { std::free(pointer); }
+
+// Sistema determinístico bem condicionado
+static void BuildSystem(int n, DenseMatrix& matrix, std::vector<double>& constants) {
+    matrix = DenseMatrix(n, n);
+    constants.assign(n, 0.0);
+    for (int i = 0; i < n; i++) {
+        for (int j = 0; j < n; j++) {
+            matrix(i, j) = (i == j) ? n : std::sin(0.37 * i + 0.91 * j);
+        }
+        constants[i] = std::cos(0.13 * i);
+    }
+}
+
+// Melhor tempo (ms) entre algumas repetições
+template <typename Function>
+static double TimeBest(int repetitions, Function&& function) {
+    double best = 1e300;
+    for (int r = 0; r < repetitions; r++) {
+        auto start = std::chrono::steady_clock::now();
+        function();
+        auto end = std::chrono::steady_clock::now();
+        best = std::min(best, std::chrono::duration<double, std::milli>(end - start).count());
+    }
+    return best;
+}
+
+static void BenchStrongScaling(int n) {
+    DenseMatrix matrix;
+    std::vector<double> constants;
+    BuildSystem(n, matrix, constants);
+
+    const int maxThreads = static_cast<int>(std::max(1u, std::thread::hardware_concurrency()));
+    const double flops = 2.0 / 3.0 * n * static_cast<double>(n) * n;
+
+    std::cout << "\n=== Escalabilidade forte: " << n << "x" << n << " ===" << std::endl;
+    std::cout << std::setw(8) << "threads" << std::setw(12) << "ms"
+              << std::setw(12) << "GFLOP/s" << std::setw(12) << "speedup"
+              << std::setw(12) << "eficiência" << std::endl;
+
+    double baseline = 0.0;
+    for (int threads = 1; threads <= maxThreads; threads *= 2) {
+        LinearSolver solver;
+        solver.SetAlgorithm(LinearSolver::Algorithm::BLOCKED);
+        solver.SetThreadCount(threads);
+
+        bool ok = true;
+        double ms = TimeBest(3, [&] { ok = solver.Solve(matrix, constants).hasSolution && ok; });
+        if (threads == 1) {
+            baseline = ms;
+        }
+
+        std::cout << std::setw(8) << threads << std::setw(12) << std::fixed << std::setprecision(2) << ms
+                  << std::setw(12) << flops / (ms * 1e6)
+                  << std::setw(12) << baseline / ms
+                  << std::setw(12) << baseline / (ms * threads)
+                  << (ok ? "" : "  (falha)") << std::endl;
+
+        if (threads < maxThreads && threads * 2 > maxThreads) {
+            threads = maxThreads / 2; // Garantir que o número total de núcleos seja medido
+        }
+    }
+}
+
+static void BenchAlgorithms(int n) {
+    DenseMatrix matrix;
+    std::vector<double> constants;
+    BuildSystem(n, matrix, constants);
+
+    LinearSolver classic;
+    classic.SetAlgorithm(LinearSolver::Algorithm::CLASSIC);
+    LinearSolver blocked;
+    blocked.SetAlgorithm(LinearSolver::Algorithm::BLOCKED);
+
+    LinearSolver mixed;
+    mixed.SetAlgorithm(LinearSolver::Algorithm::MIXED_PRECISION);
+
+    double classicMs = TimeBest(3, [&] { classic.Solve(matrix, constants); });
+    double blockedMs = TimeBest(3, [&] { blocked.Solve(matrix, constants); });
+    int steps = 0;
+    double mixedMs = TimeBest(3, [&] { steps = mixed.Solve(matrix, constants).iterations; });
+
+    std::cout << std::setw(8) << n << std::setw(14) << std::fixed << std::setprecision(2) << classicMs
+              << std::setw(14) << blockedMs << std::setw(14) << mixedMs << std::setw(10) << steps << std::endl;
+}
+
+// Matriz simétrica positiva definida: caminho automático (Cholesky) contra a LU em blocos
+static void BenchSymmetric(int n) {
+    DenseMatrix matrix;
+    std::vector<double> constants;
+    BuildSystem(n, matrix, constants);
+    for (int i = 0; i < n; i++) {
+        for (int j = 0; j < i; j++) {
+            matrix(i, j) = matrix(j, i);
+        }
+    }
+
+    LinearSolver automatic;
+    LinearSolver blocked;
+    blocked.SetAlgorithm(LinearSolver::Algorithm::BLOCKED);
+
+    double symmetricMs = TimeBest(3, [&] { automatic.Solve(matrix, constants); });
+    double luMs = TimeBest(3, [&] { blocked.Solve(matrix, constants); });
+
+    std::cout << std::setw(8) << n << std::setw(14) << std::fixed << std::setprecision(2) << symmetricMs
+              << std::setw(14) << luMs << std::endl;
+}
+
+// Vazão (sistemas por segundo) do lote contra chamadas individuais de Solve
+static void BenchBatch(int n, int count) {
+    SystemBatch batch(n, count);
+    for (int s = 0; s < count; s++) {
+        for (int i = 0; i < n; i++) {
+            for (int j = 0; j < n; j++) {
+                batch.Coefficient(s, i, j) = (i == j) ? n : std::sin(0.37 * i + 0.91 * j + 0.01 * s);
+            }
+            batch.Constant(s, i) = std::cos(0.13 * i + s);
+        }
+    }
+
+    const int maxThreads = static_cast<int>(std::max(1u, std::thread::hardware_concurrency()));
+    BatchLinearSolver batchSolver;
+    batchSolver.SetThreadCount(maxThreads);
+    double batchMs = TimeBest(3, [&] { batchSolver.Solve(batch); });
+
+    LinearSolver solver;
+    std::vector<std::vector<double>> matrix(n, std::vector<double>(n));
+    std::vector<double> constants(n);
+    double singleMs = TimeBest(1, [&] {
+        for (int s = 0; s < count; s++) {
+            for (int i = 0; i < n; i++) {
+                for (int j = 0; j < n; j++) {
+                    matrix[i][j] = batch.Coefficient(s, i, j);
+                }
+                constants[i] = batch.Constant(s, i);
+            }
+            solver.Solve(matrix, constants);
+        }
+    });
+
+    std::cout << std::setw(8) << n << std::setw(16) << std::fixed << std::setprecision(0)
+              << count / (batchMs * 1e-3) << std::setw(16) << count / (singleMs * 1e-3) << std::endl;
+}
+
+// Fatoração esparsa de uma malha 2D (Laplaciano de 5 pontos) com cada ordenação:
+// tempo e preenchimento (entradas não nulas dos fatores)
+static void BenchSparse(int gridSize) {
+    const int n = gridSize * gridSize;
+    std::vector<Triplet> triplets;
+    for (int r = 0; r < gridSize; r++) {
+        for (int c = 0; c < gridSize; c++) {
+            int i = r * gridSize + c;
+            triplets.push_back({i, i, 4.0});
+            if (c > 0) triplets.push_back({i, i - 1, -1.2});
+            if (c + 1 < gridSize) triplets.push_back({i, i + 1, -0.8});
+            if (r > 0) triplets.push_back({i, i - gridSize, -1.0});
+            if (r + 1 < gridSize) triplets.push_back({i, i + gridSize, -1.0});
+        }
+    }
+    SparseMatrix nonsymmetric = SparseMatrix::FromTriplets(n, n, triplets);
+    for (Triplet& t : triplets) {
+        if (t.row != t.col) t.value = -1.0;
+    }
+    SparseMatrix symmetric = SparseMatrix::FromTriplets(n, n, triplets);
+
+    const char* names[] = {"natural", "RCM", "grau mínimo"};
+    const SparseOrdering::Method methods[] = {
+        SparseOrdering::Method::NATURAL, SparseOrdering::Method::RCM, SparseOrdering::Method::MINIMUM_DEGREE
+    };
+    for (int m = 0; m < 3; m++) {
+        std::vector<int> order;
+        double orderMs = TimeBest(1, [&] { order = SparseOrdering::Compute(symmetric, methods[m]); });
+
+        SparseCholesky cholesky;
+        double choleskyMs = TimeBest(1, [&] { cholesky.Factor(symmetric, order, 1e-10); });
+        SparseLU lu;
+        double luMs = TimeBest(1, [&] { lu.Factor(nonsymmetric, order, SparseLU::DEFAULT_PIVOT_THRESHOLD, 1e-10); });
+
+        std::cout << std::setw(14) << names[m] << std::setw(10) << std::fixed << std::setprecision(1) << orderMs
+                  << std::setw(12) << choleskyMs << std::setw(12) << cholesky.NonZeros()
+                  << std::setw(12) << luMs << std::setw(12) << lu.NonZeros() << std::endl;
+    }
+}
+
+// Gradiente conjugado (cada precondicionador) contra a Cholesky esparsa no
+// Laplaciano 2D simétrico
+static void BenchConjugateGradient(int gridSize) {
+    const int n = gridSize * gridSize;
+    std::vector<Triplet> triplets;
+    for (int r = 0; r < gridSize; r++) {
+        for (int c = 0; c < gridSize; c++) {
+            int i = r * gridSize + c;
+            triplets.push_back({i, i, 4.0});
+            if (c > 0) triplets.push_back({i, i - 1, -1.0});
+            if (c + 1 < gridSize) triplets.push_back({i, i + 1, -1.0});
+            if (r > 0) triplets.push_back({i, i - gridSize, -1.0});
+            if (r + 1 < gridSize) triplets.push_back({i, i + gridSize, -1.0});
+        }
+    }
+    SparseMatrix matrix = SparseMatrix::FromTriplets(n, n, triplets);
+    std::vector<double> constants(n);
+    for (int i = 0; i < n; i++) {
+        constants[i] = std::cos(0.13 * i);
+    }
+
+    LinearSolver solver;
+    double directMs = TimeBest(1, [&] { solver.Solve(matrix, constants); });
+    std::cout << std::setw(16) << "direto" << std::setw(12) << std::fixed << std::setprecision(1)
+              << directMs << std::setw(12) << "-" << std::endl;
+
+    const char* names[] = {"CG", "CG+Jacobi", "CG+bloco", "CG+IC(0)"};
+    const Preconditioner::Type types[] = {
+        Preconditioner::Type::NONE, Preconditioner::Type::JACOBI,
+        Preconditioner::Type::BLOCK_JACOBI, Preconditioner::Type::INCOMPLETE_CHOLESKY
+    };
+    for (int t = 0; t < 4; t++) {
+        LinearSolver::IterativeOptions options;
+        options.preconditioner = types[t];
+        solver.SetIterativeOptions(options);
+        LinearSolver::Solution result;
+        double ms = TimeBest(1, [&] { result = solver.SolveConjugateGradient(matrix, constants); });
+        std::cout << std::setw(16) << names[t] << std::setw(12) << ms
+                  << std::setw(12) << result.iterations << (result.hasSolution ? "" : "  (falha)") << std::endl;
+    }
+}
+
+// Matriz densa com banda 2/2: detecção automática + LU em banda contra a LU em blocos
+// Uma célula editada: fatorar de novo x correção de posto 1 + solução
+static void BenchRankOneUpdate(int n) {
+    DenseMatrix matrix;
+    std::vector<double> constants;
+    BuildSystem(n, matrix, constants);
+
+    LinearSolver solver;
+    solver.SetConditionEstimation(false);
+    auto factorization = solver.Factorize(matrix);
+
+    int edit = 0;
+    double refactorMs = TimeBest(3, [&] {
+        matrix(edit % n, (edit * 7) % n) += 0.25;
+        edit++;
+        solver.Solve(solver.Factorize(matrix), constants);
+    });
+    double updateMs = TimeBest(10, [&] {
+        const int i = edit % n;
+        const int j = (edit * 7) % n;
+        edit++;
+        factorization.UpdateEntry(i, j, factorization.Coefficients()(i, j) + 0.25);
+        solver.Solve(factorization, constants);
+    });
+
+    std::cout << std::setw(8) << n << std::setw(14) << std::fixed << std::setprecision(3) << refactorMs
+              << std::setw(14) << updateMs << std::endl;
+}
+
+// Cache: Solve completo x acerto de solução x b novo com a LU guardada
+static void BenchSolutionCache(int n) {
+    DenseMatrix matrix;
+    std::vector<double> constants;
+    BuildSystem(n, matrix, constants);
+
+    LinearSolver solver;
+    SolutionCache cache;
+    cache.Solve(solver, matrix, constants);
+    constants[0] += 1.0;
+    cache.Solve(solver, matrix, constants); // Segunda b: fatora e guarda a LU
+
+    double solveMs = TimeBest(3, [&] { solver.Solve(matrix, constants); });
+    double hitMs = TimeBest(10, [&] { cache.Solve(solver, matrix, constants); });
+    double factorMs = TimeBest(10, [&] {
+        constants[0] += 1.0;
+        cache.Solve(solver, matrix, constants);
+    });
+
+    std::cout << std::setw(8) << n << std::setw(14) << std::fixed << std::setprecision(3) << solveMs
+              << std::setw(14) << hitMs << std::setw(14) << factorMs << std::endl;
+}
+
+// Bareiss exato e eliminação modular em inteiros pequenos contra a eliminação em double
+static void BenchExact(int n, ThreadPool* pool) {
+    DenseMatrix matrix(n, n);
+    std::vector<double> constants(n);
+    unsigned state = 12345u;
+    auto next = [&] {
+        state = state * 1103515245u + 12345u;
+        return static_cast<double>(static_cast<int>((state >> 16) % 19) - 9);
+    };
+    for (int i = 0; i < n; i++) {
+        for (int j = 0; j < n; j++) {
+            matrix(i, j) = next();
+        }
+        matrix(i, i) += 20.0;
+        constants[i] = next();
+    }
+
+    LinearSolver solver;
+    ExactSolver::Result result;
+    double doubleMs = TimeBest(5, [&] { solver.Solve(matrix, constants); });
+    double exactMs = TimeBest(3, [&] { result = ExactSolver::Solve(matrix, constants); });
+    MultiModularSolver::Result modular;
+    double modularMs = TimeBest(3, [&] { modular = MultiModularSolver::Solve(matrix, constants, pool); });
+
+    const char* arithmetic = result.arithmetic == ExactSolver::Arithmetic::INT64    ? "int64"
+                             : result.arithmetic == ExactSolver::Arithmetic::INT128 ? "int128"
+                                                                                    : "BigInt";
+    std::cout << std::setw(8) << n << std::setw(14) << std::fixed << std::setprecision(3) << doubleMs
+              << std::setw(14) << exactMs << std::setw(10) << arithmetic << std::setw(14) << modularMs
+              << std::setw(10) << modular.primes << std::endl;
+}
+
+// LU fora da memória (arquivo local, painéis de 256 colunas) contra a LU em blocos na memória
+static void BenchOutOfCore(int n, ThreadPool* pool) {
+    DenseMatrix matrix;
+    std::vector<double> constants;
+    BuildSystem(n, matrix, constants);
+
+    const std::string path = "bench_out_of_core.bin";
+    OutOfCoreLU store;
+    store.Create(path, n, OutOfCoreLU::DEFAULT_PANEL_WIDTH);
+    store.WriteBlock(0, 0, matrix);
+
+    std::vector<int> pivots;
+    double inMemoryMs = TimeBest(3, [&] {
+        DenseMatrix lu = matrix;
+        BlockedLU<double>::Factor(lu, pivots, BlockedLU<double>::DEFAULT_BLOCK_SIZE, 1e-10, pool);
+    });
+    double outOfCoreMs = TimeBest(3, [&] {
+        store.Discard();
+        store.Factor(pool);
+    });
+    OutOfCoreLU::Remove(path);
+
+    std::cout << std::setw(8) << n << std::setw(14) << std::fixed << std::setprecision(1) << inMemoryMs
+              << std::setw(14) << outOfCoreMs << std::setw(14) << store.WorkingSetBytes() / (1024.0 * 1024.0)
+              << std::setw(14) << n * static_cast<double>(n) * sizeof(double) / (1024.0 * 1024.0) << std::endl;
+}
+
+// Carregar a matriz: leitura double a double (como o .calc) x MatrixFile mapeado
+static void BenchMatrixFile(int n) {
+    DenseMatrix matrix;
+    std::vector<double> constants;
+    BuildSystem(n, matrix, constants);
+
+    const std::string streamPath = "bench_matrix_stream.bin";
+    const std::string mappedPath = "bench_matrix_file.bin";
+    {
+        std::ofstream file(streamPath, std::ios::binary);
+        for (int i = 0; i < n; i++) {
+            for (int j = 0; j < n; j++) {
+                file.write(reinterpret_cast<const char*>(&matrix(i, j)), sizeof(double));
+            }
+        }
+    }
+    MatrixFile::Write(mappedPath, matrix, constants);
+
+    double streamMs = TimeBest(3, [&] {
+        std::ifstream file(streamPath, std::ios::binary);
+        DenseMatrix loaded(n, n);
+        for (int i = 0; i < n; i++) {
+            for (int j = 0; j < n; j++) {
+                file.read(reinterpret_cast<char*>(&loaded(i, j)), sizeof(double));
+            }
+        }
+    });
+    MatrixFile file;
+    double mappedMs = TimeBest(3, [&] {
+        file.Open(mappedPath);
+        DenseMatrix view = file.Dense();
+    });
+    double verifyMs = TimeBest(3, [&] { file.Verify(); });
+    const double mebibytes = file.FileBytes() / (1024.0 * 1024.0);
+    file.Close();
+    std::remove(streamPath.c_str());
+    std::remove(mappedPath.c_str());
+
+    std::cout << std::setw(8) << n << std::setw(14) << std::fixed << std::setprecision(3) << streamMs
+              << std::setw(14) << mappedMs << std::setw(14) << verifyMs << std::setw(14) << std::setprecision(1)
+              << mebibytes << std::endl;
+}
+
+// CSV de n x n com 17 dígitos: istream (>> double) x MatrixReader sem e com pool
+static void BenchMatrixReader(int n, ThreadPool* pool) {
+    DenseMatrix matrix;
+    std::vector<double> constants;
+    BuildSystem(n, matrix, constants);
+    std::string text;
+    char number[32];
+    for (int i = 0; i < n; i++) {
+        for (int j = 0; j < n; j++) {
+            std::snprintf(number, sizeof(number), j + 1 < n ? "%.17g," : "%.17g\n", matrix(i, j));
+            text += number;
+        }
+    }
+
+    double streamMs = TimeBest(3, [&] {
+        std::istringstream input(text);
+        DenseMatrix loaded(n, n);
+        for (int i = 0; i < n; i++) {
+            for (int j = 0; j < n; j++) {
+                input >> loaded(i, j);
+                input.ignore(1);
+            }
+        }
+    });
+    double sequentialMs = TimeBest(3, [&] { MatrixReader::ParseDelimited(text); });
+    double parallelMs = TimeBest(3, [&] { MatrixReader::ParseDelimited(text, pool); });
+
+    std::cout << std::setw(8) << n << std::setw(12) << std::fixed << std::setprecision(1)
+              << text.size() / (1024.0 * 1024.0) << std::setw(14) << streamMs << std::setw(14) << sequentialMs
+              << std::setw(14) << parallelMs << std::endl;
+}
+
+static void BenchBand(int n) {
+    DenseMatrix matrix(n, n);
+    std::vector<double> constants(n);
+    for (int i = 0; i < n; i++) {
+        for (int j = std::max(0, i - 2); j <= std::min(n - 1, i + 2); j++) {
+            matrix(i, j) = (i == j) ? 6.0 : std::sin(0.37 * i + 0.91 * j);
+        }
+        constants[i] = std::cos(0.13 * i);
+    }
+
+    LinearSolver automatic;
+    LinearSolver blocked;
+    blocked.SetAlgorithm(LinearSolver::Algorithm::BLOCKED);
+
+    double bandMs = TimeBest(3, [&] { automatic.Solve(matrix, constants); });
+    double luMs = TimeBest(3, [&] { blocked.Solve(matrix, constants); });
+
+    std::cout << std::setw(8) << n << std::setw(14) << std::fixed << std::setprecision(2) << bandMs
+              << std::setw(14) << luMs << std::endl;
+}
+
+// Vazão do lote tridiagonal contra SolveTridiagonal sistema a sistema
+static void BenchTridiagonalBatch(int n, int count) {
+    TridiagonalBatch batch(n, count);
+    for (int s = 0; s < count; s++) {
+        for (int i = 0; i < n; i++) {
+            batch.Diagonal(s, i) = 4.0 + std::sin(0.1 * i + s);
+            if (i + 1 < n) {
+                batch.Lower(s, i) = -1.0;
+                batch.Upper(s, i) = -1.0 + 0.5 * std::cos(0.3 * i);
+            }
+            batch.Constant(s, i) = std::cos(0.13 * i + s);
+        }
+    }
+
+    const int maxThreads = static_cast<int>(std::max(1u, std::thread::hardware_concurrency()));
+    BatchTridiagonalSolver batchSolver;
+    batchSolver.SetThreadCount(maxThreads);
+    double batchMs = TimeBest(3, [&] { batchSolver.Solve(batch); });
+
+    LinearSolver solver;
+    std::vector<double> lower(n - 1), diagonal(n), upper(n - 1), constants(n);
+    double singleMs = TimeBest(1, [&] {
+        for (int s = 0; s < count; s++) {
+            for (int i = 0; i < n; i++) {
+                diagonal[i] = batch.Diagonal(s, i);
+                constants[i] = batch.Constant(s, i);
+                if (i + 1 < n) {
+                    lower[i] = batch.Lower(s, i);
+                    upper[i] = batch.Upper(s, i);
+                }
+            }
+            solver.SolveTridiagonal(lower, diagonal, upper, constants);
+        }
+    });
+
+    std::cout << std::setw(8) << n << std::setw(16) << std::fixed << std::setprecision(0)
+              << count / (batchMs * 1e-3) << std::setw(16) << count / (singleMs * 1e-3) << std::endl;
+}
+
+// Alocações e tempo por chamada de Solve em regime (sistema já resolvido uma
+// vez): sem workspace x com SolverWorkspace e Solution reaproveitados
+static void BenchAllocations(const char* name, int n, int kind) {
+    DenseMatrix matrix;
+    std::vector<double> constants;
+    BuildSystem(n, matrix, constants);
+    for (int i = 0; i < n; i++) {
+        for (int j = 0; j < n; j++) {
+            if (kind == 1 && j < i) {
+                matrix(i, j) = matrix(j, i);
+            } else if (kind == 2) {
+                matrix(i, j) = (i == j) ? 4.0 : (std::abs(i - j) == 1 ? -1.0 : 0.0);
+            }
+        }
+    }
+
+    LinearSolver solver;
+    SolverWorkspace workspace;
+    LinearSolver::Solution result;
+    solver.Solve(matrix, constants, result, workspace);
+
+    const int repetitions = std::max(10, 2000000 / (n * n));
+    long long before = allocationCount.load();
+    auto start = std::chrono::steady_clock::now();
+    for (int r = 0; r < repetitions; r++) {
+        solver.Solve(matrix, constants);
+    }
+    auto middle = std::chrono::steady_clock::now();
+    const long long plainAllocations = allocationCount.load() - before;
+
+    before = allocationCount.load();
+    for (int r = 0; r < repetitions; r++) {
+        solver.Solve(matrix, constants, result, workspace);
+    }
+    auto end = std::chrono::steady_clock::now();
+    const long long workspaceAllocations = allocationCount.load() - before;
+
+    std::cout << std::setw(14) << name << std::setw(8) << n << std::fixed << std::setprecision(1)
+              << std::setw(12) << static_cast<double>(plainAllocations) / repetitions
+              << std::setw(12) << static_cast<double>(workspaceAllocations) / repetitions
+              << std::setprecision(2)
+              << std::setw(14) << std::chrono::duration<double, std::micro>(middle - start).count() / repetitions
+              << std::setw(14) << std::chrono::duration<double, std::micro>(end - middle).count() / repetitions
+              << std::endl;
+}
+
+int main(int argc, char* argv[]) {
+    const char* simdNames[] = {"escalar", "SSE2", "AVX2+FMA", "AVX-512"};
+    std::cout << "Kernels SIMD ativos: " << simdNames[static_cast<int>(SimdKernels().level)] << std::endl;
+    std::cout << "Núcleos disponíveis: " << std::thread::hardware_concurrency() << std::endl;
+
+    int scalingSize = argc > 1 ? std::atoi(argv[1]) : 2000;
+
+    std::cout << "\n=== Clássica x blocos x precisão mista (ms, 1 thread) ===" << std::endl;
+    std::cout << std::setw(8) << "n" << std::setw(14) << "clássica" << std::setw(14) << "blocos"
+              << std::setw(14) << "mista" << std::setw(10) << "passos" << std::endl;
+    for (int n : {100, 250, 500, 1000, 2000}) {
+        BenchAlgorithms(n);
+    }
+
+    BenchStrongScaling(scalingSize);
+
+    std::cout << "\n=== Alocações por Solve: sem x com workspace (1 thread) ===" << std::endl;
+    std::cout << std::setw(14) << "caminho" << std::setw(8) << "n" << std::setw(12) << "aloc." << std::setw(12) << "aloc. ws"
+              << std::setw(14) << "µs" << std::setw(14) << "µs ws" << std::endl;
+    BenchAllocations("fixo", 4, 0);
+    BenchAllocations("clássica", 16, 0);
+    BenchAllocations("clássica", 100, 0);
+    BenchAllocations("blocos", 500, 0);
+    BenchAllocations("simétrica", 500, 1);
+    BenchAllocations("tridiagonal", 1000, 2);
+
+    std::cout << "\n=== Edição de uma célula: refatorar x posto 1 (ms, 1 thread) ===" << std::endl;
+    std::cout << std::setw(8) << "n" << std::setw(14) << "refatorar" << std::setw(14) << "posto 1" << std::endl;
+    for (int n : {250, 500, 1000}) {
+        BenchRankOneUpdate(n);
+    }
+
+    std::cout << "\n=== Cache de soluções (ms) ===" << std::endl;
+    std::cout << std::setw(8) << "n" << std::setw(14) << "Solve" << std::setw(14) << "acerto" << std::setw(14) << "LU guardada"
+              << std::endl;
+    for (int n : {100, 500, 1000}) {
+        BenchSolutionCache(n);
+    }
+
+    std::cout << "\n=== Aritmética exata: double x Bareiss x modular (ms) ===" << std::endl;
+    std::cout << std::setw(8) << "n" << std::setw(14) << "double" << std::setw(14) << "Bareiss" << std::setw(10) << "tipo"
+              << std::setw(14) << "modular" << std::setw(10) << "primos" << std::endl;
+    {
+        ThreadPool pool(0);
+        for (int n : {5, 10, 30, 60}) {
+            BenchExact(n, &pool);
+        }
+    }
+
+    std::cout << "\n=== LU fora da memória x na memória (ms, MiB) ===" << std::endl;
+    std::cout << std::setw(8) << "n" << std::setw(14) << "memória" << std::setw(14) << "arquivo" << std::setw(14)
+              << "trabalho" << std::setw(14) << "matriz" << std::endl;
+    {
+        ThreadPool pool(0);
+        for (int n : {1000, 2000, 4000}) {
+            BenchOutOfCore(n, &pool);
+        }
+    }
+
+    std::cout << "\n=== Carregar matriz: leitura sequencial x arquivo mapeado (ms, MiB) ===" << std::endl;
+    std::cout << std::setw(8) << "n" << std::setw(14) << "sequencial" << std::setw(14) << "mapeado"
+              << std::setw(14) << "checksum" << std::setw(14) << "arquivo" << std::endl;
+    for (int n : {1000, 2000, 4000}) {
+        BenchMatrixFile(n);
+    }
+
+    std::cout << "\n=== Leitura de CSV: istream x from_chars (ms) ===" << std::endl;
+    std::cout << std::setw(8) << "n" << std::setw(12) << "MiB" << std::setw(14) << "istream"
+              << std::setw(14) << "sequencial" << std::setw(14) << "paralela" << std::endl;
+    {
+        ThreadPool pool(0);
+        for (int n : {1000, 2000, 4000}) {
+            BenchMatrixReader(n, &pool);
+        }
+    }
+
+    std::cout << "\n=== Simétrica: Cholesky x LU (ms) ===" << std::endl;
+    std::cout << std::setw(8) << "n" << std::setw(14) << "Cholesky" << std::setw(14) << "LU" << std::endl;
+    for (int n : {250, 500, 1000, 2000}) {
+        BenchSymmetric(n);
+    }
+
+    std::cout << "\n=== Lote de sistemas pequenos (sistemas/s) ===" << std::endl;
+    std::cout << std::setw(8) << "n" << std::setw(16) << "lote" << std::setw(16) << "Solve" << std::endl;
+    for (int n : {2, 4, 6, 10}) {
+        BenchBatch(n, 200000);
+    }
+    
+    std::cout << "\n=== Banda 2/2: LU em banda x LU em blocos (ms) ===" << std::endl;
+    std::cout << std::setw(8) << "n" << std::setw(14) << "banda" << std::setw(14) << "LU" << std::endl;
+    for (int n : {500, 1000, 2000}) {
+        BenchBand(n);
+    }
+
+    std::cout << "\n=== Lote tridiagonal (sistemas/s) ===" << std::endl;
+    std::cout << std::setw(8) << "n" << std::setw(16) << "lote" << std::setw(16) << "Thomas" << std::endl;
+    for (int n : {16, 128, 1024}) {
+        BenchTridiagonalBatch(n, 20000);
+    }
+    
+    std::cout << "\n=== Esparso: malha 300x300 (ms e entradas dos fatores) ===" << std::endl;
+    std::cout << std::setw(14) << "ordenação" << std::setw(10) << "ordem" << std::setw(12) << "Cholesky"
+              << std::setw(12) << "nnz(L)" << std::setw(12) << "LU" << std::setw(12) << "nnz(L+U)" << std::endl;
+    BenchSparse(300);
+    
+    std::cout << "\n=== Iterativo: malha 300x300 (ms e iterações) ===" << std::endl;
+    std::cout << std::setw(16) << "método" << std::setw(12) << "ms" << std::setw(12) << "iterações" << std::endl;
+    BenchConjugateGradient(300);
+
+    return 0;
+}
@@ -18,7 +18,11 @@
 #include <mutex>
 #include <fstream>
 #include <iostream>
+#include <filesystem>
 #include "LinearSolver.h"
+#include "MatrixReader.h"
+#include "InputModel.h"
+#include "SolutionCache.h"
 #include "resource.h"
 
 // Estrutura para armazenar um cálculo no histórico
@@ -86,6 +90,7 @@ struct CalculationHistory {
 #define ID_FILE_OPEN 1016
 #define ID_HELP_SHORTCUTS 1017
 #define ID_HELP_ABOUT 1018
+#define ID_FILE_IMPORT 1019
 #define ID_MATRIX_START 2000
 
 // Cores da paleta elegante
@@ -112,6 +117,11 @@ private:
     std::vector<HWND> constantInputs;
     LinearSolver solver;
     
+    // Valores já convertidos das caixas: cada EN_CHANGE converte só a célula
+    // editada, e a thread de cálculo copia só as células que mudaram
+    InputModel inputModel;
+    InputModel::Snapshot inputSnapshot;
+    
     // Histórico de cálculos
     std::vector<CalculationHistory> calculationHistory;
     static constexpr int MAX_HISTORY_ITEMS = 50;
@@ -123,6 +133,19 @@ private:
     LinearSolver::Solution lastSolution;
     bool hasLastCalculation = false;
     
+    // Memória reaproveitada entre as edições (só usada pela thread de cálculo):
+    // com até 10 variáveis o Solve pelo caminho de tamanho fixo não aloca, e a
+    // chave da cache e a solução mantêm a capacidade de uma edição para outra
+    SolverWorkspace workspace;
+    DenseMatrix cacheKey;
+    LinearSolver::Solution currentSolution;
+    
+    // Sistemas já resolvidos (restaurar do histórico, desfazer uma edição)
+    SolutionCache solutionCache;
+    
+    // Casas decimais até as quais um valor digitado é tratado como fração exata
+    static constexpr int MAX_EXACT_DECIMALS = 6;
+    
     // Debounce para cálculos
     std::mutex calculationMutex;
     std::thread calculationThread;
@@ -221,6 +244,7 @@ public:
         
         AppendMenu(hFileMenu, MF_STRING, ID_FILE_OPEN, TEXT("&Abrir...\tCtrl+O"));
         AppendMenu(hFileMenu, MF_STRING, ID_FILE_SAVE, TEXT("&Salvar Como...\tCtrl+S"));
+        AppendMenu(hFileMenu, MF_STRING, ID_FILE_IMPORT, TEXT("&Importar Matriz (CSV/MTX)...\tCtrl+I"));
         AppendMenu(hFileMenu, MF_SEPARATOR, 0, nullptr);
         AppendMenu(hFileMenu, MF_STRING, IDCANCEL, TEXT("&Sair\tAlt+F4"));
         
@@ -447,6 +471,7 @@ public:
             
             SendMessage(constantInputs[i], WM_SETFONT, (WPARAM)hFontMain, TRUE);
         }
+        inputModel.Resize(currentSize);
         
         // Aplicar fontes aos controles principais
         SendMessage(hwndMatrixSize, WM_SETFONT, (WPARAM)hFontMain, TRUE);
@@ -519,21 +544,17 @@ public:
                 // Dados da matriz atual
                 file.write(reinterpret_cast<const char*>(&currentSize), sizeof(currentSize));
                 
-                // Matriz de coeficientes
+                // Matriz de coeficientes (valores já convertidos do modelo de entrada)
                 for (int i = 0; i < currentSize; i++) {
                     for (int j = 0; j < currentSize; j++) {
-                        TCHAR buffer[32];
-                        GetWindowText(matrixInputs[i][j], buffer, 32);
-                        double value = _tcstod(buffer, nullptr);
+                        double value = inputModel.Value(i, j);
                         file.write(reinterpret_cast<const char*>(&value), sizeof(value));
                     }
                 }
                 
                 // Constantes
                 for (int i = 0; i < currentSize; i++) {
-                    TCHAR buffer[32];
-                    GetWindowText(constantInputs[i], buffer, 32);
-                    double value = _tcstod(buffer, nullptr);
+                    double value = inputModel.Value(i, InputModel::CONSTANT);
                     file.write(reinterpret_cast<const char*>(&value), sizeof(value));
                 }
                 
@@ -767,6 +788,65 @@ public:
         }
     }
     
+    // Importar [A] (n colunas) ou [A | b] (n + 1 colunas) de CSV/TSV ou Matrix Market
+    void ImportMatrix() {
+        TCHAR fileName[MAX_PATH] = TEXT("");
+        
+        OPENFILENAME ofn = {};
+        ofn.lStructSize = sizeof(ofn);
+        ofn.hwndOwner = hwndMain;
+        ofn.lpstrFile = fileName;
+        ofn.nMaxFile = MAX_PATH;
+        ofn.lpstrFilter = TEXT("Matrizes (*.csv;*.tsv;*.txt;*.mtx)\0*.csv;*.tsv;*.txt;*.mtx\0Todos os Arquivos (*.*)\0*.*\0");
+        ofn.nFilterIndex = 1;
+        ofn.Flags = OFN_PATHMUSTEXIST | OFN_FILEMUSTEXIST;
+        ofn.lpstrTitle = TEXT("Importar Matriz...");
+        
+        if (!GetOpenFileName(&ofn)) {
+            return;
+        }
+        
+        MatrixReader::Result read = MatrixReader::Read(std::filesystem::path(fileName), solver.GetThreadPool().get());
+        if (read.status != MatrixReader::Status::SUCCESS) {
+            std::basic_ostringstream<TCHAR> ss;
+            if (read.line > 0) {
+                ss << TEXT("Linha ") << read.line << TEXT(", coluna ") << read.column << TEXT(":\n");
+            }
+            ss << FromUtf8(read.message);
+            MessageBox(hwndMain, ss.str().c_str(), TEXT("Erro ao importar"), MB_OK | MB_ICONERROR);
+            return;
+        }
+        
+        const DenseMatrix matrix = read.isSparse ? read.sparse.ToDense() : read.dense;
+        const int n = matrix.Rows();
+        if (n < 1 || n > 10 || (matrix.Cols() != n && matrix.Cols() != n + 1)) {
+            MessageBox(hwndMain, TEXT("A matriz deve ter de 1 a 10 linhas e n colunas ([A]) ou n + 1 colunas ([A | b])."),
+                       TEXT("Erro ao importar"), MB_OK | MB_ICONERROR);
+            return;
+        }
+        
+        currentSize = n;
+        TCHAR sizeStr[10];
+        _stprintf_s(sizeStr, TEXT("%d"), currentSize);
+        SetWindowText(hwndMatrixSize, sizeStr);
+        UpdateMatrixInputs();
+        
+        // Precisão completa: os valores vêm de outro programa, não da digitação
+        TCHAR valueStr[32];
+        for (int i = 0; i < n; i++) {
+            for (int j = 0; j < n; j++) {
+                _stprintf_s(valueStr, TEXT("%.17g"), matrix(i, j));
+                SetWindowText(matrixInputs[i][j], valueStr);
+            }
+            if (matrix.Cols() == n + 1) {
+                _stprintf_s(valueStr, TEXT("%.17g"), matrix(i, n));
+                SetWindowText(constantInputs[i], valueStr);
+            }
+        }
+        
+        TriggerCalculation();
+    }
+    
     void ClearAllVariables() {
         // Limpar todos os campos da matriz
         for (auto& row : matrixInputs) {
@@ -1329,6 +1409,7 @@ public:
                           TEXT("ARQUIVOS:\n")
                           TEXT("Ctrl+O\t\tAbrir arquivo .calc\n")
                           TEXT("Ctrl+S\t\tSalvar como arquivo .calc\n")
+                          TEXT("Ctrl+I\t\tImportar matriz CSV/TSV ou .mtx\n")
                           TEXT("Alt+F4\t\tSair do programa\n\n")
                           TEXT("NAVEGACAO:\n")
                           TEXT("Tab\t\tNavegar entre campos\n")
@@ -1557,62 +1638,113 @@ public:
         }
     }
     
-    void PerformCalculation() {
-        try {
-            // Coletar dados da matriz
-            std::vector<std::vector<double>> matrix(currentSize, std::vector<double>(currentSize));
-            std::vector<double> constants(currentSize);
-            
-            bool hasEmptyFields = false;
-            
-            for (int i = 0; i < currentSize; i++) {
-                for (int j = 0; j < currentSize; j++) {
-                    TCHAR buffer[32];
-                    GetWindowText(matrixInputs[i][j], buffer, 32);
-                    
-                    if (_tcslen(buffer) == 0) {
-                        hasEmptyFields = true;
-                        matrix[i][j] = 0.0;
-                    } else {
-                        // Validar se é um número válido
-                        TCHAR* endPtr;
-                        double value = _tcstod(buffer, &endPtr);
-                        if (*endPtr == '\0') {
-                            matrix[i][j] = value;
-                        } else {
-                            // Valor inválido, tratar como campo vazio
-                            matrix[i][j] = 0.0;
-                            hasEmptyFields = true;
-                        }
-                    }
-                }
-                
-                TCHAR buffer[32];
-                GetWindowText(constantInputs[i], buffer, 32);
-                
-                if (_tcslen(buffer) == 0) {
-                    hasEmptyFields = true;
-                    constants[i] = 0.0;
-                } else {
-                    // Validar se é um número válido
-                    TCHAR* endPtr;
-                    double value = _tcstod(buffer, &endPtr);
-                    if (*endPtr == '\0') {
-                        constants[i] = value;
-                    } else {
-                        // Valor inválido, tratar como campo vazio
-                        constants[i] = 0.0;
-                        hasEmptyFields = true;
-                    }
+    // Números exatos vêm em ASCII (dígitos, '-' e '/'): conversão direta para TCHAR
+    static std::basic_string<TCHAR> ToText(const std::string& text) {
+        return std::basic_string<TCHAR>(text.begin(), text.end());
+    }
+    
+    // Mensagens dos leitores de arquivo vêm em UTF-8
+    static std::basic_string<TCHAR> FromUtf8(const std::string& text) {
+        const int length = MultiByteToWideChar(CP_UTF8, 0, text.data(), static_cast<int>(text.size()), nullptr, 0);
+        std::basic_string<TCHAR> result(length, TEXT('\0'));
+        MultiByteToWideChar(CP_UTF8, 0, text.data(), static_cast<int>(text.size()), &result[0], length);
+        return result;
+    }
+    
+    // Valor digitado com até MAX_EXACT_DECIMALS casas como fração decimal exata
+    // (0.1 vira 1/10, não o double mais próximo de 0.1)
+    static bool ToDecimalFraction(double value, ExactSolver::Rational& fraction) {
+        double scale = 1.0;
+        for (int places = 0; places <= MAX_EXACT_DECIMALS; places++, scale *= 10.0) {
+            const double scaled = std::round(value * scale);
+            if (std::abs(scaled) <= ExactSolver::MAX_EXACT_INTEGER && scaled / scale == value) {
+                fraction.numerator = static_cast<long long>(scaled);
+                fraction.denominator = static_cast<long long>(scale);
+                return true;
+            }
+        }
+        return false;
+    }
+    
+    // Solução exata do sistema como foi digitado (inteiros e decimais curtos);
+    // Solution com exact == false se algum valor não tiver forma decimal curta
+    LinearSolver::Solution SolveExactDecimal(const std::vector<std::vector<double>>& matrix,
+                                             const std::vector<double>& constants) const {
+        const size_t n = matrix.size();
+        std::vector<std::vector<ExactSolver::Rational>> coefficients(n, std::vector<ExactSolver::Rational>(n));
+        std::vector<ExactSolver::Rational> rhs(n);
+        for (size_t i = 0; i < n; i++) {
+            for (size_t j = 0; j < n; j++) {
+                if (!ToDecimalFraction(matrix[i][j], coefficients[i][j])) {
+                    return LinearSolver::Solution();
                 }
             }
+            if (!ToDecimalFraction(constants[i], rhs[i])) {
+                return LinearSolver::Solution();
+            }
+        }
+        return solver.SolveExact(coefficients, rhs);
+    }
+    
+    // Converter só a célula editada (EN_CHANGE) para o modelo de entrada;
+    // true se o valor ou o estado dela mudou
+    bool UpdateInputCell(int id, HWND cell) {
+        const int n = inputModel.Size();
+        const int offset = id - ID_MATRIX_START;
+        if (n == 0 || (offset >= n * n && offset < 1000)) {
+            return false;
+        }
+        const int row = offset >= 1000 ? offset - 1000 : offset / n;
+        const int column = offset >= 1000 ? InputModel::CONSTANT : offset % n;
+        TCHAR buffer[32];
+        GetWindowText(cell, buffer, 32);
+        return inputModel.SetText(row, column, buffer);
+    }
+    
+    void PerformCalculation() {
+        try {
+            // Cópia do modelo de entrada: só as células editadas desde a
+            // última cópia são copiadas, sem ler as caixas de texto
+            inputModel.TakeSnapshot(inputSnapshot);
+            const std::vector<std::vector<double>>& matrix = inputSnapshot.matrix;
+            const std::vector<double>& constants = inputSnapshot.constants;
+            const bool hasEmptyFields = !inputSnapshot.Complete();
             
             std::basic_string<TCHAR> result;
             
             if (hasEmptyFields) {
                 result = TEXT("Digite os coeficientes da matriz e as constantes...");
             } else {
-                auto solution = solver.Solve(matrix, constants);
+                LinearSolver::Solution& solution = currentSolution;
+                const int n = static_cast<int>(matrix.size());
+                cacheKey.Resize(n, n);
+                for (int i = 0; i < n; i++) {
+                    std::copy(matrix[i].begin(), matrix[i].end(), cacheKey.Row(i));
+                }
+                
+                if (!solutionCache.Find(solver, cacheKey, constants, solution)) {
+                    solver.Solve(matrix, constants, solution, workspace);
+                    // Coeficientes inteiros ou decimais curtos: frações e determinante
+                    // exatos, calculados mesmo quando o ponto flutuante rejeita o
+                    // sistema. Para a entrada exata vale o veredito exato (um erro ou
+                    // uma classificação errada do ponto flutuante não vai para a
+                    // cache), e as frações vão junto, então um acerto não refaz a
+                    // eliminação exata
+                    LinearSolver::Solution exact = SolveExactDecimal(matrix, constants);
+                    if (exact.exact && exact.status != solution.status) {
+                        if (exact.hasSolution) {
+                            exact.conditionEstimate = solution.conditionEstimate;
+                            exact.illConditioned = solution.illConditioned;
+                        }
+                        solution = std::move(exact);
+                    } else if (exact.exact && exact.hasSolution && !solution.exact) {
+                        solution.exact = true;
+                        solution.exactValues = std::move(exact.exactValues);
+                        solution.exactDeterminant = std::move(exact.exactDeterminant);
+                    }
+                    solutionCache.Store(solver, cacheKey, constants, solution);
+                }
+                const bool showExact = solution.exact && solution.hasSolution;
                 
                 // Armazenar último cálculo (não adicionar automaticamente ao histórico)
                 lastMatrix = matrix;
@@ -1624,7 +1756,15 @@ public:
                     result = TEXT("Solução encontrada:\r\n\r\n");
                     for (size_t i = 0; i < solution.values.size(); i++) {
                         std::basic_stringstream<TCHAR> ss;
-                        ss << TEXT("x") << (i + 1) << TEXT(" = ") << std::fixed << std::setprecision(6) << solution.values[i] << TEXT("\r\n");
+                        ss << TEXT("x") << (i + 1) << TEXT(" = ");
+                        if (showExact && solution.exactValues[i].denominator != BigInt(1)) {
+                            ss << ToText(solution.exactValues[i].ToString()) << TEXT("  (≈ ")
+                               << std::fixed << std::setprecision(6) << solution.values[i] << TEXT(")\r\n");
+                        } else if (showExact) {
+                            ss << ToText(solution.exactValues[i].ToString()) << TEXT("\r\n");
+                        } else {
+                            ss << std::fixed << std::setprecision(6) << solution.values[i] << TEXT("\r\n");
+                        }
                         result += ss.str();
                     }
                 } else {
@@ -1637,9 +1777,57 @@ public:
                             break;
                         default:
                             result = TEXT("Erro no cálculo.");
+                            if (solution.illConditioned) {
+                                result += TEXT("\r\nA matriz é mal condicionada: o resultado não passou na ")
+                                          TEXT("verificação nem com refinamento iterativo.");
+                            }
                             break;
                     }
                 }
+                
+                // Diagnósticos da mesma fatoração que resolveu o sistema (sem recálculo)
+                if (solution.rank >= 0) {
+                    std::basic_stringstream<TCHAR> ss;
+                    ss << TEXT("\r\n\r\nPosto: ") << solution.rank << TEXT(" de ") << matrix.size() << TEXT("\r\n");
+                    if (solution.determinantSign == 0) {
+                        ss << TEXT("Determinante: 0 (matriz singular)\r\n");
+                    } else if (showExact) {
+                        ss << TEXT("Determinante: ") << ToText(solution.exactDeterminant.ToString()) << TEXT(" (exato)\r\n");
+                    } else {
+                        ss << TEXT("Determinante: ") << std::setprecision(10) << std::defaultfloat
+                           << solution.determinant << TEXT("\r\n")
+                           << TEXT("Sinal: ") << (solution.determinantSign > 0 ? TEXT("+") : TEXT("-"))
+                           << TEXT(", ln|det| = ") << std::setprecision(6) << std::fixed
+                           << solution.logAbsDeterminant << TEXT("\r\n");
+                    }
+                    
+                    std::basic_string<TCHAR> swaps;
+                    for (size_t k = 0; k < solution.pivots.size(); k++) {
+                        if (solution.pivots[k] != static_cast<int>(k)) {
+                            std::basic_stringstream<TCHAR> swap;
+                            swap << (swaps.empty() ? TEXT("") : TEXT(", ")) << TEXT("L") << (k + 1)
+                                 << TEXT("↔L") << (solution.pivots[k] + 1);
+                            swaps += swap.str();
+                        }
+                    }
+                    // Depois de correções de posto 1 as trocas não são conhecidas
+                    if (!solution.pivots.empty()) {
+                        ss << TEXT("Trocas de linha: ") << (swaps.empty() ? std::basic_string<TCHAR>(TEXT("nenhuma")) : swaps);
+                    }
+                    result += ss.str();
+                }
+                
+                // Número de condição estimado com os mesmos fatores
+                if (!std::isnan(solution.conditionEstimate)) {
+                    std::basic_stringstream<TCHAR> ss;
+                    ss << (solution.rank < 0 ? TEXT("\r\n\r\n") : (solution.pivots.empty() ? TEXT("") : TEXT("\r\n")))
+                       << TEXT("Número de condição (κ₁): ") << std::setprecision(3) << std::scientific
+                       << solution.conditionEstimate;
+                    if (solution.illConditioned && solution.hasSolution && !showExact) {
+                        ss << TEXT("\r\n⚠ Matriz mal condicionada: a solução pode ter poucos dígitos corretos");
+                    }
+                    result += ss.str();
+                }
             }
             
             // Atualizar UI na thread principal
@@ -1718,6 +1906,9 @@ public:
                     } else if (wParam == 'S') {
                         SaveToFile();
                         return 0;
+                    } else if (wParam == 'I') {
+                        ImportMatrix();
+                        return 0;
                     }
                 }
                 
@@ -1771,6 +1962,9 @@ public:
                         case ID_FILE_OPEN:
                             LoadFromFile();
                             return 0;
+                        case ID_FILE_IMPORT:
+                            ImportMatrix();
+                            return 0;
                         case IDCANCEL:
                             PostMessage(hwnd, WM_CLOSE, 0, 0);
                             return 0;
@@ -1803,7 +1997,8 @@ public:
                             currentSize = 1;
                             PostMessage(hwndMain, WM_USER + 2, 0, 0);
                         }
-                    } else if (LOWORD(wParam) >= ID_MATRIX_START) {
+                    } else if (LOWORD(wParam) >= ID_MATRIX_START &&
+                               UpdateInputCell(LOWORD(wParam), reinterpret_cast<HWND>(lParam))) {
                         TriggerCalculation();
                     }
                 }
@@ -2,6 +2,11 @@
 #include <vector>
 #include <iomanip>
 #include "LinearSolver.h"
+#include "BatchSolver.h"
+#include "TridiagonalBatch.h"
+#include "SolutionCache.h"
+#include "MatrixReader.h"
+#include "InputModel.h"
 
 void testCase(const std::string& name, 
               const std::vector<std::vector<double>>& matrix,
@@ -48,9 +53,1437 @@ void testCase(const std::string& name,
     }
 }
 
+// Comparar a LU em blocos com a eliminação clássica em um sistema maior
+void testBlockedLU(int n) {
+    std::cout << "\n=== LU em blocos " << n << "x" << n << " ===" << std::endl;
+    
+    // Matriz diagonalmente dominante determinística
+    DenseMatrix matrix(n, n);
+    std::vector<double> constants(n);
+    for (int i = 0; i < n; i++) {
+        for (int j = 0; j < n; j++) {
+            matrix(i, j) = (i == j) ? n : std::sin(0.37 * i + 0.91 * j);
+        }
+        constants[i] = std::cos(0.13 * i);
+    }
+    
+    LinearSolver classic;
+    classic.SetAlgorithm(LinearSolver::Algorithm::CLASSIC);
+    LinearSolver blocked;
+    blocked.SetAlgorithm(LinearSolver::Algorithm::BLOCKED);
+    blocked.SetBlockSize(32);
+    
+    auto expected = classic.Solve(matrix, constants);
+    auto actual = blocked.Solve(matrix, constants);
+    
+    double maxDiff = 0.0;
+    for (int i = 0; i < n && actual.hasSolution && expected.hasSolution; i++) {
+        maxDiff = std::max(maxDiff, std::abs(actual.values[i] - expected.values[i]));
+    }
+    
+    std::cout << "Status: " << (actual.hasSolution ? "Solução única" : "Falha") << std::endl;
+    std::cout << "Diferença máxima para a eliminação clássica: " << maxDiff << std::endl;
+}
+
+// Fatorar uma vez e resolver para vários vetores de constantes
+void testFactorization() {
+    std::cout << "\n=== Fatoração reutilizável ===" << std::endl;
+    
+    LinearSolver solver;
+    auto factorization = solver.Factorize({{1, 2, 3}, {2, -1, 1}, {3, 0, -1}});
+    std::cout << "Determinante: " << factorization.Determinant() << std::endl;
+    
+    std::vector<std::vector<double>> constantSets = {{9, 8, 3}, {6, 2, 2}, {0, 0, 0}};
+    for (const auto& constants : constantSets) {
+        auto solution = solver.Solve(factorization, constants);
+        std::cout << "b = (" << constants[0] << ", " << constants[1] << ", " << constants[2] << ") -> ";
+        if (solution.hasSolution) {
+            std::cout << "x = (" << solution.values[0] << ", " << solution.values[1] 
+                      << ", " << solution.values[2] << ")" << std::endl;
+        } else {
+            std::cout << "sem solução única" << std::endl;
+        }
+    }
+    
+    // Matriz singular: a classificação continua sendo feita pela eliminação
+    auto singular = solver.Factorize({{1, 2}, {2, 4}});
+    auto solution = solver.Solve(singular, {3, 6});
+    std::cout << "Singular: " << (solution.status == LinearSolver::SolutionStatus::INFINITE_SOLUTIONS 
+                                  ? "Infinitas soluções" : "Inesperado") << std::endl;
+}
+
+// Resolver o mesmo sistema para vários vetores de constantes (A·X = B)
+void testSolveMany() {
+    std::cout << "\n=== Várias constantes (A·X = B) ===" << std::endl;
+    
+    LinearSolver solver;
+    auto result = solver.SolveMany({{1, 2, 3}, {2, -1, 1}, {3, 0, -1}},
+                                   {{9, 6, 1}, {8, 2, 2}, {3, 2, 3}});
+    
+    if (!result.hasSolution) {
+        std::cout << "Falha" << std::endl;
+        return;
+    }
+    
+    for (int c = 0; c < result.values.Cols(); c++) {
+        std::cout << "Coluna " << (c + 1) << ": x = (" << result.values(0, c) << ", "
+                  << result.values(1, c) << ", " << result.values(2, c) << ")" << std::endl;
+    }
+    
+    // Linha curta não é completada com zeros
+    auto ragged = solver.SolveMany({{1, 2}, {3}}, {{1}, {2}});
+    std::cout << "Linhas de tamanhos diferentes: " << (ragged.hasSolution ? "resolvido" : "rejeitado") << std::endl;
+    
+    // det = -1, mas a LU em double não passa na verificação: as colunas
+    // reprovadas são refeitas pelo caminho denso (aritmética exata)
+    auto hard = solver.SolveMany({{100000001, 100000000}, {100000000, 99999999}}, {{1, 0}, {2, 1}});
+    std::cout << "Quase singular: " << (hard.hasSolution ? "resolvido" : "falha");
+    if (hard.hasSolution) {
+        std::cout << ", X = [" << hard.values(0, 0) << " " << hard.values(0, 1) << "; "
+                  << hard.values(1, 0) << " " << hard.values(1, 1) << "]";
+    }
+    std::cout << std::endl;
+    
+    // Pivô abaixo de EPSILON com det = -1: cada coluna é classificada pelo
+    // próprio Solve, e todas únicas dão solução única
+    const double big = std::ldexp(1.0, 50);
+    auto pivot = solver.SolveMany({{big, big - 1}, {big - 1, big - 2}}, {{1, 0}, {0, 1}});
+    std::cout << "Pivô pequeno com det = -1: " << (pivot.hasSolution ? "resolvido" : "falha");
+    if (pivot.hasSolution) {
+        std::cout << ", X = [" << std::setprecision(0) << pivot.values(0, 0) << " " << pivot.values(0, 1) << "; "
+                  << pivot.values(1, 0) << " " << pivot.values(1, 1) << "]" << std::setprecision(6);
+    }
+    std::cout << std::endl;
+    
+    // Mal condicionada (κ₁ ≈ 4e20) mas aprovada na verificação: o κ₁ da LU
+    // compartilhada manda as colunas inteiras para a eliminação exata
+    auto conditioned = solver.SolveMany({{1e10, 1e10 + 1}, {1e10 - 1, 1e10}}, {{1}, {1}});
+    std::cout << "Mal condicionada: " << (conditioned.hasSolution ? "resolvido" : "falha");
+    if (conditioned.hasSolution) {
+        std::cout << ", x = (" << conditioned.values(0, 0) << ", " << conditioned.values(1, 0) << ")";
+    }
+    std::cout << std::endl;
+}
+
+// Lote de sistemas pequenos resolvidos juntos (inclui um singular)
+void testBatch() {
+    std::cout << "\n=== Lote de sistemas 2x2 ===" << std::endl;
+    
+    const int count = 11;
+    SystemBatch batch(2, count);
+    for (int s = 0; s < count; s++) {
+        // {{2, 3}, {1, -1}} com constantes escolhidas para x = (s, 1)
+        batch.Coefficient(s, 0, 0) = 2; batch.Coefficient(s, 0, 1) = 3;
+        batch.Coefficient(s, 1, 0) = 1; batch.Coefficient(s, 1, 1) = -1;
+        batch.Constant(s, 0) = 2.0 * s + 3;
+        batch.Constant(s, 1) = s - 1.0;
+    }
+    // Sistema 5 com infinitas soluções
+    batch.Coefficient(5, 1, 0) = 4; batch.Coefficient(5, 1, 1) = 6;
+    batch.Constant(5, 1) = 2 * batch.Constant(5, 0);
+    
+    BatchLinearSolver solver;
+    auto result = solver.Solve(batch);
+    
+    for (int s = 0; s < count; s++) {
+        std::cout << "Sistema " << s << ": ";
+        if (result.status[s] == LinearSolver::SolutionStatus::UNIQUE_SOLUTION) {
+            std::cout << "x = (" << result.Value(s, 0) << ", " << result.Value(s, 1) << ")" << std::endl;
+        } else if (result.status[s] == LinearSolver::SolutionStatus::INFINITE_SOLUTIONS) {
+            std::cout << "Infinitas soluções" << std::endl;
+        } else {
+            std::cout << "Outro status" << std::endl;
+        }
+    }
+}
+
+// Resolver sistemas de 1 a 10 variáveis pelo caminho de tamanho fixo
+void testFixedSizes() {
+    std::cout << "\n=== Tamanhos fixos (1 a 10) ===" << std::endl;
+    
+    LinearSolver solver;
+    for (int n = 1; n <= 10; n++) {
+        std::vector<std::vector<double>> matrix(n, std::vector<double>(n));
+        std::vector<double> constants(n);
+        for (int i = 0; i < n; i++) {
+            for (int j = 0; j < n; j++) {
+                matrix[i][j] = 1.0 / (1.0 + std::abs(i - j)) + (i == j ? 1.0 : 0.0);
+            }
+            constants[i] = i + 1.0;
+        }
+        
+        auto fixed = solver.Solve(matrix, constants);
+        
+        double maxResidual = 0.0;
+        for (int i = 0; i < n && fixed.hasSolution; i++) {
+            double sum = 0.0;
+            for (int j = 0; j < n; j++) {
+                sum += matrix[i][j] * fixed.values[j];
+            }
+            maxResidual = std::max(maxResidual, std::abs(sum - constants[i]));
+        }
+        
+        std::cout << "n = " << n << ": " << (fixed.hasSolution ? "Solução única" : "Falha")
+                  << ", resíduo máximo " << std::scientific << maxResidual << std::fixed << std::endl;
+    }
+}
+
+// Laplaciano de 5 pontos numa malha 2D; convection != 0 torna a matriz não simétrica
+SparseMatrix BuildGridMatrix(int gridSize, double convection) {
+    const int n = gridSize * gridSize;
+    std::vector<Triplet> triplets;
+    for (int r = 0; r < gridSize; r++) {
+        for (int c = 0; c < gridSize; c++) {
+            int i = r * gridSize + c;
+            triplets.push_back({i, i, 4.0});
+            if (c > 0) triplets.push_back({i, i - 1, -1.0 - convection});
+            if (c + 1 < gridSize) triplets.push_back({i, i + 1, -1.0 + convection});
+            if (r > 0) triplets.push_back({i, i - gridSize, -1.0});
+            if (r + 1 < gridSize) triplets.push_back({i, i + gridSize, -1.0});
+        }
+    }
+    return SparseMatrix::FromTriplets(n, n, triplets);
+}
+
+// Solução conhecida x_i = sin(0.1·i) e constantes b = A·x
+void BuildExpected(const SparseMatrix& matrix, std::vector<double>& expected, std::vector<double>& constants) {
+    const int n = matrix.Rows();
+    expected.resize(n);
+    constants.resize(n);
+    for (int i = 0; i < n; i++) {
+        expected[i] = std::sin(0.1 * i);
+    }
+    matrix.Multiply(expected.data(), constants.data());
+}
+
+// Sistemas esparsos de uma malha 2D: simétrico (Cholesky) e não simétrico (LU),
+// com cada ordenação, mais um sistema singular
+void testSparse(int gridSize) {
+    std::cout << "\n=== Sistemas esparsos (malha " << gridSize << "x" << gridSize << ") ===" << std::endl;
+    
+    const int n = gridSize * gridSize;
+    const char* names[] = {"natural", "RCM", "grau mínimo"};
+    const SparseOrdering::Method methods[] = {
+        SparseOrdering::Method::NATURAL, SparseOrdering::Method::RCM, SparseOrdering::Method::MINIMUM_DEGREE
+    };
+    
+    for (double convection : {0.0, 0.3}) {
+        SparseMatrix matrix = BuildGridMatrix(gridSize, convection);
+        std::vector<double> expected, constants;
+        BuildExpected(matrix, expected, constants);
+        
+        for (int m = 0; m < 3; m++) {
+            LinearSolver solver;
+            solver.SetSparseOrdering(methods[m]);
+            auto result = solver.Solve(matrix, constants);
+            
+            double maxError = 0.0;
+            for (int i = 0; i < n && result.hasSolution; i++) {
+                maxError = std::max(maxError, std::abs(result.values[i] - expected[i]));
+            }
+            std::cout << (convection == 0.0 ? "Simétrico" : "Não simétrico") << ", " << names[m] << ": "
+                      << (result.hasSolution ? "Solução única" : "Falha")
+                      << ", erro máximo " << std::scientific << maxError << std::fixed << std::endl;
+        }
+    }
+    
+    // Linhas 0 e 1 iguais: infinitas soluções (classificado pela eliminação densa)
+    SparseMatrix singular = SparseMatrix::FromTriplets(3, 3, {
+        {0, 0, 1}, {0, 2, 2}, {1, 0, 1}, {1, 2, 2}, {2, 1, 3}
+    });
+    auto result = LinearSolver().Solve(singular, {3, 3, 6});
+    std::cout << "Singular: "
+              << (result.status == LinearSolver::SolutionStatus::INFINITE_SOLUTIONS ? "Infinitas soluções" : "Outro status")
+              << std::endl;
+    
+    // Diagonal toda nula: a linha 2 fica fora do padrão da coluna 2 e não
+    // pode ser escolhida como pivô por um valor de uma coluna anterior
+    SparseMatrix zeroDiagonal = SparseMatrix::FromTriplets(4, 4, {
+        {0, 1, -1}, {1, 2, 1}, {1, 3, -1}, {2, 3, -1}, {3, 0, -2}, {3, 1, 1}, {3, 2, -1}
+    });
+    result = LinearSolver().Solve(zeroDiagonal, {1, 1, -1, -1});
+    std::cout << "Diagonal nula: " << (result.hasSolution ? "Solução única" : "Falha");
+    if (result.hasSolution) {
+        std::cout << ", x = (" << result.values[0] << ", " << result.values[1] << ", "
+                  << result.values[2] << ", " << result.values[3] << ")";
+    }
+    std::cout << std::endl;
+}
+
+// Gradiente conjugado com cada precondicionador no Laplaciano 2D (SPD)
+void testConjugateGradient(int gridSize) {
+    std::cout << "\n=== Gradiente conjugado (malha " << gridSize << "x" << gridSize << ") ===" << std::endl;
+    
+    SparseMatrix matrix = BuildGridMatrix(gridSize, 0.0);
+    std::vector<double> expected, constants;
+    BuildExpected(matrix, expected, constants);
+    
+    const char* names[] = {"nenhum", "Jacobi", "block-Jacobi", "IC(0)"};
+    const Preconditioner::Type types[] = {
+        Preconditioner::Type::NONE, Preconditioner::Type::JACOBI,
+        Preconditioner::Type::BLOCK_JACOBI, Preconditioner::Type::INCOMPLETE_CHOLESKY
+    };
+    
+    for (int t = 0; t < 4; t++) {
+        LinearSolver solver;
+        LinearSolver::IterativeOptions options;
+        options.preconditioner = types[t];
+        solver.SetIterativeOptions(options);
+        auto result = solver.SolveConjugateGradient(matrix, constants);
+        
+        double maxError = 0.0;
+        for (int i = 0; i < matrix.Rows() && result.hasSolution; i++) {
+            maxError = std::max(maxError, std::abs(result.values[i] - expected[i]));
+        }
+        std::cout << names[t] << ": " << (result.hasSolution ? "convergiu" : "falhou")
+                  << " em " << result.iterations << " iterações, resíduo final "
+                  << std::scientific << result.residualHistory.back()
+                  << ", erro máximo " << maxError << std::fixed << std::endl;
+    }
+}
+
+// GMRES e BiCGSTAB com ILU(0)/ILUT no problema não simétrico, mais um caso
+// que não converge dentro do limite de iterações
+void testNonsymmetricIterative(int gridSize) {
+    std::cout << "\n=== GMRES / BiCGSTAB (malha " << gridSize << "x" << gridSize << ") ===" << std::endl;
+    
+    SparseMatrix matrix = BuildGridMatrix(gridSize, 0.3);
+    std::vector<double> expected, constants;
+    BuildExpected(matrix, expected, constants);
+    
+    const char* names[] = {"ILU(0)", "ILUT"};
+    const Preconditioner::Type types[] = {Preconditioner::Type::INCOMPLETE_LU, Preconditioner::Type::ILUT};
+    
+    for (int t = 0; t < 2; t++) {
+        LinearSolver solver;
+        LinearSolver::IterativeOptions options;
+        options.preconditioner = types[t];
+        options.restart = 20;
+        solver.SetIterativeOptions(options);
+        
+        auto gmres = solver.SolveGmres(matrix, constants);
+        auto bicgstab = solver.SolveBiCgStab(matrix, constants);
+        for (const auto* result : {&gmres, &bicgstab}) {
+            double maxError = 0.0;
+            for (int i = 0; i < matrix.Rows() && result->hasSolution; i++) {
+                maxError = std::max(maxError, std::abs(result->values[i] - expected[i]));
+            }
+            std::cout << (result == &gmres ? "GMRES(20) + " : "BiCGSTAB + ") << names[t] << ": "
+                      << (result->hasSolution ? "convergiu" : "falhou") << " em " << result->iterations
+                      << " iterações, erro máximo " << std::scientific << maxError << std::fixed << std::endl;
+        }
+    }
+    
+    LinearSolver limited;
+    LinearSolver::IterativeOptions options;
+    options.preconditioner = Preconditioner::Type::NONE;
+    options.maxIterations = 5;
+    limited.SetIterativeOptions(options);
+    auto result = limited.SolveGmres(matrix, constants);
+    std::cout << "Limite de 5 iterações: "
+              << (result.status == LinearSolver::SolutionStatus::CALCULATION_ERROR ? "Erro de cálculo" : "Outro status")
+              << " (" << result.diagnostics << ")" << std::endl;
+}
+
+void testSymmetric(int n) {
+    std::cout << "\n=== Sistemas simétricos " << n << "x" << n << " ===" << std::endl;
+    
+    // Positiva definida, indefinida e com diagonal nula (força blocos 2x2)
+    const char* names[] = {"positiva definida", "indefinida", "diagonal nula"};
+    for (int kind = 0; kind < 3; kind++) {
+        DenseMatrix matrix(n, n);
+        std::vector<double> expected(n), constants(n, 0.0);
+        for (int i = 0; i < n; i++) {
+            for (int j = 0; j <= i; j++) {
+                double value = std::sin(0.37 * i + 0.91 * j) + std::cos(0.53 * i * j);
+                if (i == j) {
+                    value = kind == 0 ? n : (kind == 1 ? std::sin(1.7 * i) : 0.0);
+                }
+                matrix(i, j) = matrix(j, i) = value;
+            }
+            expected[i] = std::sin(0.1 * i);
+        }
+        for (int i = 0; i < n; i++) {
+            for (int j = 0; j < n; j++) {
+                constants[i] += matrix(i, j) * expected[j];
+            }
+        }
+        
+        LinearSolver solver;
+        solver.SetBlockSize(32);
+        auto result = solver.Solve(matrix, constants);
+        
+        double maxError = 0.0;
+        for (int i = 0; i < n && result.hasSolution; i++) {
+            maxError = std::max(maxError, std::abs(result.values[i] - expected[i]));
+        }
+        std::cout << names[kind] << ": " << (result.hasSolution ? "Solução única" : "Falha")
+                  << ", erro máximo " << std::scientific << maxError << std::fixed << std::endl;
+    }
+}
+
+void testBand(int n) {
+    std::cout << "\n=== Sistemas em banda (n = " << n << ") ===" << std::endl;
+    LinearSolver solver;
+    std::vector<double> expected(n);
+    for (int i = 0; i < n; i++) {
+        expected[i] = std::sin(0.1 * i);
+    }
+    auto maxError = [&](const LinearSolver::Solution& result) {
+        double error = 0.0;
+        for (int i = 0; i < n && result.hasSolution; i++) {
+            error = std::max(error, std::abs(result.values[i] - expected[i]));
+        }
+        return error;
+    };
+    
+    // Tridiagonal diagonalmente dominante (Thomas)
+    std::vector<double> lower(n - 1), diagonal(n), upper(n - 1), constants(n);
+    for (int i = 0; i < n; i++) {
+        diagonal[i] = 4.0 + std::cos(0.3 * i);
+        if (i + 1 < n) {
+            lower[i] = -1.0 - 0.5 * std::sin(0.7 * i);
+            upper[i] = -1.0 + 0.5 * std::cos(0.2 * i);
+        }
+    }
+    for (int i = 0; i < n; i++) {
+        constants[i] = diagonal[i] * expected[i] + (i > 0 ? lower[i - 1] * expected[i - 1] : 0.0) +
+                       (i + 1 < n ? upper[i] * expected[i + 1] : 0.0);
+    }
+    auto result = solver.SolveTridiagonal(lower, diagonal, upper, constants);
+    std::cout << "Tridiagonal (Thomas): " << (result.hasSolution ? "Solução única" : "Falha")
+              << ", erro máximo " << std::scientific << maxError(result) << std::fixed << std::endl;
+    
+    // Banda 2/3 com diagonal nula (exige pivoteamento)
+    BandMatrix band(n, 2, 3);
+    for (int i = 0; i < n; i++) {
+        for (int j = std::max(0, i - 2); j <= std::min(n - 1, i + 3); j++) {
+            band(i, j) = i == j ? 0.0 : (std::abs(j - i) == 1 ? 4.0 : 0.3 * std::sin(0.37 * i + 0.91 * j));
+        }
+    }
+    band.Multiply(expected.data(), constants.data());
+    result = solver.Solve(band, constants);
+    std::cout << "Banda 2/3 com pivoteamento: " << (result.hasSolution ? "Solução única" : "Falha")
+              << ", erro máximo " << std::scientific << maxError(result) << std::fixed << std::endl;
+    
+    // Matriz densa com banda detectada automaticamente
+    result = solver.Solve(band.ToDense(), constants);
+    std::cout << "Densa com banda detectada: " << (result.hasSolution ? "Solução única" : "Falha")
+              << ", erro máximo " << std::scientific << maxError(result) << std::fixed << std::endl;
+    
+    // Banda singular: classificada pela eliminação densa
+    BandMatrix singular(n, 1, 1);
+    for (int i = 0; i + 1 < n; i++) {
+        singular(i, i) = 1.0;
+        singular(i + 1, i) = 1.0;
+    }
+    result = solver.Solve(singular, std::vector<double>(n, 0.0));
+    std::cout << "Banda singular homogênea: "
+              << (result.status == LinearSolver::SolutionStatus::INFINITE_SOLUTIONS ? "Infinitas soluções" : "Outro status")
+              << std::endl;
+    
+    // Banda inteira singular cujo pivô nulo sobra como arredondamento (κ₁ > 1/ε):
+    // linha n/2 = 3·(linha n/2 - 1) - 7·(linha n/2 - 2)
+    DenseMatrix rounded(n, n);
+    for (int i = 0; i < n; i++) {
+        for (int j = std::max(0, i - 2); j <= std::min(n - 1, i + 2); j++) {
+            rounded(i, j) = std::round(999.0 * std::sin(1.3 * i + 0.7 * j + 0.1 * i * j));
+        }
+    }
+    const int dependent = n / 2;
+    for (int j = 0; j < n; j++) {
+        rounded(dependent, j) = 3.0 * rounded(dependent - 1, j) - 7.0 * rounded(dependent - 2, j);
+    }
+    for (int i = 0; i < n; i++) {
+        constants[i] = 0.0;
+        for (int j = 0; j < n; j++) {
+            constants[i] += rounded(i, j);
+        }
+    }
+    auto dense = solver.Solve(rounded, constants);
+    auto sparse = solver.Solve(SparseMatrix::FromDense(rounded), constants);
+    auto status = [](const LinearSolver::Solution& solution) {
+        return solution.status == LinearSolver::SolutionStatus::INFINITE_SOLUTIONS ? "Infinitas soluções" :
+               solution.status == LinearSolver::SolutionStatus::UNIQUE_SOLUTION ? "Solução única" : "Outro status";
+    };
+    std::cout << "Banda inteira singular por arredondamento: densa " << status(dense)
+              << ", esparsa " << status(sparse) << std::endl;
+}
+
+void testTridiagonalBatch() {
+    std::cout << "\n=== Lote de sistemas tridiagonais ===" << std::endl;
+    
+    const int size = 50;
+    const int count = 70; // Um bloco completo e um parcial
+    TridiagonalBatch batch(size, count);
+    for (int s = 0; s < count; s++) {
+        for (int i = 0; i < size; i++) {
+            batch.Diagonal(s, i) = 2.0 + 0.01 * s;
+            if (i + 1 < size) {
+                batch.Lower(s, i) = -1.0;
+                batch.Upper(s, i) = -1.0;
+            }
+        }
+    }
+    // Sistema 3: primeiro pivô nulo (Thomas falha, a LU em banda resolve)
+    batch.Diagonal(3, 0) = 0.0;
+    // Sistema 65: linha nula, sem solução para constantes não nulas
+    batch.Diagonal(65, 10) = 0.0;
+    batch.Lower(65, 9) = 0.0;
+    batch.Upper(65, 10) = 0.0;
+    for (int s = 0; s < count; s++) {
+        for (int i = 0; i < size; i++) {
+            // Constantes escolhidas para x_i = s + i
+            double value = batch.Diagonal(s, i) * (s + i);
+            if (i > 0) value += batch.Lower(s, i - 1) * (s + i - 1);
+            if (i + 1 < size) value += batch.Upper(s, i) * (s + i + 1);
+            batch.Constant(s, i) = s == 65 && i == 10 ? 1.0 : value;
+        }
+    }
+    
+    BatchTridiagonalSolver solver;
+    solver.SetThreadCount(0);
+    auto result = solver.Solve(batch);
+    
+    double maxError = 0.0;
+    int solved = 0;
+    for (int s = 0; s < count; s++) {
+        if (result.status[s] != LinearSolver::SolutionStatus::UNIQUE_SOLUTION) continue;
+        solved++;
+        for (int i = 0; i < size; i++) {
+            maxError = std::max(maxError, std::abs(result.Value(s, i) - (s + i)));
+        }
+    }
+    std::cout << "Sistemas resolvidos: " << solved << " de " << count
+              << ", erro máximo " << std::scientific << maxError << std::fixed << std::endl;
+    std::cout << "Sistema 3 (pivô nulo): "
+              << (result.status[3] == LinearSolver::SolutionStatus::UNIQUE_SOLUTION ? "Solução única" : "Outro status")
+              << std::endl;
+    std::cout << "Sistema 65 (linha nula): "
+              << (result.status[65] == LinearSolver::SolutionStatus::NO_SOLUTION ? "Sem solução" : "Outro status")
+              << std::endl;
+}
+
+void testMixedPrecision(int n) {
+    std::cout << "\n=== Precisão mista " << n << "x" << n << " ===" << std::endl;
+    
+    DenseMatrix matrix(n, n);
+    std::vector<double> expected(n), constants(n, 0.0);
+    for (int i = 0; i < n; i++) {
+        for (int j = 0; j < n; j++) {
+            matrix(i, j) = (i == j) ? n : std::sin(0.37 * i + 0.91 * j);
+        }
+        expected[i] = std::sin(0.1 * i);
+    }
+    for (int i = 0; i < n; i++) {
+        for (int j = 0; j < n; j++) {
+            constants[i] += matrix(i, j) * expected[j];
+        }
+    }
+    
+    LinearSolver solver;
+    solver.SetAlgorithm(LinearSolver::Algorithm::MIXED_PRECISION);
+    auto result = solver.Solve(matrix, constants);
+    double maxError = 0.0;
+    for (int i = 0; i < n && result.hasSolution; i++) {
+        maxError = std::max(maxError, std::abs(result.values[i] - expected[i]));
+    }
+    std::cout << "Bem condicionada: " << (result.hasSolution ? "Solução única" : "Falha")
+              << " após " << result.iterations << " passos de refinamento, erro máximo "
+              << std::scientific << maxError << std::fixed << std::endl;
+    
+    // Hilbert 20x20 + 1e-8·I (condição ~1e8): o float não basta e a fatoração em double assume
+    const int size = 20;
+    DenseMatrix hilbert(size, size);
+    std::vector<double> hilbertConstants(size, 0.0);
+    for (int i = 0; i < size; i++) {
+        for (int j = 0; j < size; j++) {
+            hilbert(i, j) = 1.0 / (i + j + 1) + (i == j ? 1e-8 : 0.0);
+            hilbertConstants[i] += hilbert(i, j);
+        }
+    }
+    result = solver.Solve(hilbert, hilbertConstants);
+    std::cout << "Hilbert " << size << "x" << size << " deslocada: " << (result.hasSolution ? "Solução única" : "Falha")
+              << (result.hasSolution && result.iterations == 0 ? " (fatoração em double)" : "") << std::endl;
+}
+
+void testWorkspace() {
+    std::cout << "\n=== Workspace reutilizável ===" << std::endl;
+    
+    // Sequência que passa pelos caminhos geral, em blocos, simétrico, em banda,
+    // fixo, singular e de precisão mista, crescendo e encolhendo o workspace
+    struct Case { const char* name; int n; int kind; LinearSolver::Algorithm algorithm; };
+    const Case cases[] = {
+        {"Geral 300x300 (blocos)", 300, 0, LinearSolver::Algorithm::AUTOMATIC},
+        {"Simétrica 120x120", 120, 1, LinearSolver::Algorithm::AUTOMATIC},
+        {"Tridiagonal 200x200", 200, 2, LinearSolver::Algorithm::AUTOMATIC},
+        {"Pequeno 4x4", 4, 0, LinearSolver::Algorithm::AUTOMATIC},
+        {"Singular 30x30", 30, 3, LinearSolver::Algorithm::AUTOMATIC},
+        {"Geral 80x80 (clássica)", 80, 0, LinearSolver::Algorithm::CLASSIC},
+        {"Precisão mista 250x250", 250, 0, LinearSolver::Algorithm::MIXED_PRECISION},
+        {"Geral 300x300 de novo", 300, 0, LinearSolver::Algorithm::AUTOMATIC},
+    };
+    
+    SolverWorkspace workspace;
+    LinearSolver::Solution reused;
+    for (const Case& test : cases) {
+        const int n = test.n;
+        DenseMatrix matrix(n, n);
+        std::vector<double> constants(n);
+        for (int i = 0; i < n; i++) {
+            for (int j = 0; j < n; j++) {
+                double value = 0.0;
+                if (test.kind == 0) {
+                    value = (i == j) ? n : std::sin(0.37 * i + 0.91 * j);
+                } else if (test.kind == 1) {
+                    value = (i == j) ? n : std::cos(0.5 * (i + j));
+                } else if (test.kind == 2) {
+                    value = (i == j) ? 4.0 : (std::abs(i - j) == 1 ? -1.0 : 0.0);
+                } else {
+                    value = (j < n / 2) ? std::sin(1.0 + i * j) : 0.0;
+                }
+                matrix(i, j) = value;
+            }
+            constants[i] = test.kind == 3 ? 0.0 : std::cos(0.2 * i);
+        }
+        
+        LinearSolver solver;
+        solver.SetAlgorithm(test.algorithm);
+        auto expected = solver.Solve(matrix, constants);
+        solver.Solve(matrix, constants, reused, workspace);
+        
+        double maxDifference = 0.0;
+        bool same = expected.status == reused.status && expected.values.size() == reused.values.size();
+        for (std::size_t i = 0; same && i < expected.values.size(); i++) {
+            maxDifference = std::max(maxDifference, std::abs(expected.values[i] - reused.values[i]));
+        }
+        std::cout << test.name << ": " << (same && maxDifference == 0.0 ? "idêntico" : "DIFERENTE")
+                  << " ao Solve sem workspace" << std::endl;
+    }
+}
+
+void testDiagnostics() {
+    std::cout << "\n=== Posto e determinante da fatoração ===" << std::endl;
+    LinearSolver solver;
+    
+    auto print = [](const char* name, const LinearSolver::Solution& result) {
+        std::cout << name << ": posto " << result.rank << ", det " << std::scientific << std::setprecision(6)
+                  << result.determinant << ", sinal " << result.determinantSign
+                  << ", ln|det| " << result.logAbsDeterminant << std::fixed << std::endl;
+    };
+    
+    // Caminho fixo 3x3: det = -1
+    print("3x3 (fixo, det = -1)", solver.Solve(std::vector<std::vector<double>>{{2, 1, 1}, {1, 3, 2}, {1, 0, 0}},
+                                               std::vector<double>{1, 2, 3}));
+    
+    // O mesmo sistema geral pela eliminação clássica e pela LU em blocos
+    const int n = 300;
+    DenseMatrix general(n, n);
+    std::vector<double> constants(n);
+    for (int i = 0; i < n; i++) {
+        for (int j = 0; j < n; j++) {
+            general(i, j) = (i == j) ? 2.0 : std::sin(0.37 * i + 0.91 * j);
+        }
+        constants[i] = std::cos(0.2 * i);
+    }
+    LinearSolver classic;
+    classic.SetAlgorithm(LinearSolver::Algorithm::CLASSIC);
+    auto classicResult = classic.Solve(general, constants);
+    auto blockedResult = solver.Solve(general, constants);
+    print("Geral 300x300 (clássica)", classicResult);
+    print("Geral 300x300 (blocos)", blockedResult);
+    std::cout << "Diferença de ln|det|: " << std::scientific
+              << std::abs(classicResult.logAbsDeterminant - blockedResult.logAbsDeterminant) << std::fixed << std::endl;
+    
+    // Simétricas: Cholesky (SPD) e LDLᵀ (indefinida), comparadas com CalculateDeterminant
+    DenseMatrix symmetric(40, 40);
+    std::vector<double> symmetricConstants(40, 1.0);
+    for (int shift : {0, 1}) {
+        for (int i = 0; i < 40; i++) {
+            for (int j = 0; j < 40; j++) {
+                symmetric(i, j) = (i == j) ? (shift ? (i % 2 ? 3.0 : -3.0) : 40.0) : std::cos(0.5 * (i + j));
+            }
+        }
+        auto result = solver.Solve(symmetric, symmetricConstants);
+        print(shift ? "Simétrica indefinida (LDLᵀ)" : "Simétrica positiva (Cholesky)", result);
+        std::cout << "  CalculateDeterminant: " << std::scientific << solver.CalculateDeterminant(symmetric)
+                  << std::fixed << std::endl;
+    }
+    
+    // Tridiagonal (-1, 4, -1) com n = 2000: det ≈ (2 + √3)^(n+1) / (2√3) estoura o double
+    const int size = 2000;
+    auto tridiagonal = solver.SolveTridiagonal(std::vector<double>(size - 1, -1.0), std::vector<double>(size, 4.0),
+                                               std::vector<double>(size - 1, -1.0), std::vector<double>(size, 1.0));
+    print("Tridiagonal 2000 (Thomas)", tridiagonal);
+    std::cout << "  ln|det| esperado: " << std::setprecision(6)
+              << (size + 1) * std::log(2.0 + std::sqrt(3.0)) - std::log(2.0 * std::sqrt(3.0)) << std::endl;
+    
+    // Singular: metade das colunas nulas
+    DenseMatrix singular(30, 30);
+    for (int i = 0; i < 30; i++) {
+        for (int j = 0; j < 15; j++) {
+            singular(i, j) = std::sin(1.0 + i * j);
+        }
+    }
+    print("Singular 30x30", solver.Solve(singular, std::vector<double>(30, 0.0)));
+}
+
+// Editar um coeficiente ou uma linha reaproveita a fatoração (Sherman-Morrison)
+void testRankOneUpdates() {
+    std::cout << "\n=== Correções de posto 1 na fatoração ===" << std::endl;
+    
+    const int n = 200;
+    DenseMatrix matrix(n, n);
+    std::vector<double> constants(n);
+    for (int i = 0; i < n; i++) {
+        for (int j = 0; j < n; j++) {
+            matrix(i, j) = (i == j ? 4.0 : 0.0) + std::sin(0.37 * i + 0.91 * j);
+        }
+        constants[i] = std::cos(0.13 * i);
+    }
+    
+    LinearSolver solver;
+    auto factorization = solver.Factorize(matrix);
+    
+    // Edições de células e de linhas inteiras, como no que-acontece-se da interface
+    int incremental = 0;
+    std::vector<double> row(n);
+    for (int edit = 0; edit < 40; edit++) {
+        const int i = (edit * 37) % n;
+        if (edit % 5 == 4) {
+            for (int j = 0; j < n; j++) {
+                row[j] = matrix(i, j) + 0.5 * std::cos(edit + j);
+                matrix(i, j) = row[j];
+            }
+            incremental += factorization.UpdateRow(i, row.data());
+        } else {
+            const int j = (edit * 53 + 11) % n;
+            matrix(i, j) += 0.75 * std::sin(edit + 1.0);
+            incremental += factorization.UpdateEntry(i, j, matrix(i, j));
+        }
+    }
+    
+    auto updated = solver.Solve(factorization, constants);
+    auto fresh = solver.Solve(matrix, constants);
+    double maxDiff = 0.0;
+    for (int i = 0; i < n && updated.hasSolution && fresh.hasSolution; i++) {
+        maxDiff = std::max(maxDiff, std::abs(updated.values[i] - fresh.values[i]));
+    }
+    std::cout << "40 edições: " << incremental << " incrementais, " << factorization.RefactorCount()
+              << " refatorações" << std::endl;
+    std::cout << "Diferença máxima para resolver do zero: " << (maxDiff < 1e-10 ? "< 1e-10" : "grande") << std::endl;
+    std::cout << "Determinante relativo ao da LU nova: " << std::setprecision(10)
+              << updated.determinant / fresh.determinant << std::setprecision(3) << std::endl;
+    
+    // Edição que torna a matriz singular: σ ≈ 0, refatora e classifica o sistema
+    auto small = solver.Factorize({{1, 2}, {3, 4}});
+    const bool stable = small.UpdateEntry(0, 0, 1.5);
+    auto singular = solver.Solve(small, {3, 6});
+    std::cout << "Edição para singular: " << (stable ? "incremental" : "refatorada") << ", "
+              << (singular.status == LinearSolver::SolutionStatus::INFINITE_SOLUTIONS ? "Infinitas soluções" : "Inesperado")
+              << std::endl;
+    
+    // Fatoração vazia, índices fora da matriz e tamanhos errados são recusados sem mudar nada
+    LUFactorization empty;
+    const bool rejected = !empty.UpdateEntry(0, 0, 1.0) && !small.UpdateEntry(2, 0, 1.0) &&
+                          !small.UpdateEntry(0, -1, 1.0) && !small.UpdateRow(1, std::vector<double>{1, 2, 3}) &&
+                          !small.Update(std::vector<double>{1}, std::vector<double>{1, 1});
+    std::cout << "Edições inválidas: " << (rejected ? "recusadas" : "aceitas") << ", a(2,1) = "
+              << small.Coefficients()(1, 0) << std::endl;
+    
+    // Fatoração que não passa na verificação: refinamento e aritmética exata,
+    // como em Solve(A, b). det = -1, mas a LU em double perde a precisão
+    auto hard = solver.Solve(solver.Factorize({{100000001, 100000000}, {100000000, 99999999}}), {1, 2});
+    std::cout << "Quase singular pela fatoração: "
+              << (hard.status == LinearSolver::SolutionStatus::UNIQUE_SOLUTION ? "Solução única" : "Falha")
+              << (hard.exact ? " (exata)" : "") << std::endl;
+    
+    // A = L·U com fatores inteiros unitários (det = ±1, entradas grandes):
+    // os dois caminhos têm que dar o mesmo status
+    unsigned long long seed = 12345;
+    auto next = [&](int range) {
+        seed = seed * 6364136223846793005ULL + 1442695040888963407ULL;
+        return static_cast<int>((seed >> 33) % (2 * range + 1)) - range;
+    };
+    int same = 0;
+    const int systems = 90;
+    for (int t = 0; t < systems; t++) {
+        const int size = 2 + t % 9;
+        DenseMatrix lower(size, size), upper(size, size), product(size, size);
+        std::vector<double> rhs(size);
+        for (int i = 0; i < size; i++) {
+            lower(i, i) = 1.0;
+            upper(i, i) = t % 2 ? -1.0 : 1.0;
+            for (int j = 0; j < i; j++) lower(i, j) = next(1000);
+            for (int j = i + 1; j < size; j++) upper(i, j) = next(1000);
+            rhs[i] = next(10);
+        }
+        for (int i = 0; i < size; i++) {
+            for (int j = 0; j < size; j++) {
+                for (int k = 0; k < size; k++) product(i, j) += lower(i, k) * upper(k, j);
+            }
+        }
+        same += solver.Solve(product, rhs).status == solver.Solve(solver.Factorize(product), rhs).status;
+    }
+    std::cout << "Fatoração x Solve(A, b): " << same << " de " << systems << " com o mesmo status" << std::endl;
+}
+
+// Cache de soluções e fatorações endereçada pelo conteúdo
+void testSolutionCache() {
+    std::cout << "\n=== Cache de soluções ===" << std::endl;
+    
+    // O hash vetorial tem que bater com o escalar em qualquer tamanho
+    std::vector<double> data(64);
+    for (int i = 0; i < 64; i++) {
+        data[i] = std::sin(1.0 + i) * 1e3;
+    }
+    bool sameHash = true;
+    for (int n = 0; n <= 64; n++) {
+        sameHash = sameHash && SimdHash(data.data(), n, 7) == SimdDetail::HashScalar(data.data(), n, 7);
+    }
+    std::cout << "Hash igual ao escalar em todos os tamanhos: " << (sameHash ? "sim" : "não") << std::endl;
+    
+    const int n = 100;
+    DenseMatrix matrix(n, n);
+    for (int i = 0; i < n; i++) {
+        for (int j = 0; j < n; j++) {
+            matrix(i, j) = (i == j ? 4.0 : 0.0) + std::sin(0.37 * i + 0.91 * j);
+        }
+    }
+    
+    LinearSolver solver;
+    SolutionCache cache;
+    std::vector<double> constants(n, 1.0);
+    cache.Solve(solver, matrix, constants);
+    auto repeated = cache.Solve(solver, matrix, constants);
+    
+    // Novos b contra a mesma A: o segundo fatora, os seguintes só substituem
+    double maxDiff = 0.0;
+    for (int k = 1; k <= 4; k++) {
+        for (int i = 0; i < n; i++) {
+            constants[i] = std::cos(0.1 * k * i);
+        }
+        auto cached = cache.Solve(solver, matrix, constants);
+        auto direct = solver.Solve(matrix, constants);
+        for (int i = 0; i < n; i++) {
+            maxDiff = std::max(maxDiff, std::abs(cached.values[i] - direct.values[i]));
+        }
+    }
+    
+    auto statistics = cache.GetStatistics();
+    std::cout << "Repetido: " << (repeated.hasSolution ? "Solução única" : "Falha") << std::endl;
+    std::cout << "Soluções: " << statistics.solutionHits << " acertos, " << statistics.solutionMisses << " faltas" << std::endl;
+    std::cout << "Fatorações: " << statistics.factorizationHits << " acertos, " << statistics.factorizationMisses
+              << " faltas" << std::endl;
+    std::cout << "Diferença máxima para o Solve direto: " << (maxDiff < 1e-12 ? "< 1e-12" : "grande") << std::endl;
+    
+    // Limite de memória: 20 sistemas distintos em 256 KiB
+    cache.SetMemoryLimit(256 << 10);
+    for (int k = 0; k < 20; k++) {
+        matrix(0, 0) = 5.0 + k;
+        cache.Solve(solver, matrix, constants);
+    }
+    statistics = cache.GetStatistics();
+    std::cout << "Com limite: " << statistics.entries << " entradas, "
+              << (statistics.memoryUsed <= cache.GetMemoryLimit() ? "dentro do limite" : "acima do limite")
+              << ", " << (statistics.evictions > 0 ? "com remoções" : "sem remoções") << std::endl;
+    
+    // A configuração entra na chave: o resultado em ponto flutuante guardado
+    // sem aritmética exata não é servido a quem pede a exata
+    LinearSolver inexact;
+    inexact.SetExactArithmetic(false);
+    const DenseMatrix hard({{100000001, 100000000}, {100000000, 99999999}});
+    auto floating = cache.Solve(inexact, hard, {1, 2});
+    auto exact = cache.Solve(solver, hard, {1, 2});
+    LinearSolver::Solution found;
+    std::cout << "Outra configuração: " << (floating.exact ? "exata" : "ponto flutuante") << ", depois "
+              << (exact.exact ? "exata" : "ponto flutuante") << "; Find com a primeira: "
+              << (cache.Find(inexact, hard, {1, 2}, found) && !found.exact ? "acerto" : "falta") << std::endl;
+}
+
+// Eliminação exata (Bareiss) para sistemas com coeficientes inteiros
+void testExact() {
+    std::cout << "\n=== Eliminação exata (Bareiss) ===" << std::endl;
+    
+    const char* arithmetic[] = {"int64", "__int128", "BigInt"};
+    
+    // Tridiagonal clássica: det = 4 e solução fracionária
+    auto tridiagonal = ExactSolver::Solve({{2, -1, 0}, {-1, 2, -1}, {0, -1, 2}}, {1, 0, 0});
+    std::cout << "Tridiagonal 3x3: det = " << tridiagonal.determinant.ToString() << ", x = ("
+              << tridiagonal.values[0].ToString() << ", " << tridiagonal.values[1].ToString() << ", "
+              << tridiagonal.values[2].ToString() << "), " << arithmetic[static_cast<int>(tridiagonal.arithmetic)]
+              << std::endl;
+    
+    // det = 1, mas em double o segundo pivô some no arredondamento: a solução
+    // errada ainda passa na verificação por resíduo absoluto
+    DenseMatrix nearSingular(2, 2);
+    nearSingular(0, 0) = 1e10;
+    nearSingular(0, 1) = 1e10 + 1;
+    nearSingular(1, 0) = 1e10 - 1;
+    nearSingular(1, 1) = 1e10;
+    std::vector<double> constants = {1, 1};
+    LinearSolver floating;
+    floating.SetExactArithmetic(false);
+    LinearSolver solver;
+    auto approximate = floating.Solve(nearSingular, constants);
+    auto exact = solver.Solve(nearSingular, constants);
+    std::cout << "Só ponto flutuante: x[0] = " << std::scientific << std::setprecision(2) << approximate.values[0]
+              << std::fixed << std::setprecision(3) << std::endl;
+    std::cout << "Com Bareiss: " << (exact.hasSolution ? "Solução única" : "Falha") << ", x = (" << exact.values[0]
+              << ", " << exact.values[1] << "), det = " << exact.determinant << (exact.exact ? " (exato)" : "")
+              << std::endl;
+    
+    // Hilbert 12x12 escalada por mmc(1..23): inteira, estoura o __int128, x = 1
+    const int n = 12;
+    DenseMatrix hilbert(n, n);
+    std::vector<double> rhs(n, 0.0);
+    for (int i = 0; i < n; i++) {
+        for (int j = 0; j < n; j++) {
+            hilbert(i, j) = 5354228880.0 / (i + j + 1);
+            rhs[i] += hilbert(i, j);
+        }
+    }
+    auto scaled = ExactSolver::Solve(hilbert, rhs);
+    bool allOnes = scaled.outcome == ExactSolver::Outcome::UNIQUE_SOLUTION;
+    for (int i = 0; i < n && allOnes; i++) {
+        allOnes = scaled.values[i].ToString() == "1";
+    }
+    std::cout << "Hilbert 12x12 inteira: x = 1 exato " << (allOnes ? "sim" : "não") << ", det com "
+              << scaled.determinant.ToString().size() << " dígitos, " << arithmetic[static_cast<int>(scaled.arithmetic)]
+              << std::endl;
+    
+    // Classificação exata dos sistemas singulares
+    auto infinite = ExactSolver::Solve({{1, 2}, {2, 4}}, {3, 6});
+    auto none = ExactSolver::Solve({{1, 2}, {2, 4}}, {3, 7});
+    std::cout << "Singular: posto " << infinite.rank << ", "
+              << (infinite.outcome == ExactSolver::Outcome::INFINITE_SOLUTIONS ? "Infinitas soluções" : "Inesperado")
+              << " / " << (none.outcome == ExactSolver::Outcome::NO_SOLUTION ? "Sem solução" : "Inesperado") << std::endl;
+    
+    BigInt factorial = 1;
+    for (int i = 2; i <= 30; i++) {
+        factorial *= BigInt(i);
+    }
+    std::cout << "30! = " << factorial.ToString() << std::endl;
+}
+
+void testMultiModular() {
+    std::cout << "\n=== Eliminação modular com resto chinês ===" << std::endl;
+    
+    auto fraction = [](long long numerator, long long denominator) {
+        ExactSolver::Rational value;
+        value.numerator = numerator;
+        value.denominator = denominator;
+        return value;
+    };
+    
+    // Coeficientes racionais pela interface do LinearSolver: det = 1/60
+    LinearSolver solver;
+    auto rational = solver.SolveExact({{fraction(1, 2), fraction(1, 3)}, {fraction(1, 4), fraction(1, 5)}},
+                                      {fraction(1, 1), fraction(1, 1)});
+    std::cout << "Racional 2x2: x = (" << rational.exactValues[0].ToString() << ", "
+              << rational.exactValues[1].ToString() << "), det = " << rational.exactDeterminant.ToString()
+              << (rational.exact ? " (exato)" : "") << std::endl;
+    
+    // Hilbert 15x15 racional: A·x = e₁ tem x = primeira coluna da inversa (inteira, x₁ = n²)
+    const int n = 15;
+    std::vector<std::vector<ExactSolver::Rational>> hilbert(n, std::vector<ExactSolver::Rational>(n));
+    std::vector<ExactSolver::Rational> unit(n, fraction(0, 1));
+    unit[0] = fraction(1, 1);
+    for (int i = 0; i < n; i++) {
+        for (int j = 0; j < n; j++) {
+            hilbert[i][j] = fraction(1, i + j + 1);
+        }
+    }
+    auto inverse = MultiModularSolver::Solve(hilbert, unit);
+    std::cout << "Hilbert 15x15: x1 = " << inverse.values[0].ToString() << ", x15 = " << inverse.values[n - 1].ToString()
+              << ", det = 1/(" << inverse.determinant.denominator.ToString().size() << " dígitos), "
+              << inverse.primes << " primos" << std::endl;
+    
+    // Mesma resposta do Bareiss em sistemas inteiros aleatórios, inclusive singulares
+    unsigned state = 2024u;
+    auto next = [&] {
+        state = state * 1103515245u + 12345u;
+        return static_cast<double>(static_cast<int>((state >> 16) % 7) - 3);
+    };
+    int agree = 0;
+    const int trials = 200;
+    for (int t = 0; t < trials; t++) {
+        const int size = 1 + t % 8;
+        DenseMatrix matrix(size, size);
+        std::vector<double> constants(size);
+        for (int i = 0; i < size; i++) {
+            for (int j = 0; j < size; j++) {
+                matrix(i, j) = next();
+            }
+            constants[i] = next();
+        }
+        if (t % 3 == 1 && size > 1) {
+            for (int j = 0; j < size; j++) {
+                matrix(size - 1, j) = 2 * matrix(0, j);
+            }
+        }
+        auto bareiss = ExactSolver::Solve(matrix, constants);
+        auto modular = MultiModularSolver::Solve(matrix, constants);
+        bool same = bareiss.outcome == modular.outcome && bareiss.rank == modular.rank &&
+                    modular.determinant.denominator == BigInt(1) && bareiss.determinant == modular.determinant.numerator;
+        for (size_t i = 0; same && i < bareiss.values.size(); i++) {
+            same = bareiss.values[i].ToString() == modular.values[i].ToString();
+        }
+        agree += same ? 1 : 0;
+    }
+    std::cout << "Concordância com o Bareiss: " << agree << "/" << trials << std::endl;
+    
+    // Solução pequena: para assim que verifica, bem antes do limite de Hadamard
+    const int large = 60;
+    DenseMatrix matrix(large, large);
+    std::vector<double> constants(large, 0.0);
+    for (int i = 0; i < large; i++) {
+        for (int j = 0; j < large; j++) {
+            matrix(i, j) = next() + (i == j ? 10.0 : 0.0);
+            constants[i] += matrix(i, j);
+        }
+    }
+    auto early = MultiModularSolver::Solve(matrix, constants, nullptr, false);
+    auto full = MultiModularSolver::Solve(matrix, constants);
+    bool ones = early.outcome == ExactSolver::Outcome::UNIQUE_SOLUTION;
+    for (int i = 0; i < large && ones; i++) {
+        ones = early.values[i].ToString() == "1";
+    }
+    std::cout << "Inteira 60x60 com x = 1: " << (ones ? "exato" : "falhou") << " com " << early.primes
+              << " primos; com o determinante, " << full.primes << " primos" << std::endl;
+}
+
+void testOutOfCore() {
+    std::cout << "\n=== LU fora da memória com checkpoint ===" << std::endl;
+    
+    const std::string path = "test_out_of_core.bin";
+    const int n = 300;
+    DenseMatrix matrix(n, n);
+    std::vector<double> constants(n);
+    unsigned state = 77u;
+    auto next = [&] {
+        state = state * 1103515245u + 12345u;
+        return static_cast<double>((state >> 8) & 0xFFFF) / 32768.0 - 1.0;
+    };
+    for (int i = 0; i < n; i++) {
+        for (int j = 0; j < n; j++) {
+            matrix(i, j) = next();
+        }
+        constants[i] = next();
+    }
+    
+    // Gravar em blocos de linhas, fatorar dois painéis e "cair"
+    {
+        OutOfCoreLU store;
+        store.Create(path, n, 32);
+        for (int row = 0; row < n; row += 50) {
+            DenseMatrix block(50, n);
+            for (int i = 0; i < 50; i++) {
+                std::copy(matrix.Row(row + i), matrix.Row(row + i) + n, block.Row(i));
+            }
+            store.WriteBlock(row, 0, block);
+        }
+        OutOfCoreLU::Status status = store.Factor(nullptr, OutOfCoreLU::DEFAULT_TOLERANCE, 2);
+        std::cout << "Interrompida: " << (status == OutOfCoreLU::Status::INCOMPLETE ? "incompleta" : "inesperado")
+                  << ", " << store.FactoredPanels() << "/" << store.PanelCount() << " painéis" << std::endl;
+    }
+    
+    // Retomar do checkpoint e comparar com a eliminação na memória
+    OutOfCoreLU store;
+    store.Open(path);
+    std::cout << "Retomada no painel " << store.FactoredPanels() << std::endl;
+    LinearSolver solver;
+    auto outOfCore = solver.Solve(store, constants);
+    auto inMemory = solver.Solve(matrix, constants);
+    double maxDiff = 0.0;
+    for (int i = 0; i < n; i++) {
+        maxDiff = std::max(maxDiff, std::abs(outOfCore.values[i] - inMemory.values[i]));
+    }
+    std::cout << "Solução: " << (outOfCore.hasSolution ? "única" : "falha") << ", diferença máxima "
+              << (maxDiff < 1e-10 ? "< 1e-10" : "grande") << ", ln|det| "
+              << (std::abs(outOfCore.logAbsDeterminant - inMemory.logAbsDeterminant) < 1e-8 ? "igual" : "diferente")
+              << std::endl;
+    std::cout << "Memória de trabalho: " << store.WorkingSetBytes() / 1024 << " KiB (matriz: "
+              << static_cast<std::size_t>(n) * n * sizeof(double) / 1024 << " KiB)" << std::endl;
+    OutOfCoreLU::Remove(path);
+    
+    // Linha dependente: sem pivô, com o motivo em diagnostics
+    OutOfCoreLU singular;
+    singular.Create(path, 3, 8);
+    DenseMatrix rows(3, 3);
+    const double values[3][3] = {{1, 2, 3}, {2, 4, 6}, {1, 0, 1}};
+    for (int i = 0; i < 3; i++) {
+        std::copy(values[i], values[i] + 3, rows.Row(i));
+    }
+    singular.WriteBlock(0, 0, rows);
+    auto failed = solver.Solve(singular, {1, 2, 3});
+    std::cout << "Singular: " << failed.diagnostics << std::endl;
+    OutOfCoreLU::Remove(path);
+}
+
+void testMatrixFile() {
+    std::cout << "\n=== Arquivo binário de matriz mapeado ===" << std::endl;
+    
+    const std::string path = "test_matrix_file.bin";
+    const int n = 200;
+    DenseMatrix matrix(n, n);
+    std::vector<double> constants(n);
+    unsigned state = 31u;
+    auto next = [&] {
+        state = state * 1103515245u + 12345u;
+        return static_cast<double>((state >> 8) & 0xFFFF) / 32768.0 - 1.0;
+    };
+    for (int i = 0; i < n; i++) {
+        for (int j = 0; j < n; j++) {
+            matrix(i, j) = next() + (i == j ? n : 0.0);
+        }
+        constants[i] = next();
+    }
+    
+    // Densa: a visão aponta para o arquivo e o solver a usa diretamente
+    LinearSolver solver;
+    MatrixFile file;
+    bool written = MatrixFile::Write(path, matrix, constants) == MatrixFile::Status::SUCCESS;
+    bool opened = file.Open(path) == MatrixFile::Status::SUCCESS;
+    DenseMatrix view = file.Dense();
+    std::cout << "Densa " << n << "x" << n << ": " << (written && opened ? "gravada e aberta" : "falha")
+              << ", visão " << (view.IsView() ? "sem cópia" : "copiada")
+              << ", alinhada " << (reinterpret_cast<std::uintptr_t>(view.Row(0)) % DenseMatrix::ALIGNMENT == 0 ? "sim" : "não")
+              << ", checksum " << (file.Verify() == MatrixFile::Status::SUCCESS ? "ok" : "falhou") << std::endl;
+    auto fromFile = solver.Solve(file);
+    auto inMemory = solver.Solve(matrix, constants);
+    double maxDiff = 0.0;
+    for (int i = 0; i < n; i++) {
+        maxDiff = std::max(maxDiff, std::abs(fromFile.values[i] - inMemory.values[i]));
+    }
+    std::cout << "Solução pelo arquivo: " << (fromFile.hasSolution ? "única" : "falha")
+              << ", diferença " << maxDiff << std::endl;
+    
+    // O mapeamento é privado: alterar a visão não muda o arquivo
+    view(0, 0) = 12345.0;
+    MatrixFile reopened;
+    reopened.Open(path);
+    std::cout << "Escrita na visão preservou o arquivo: "
+              << (reopened.Dense()(0, 0) == matrix(0, 0) ? "sim" : "não") << std::endl;
+    view = DenseMatrix();
+    file.Close();
+    reopened.Close();
+    
+    // CSR tridiagonal
+    const int m = 1000;
+    std::vector<Triplet> triplets;
+    for (int i = 0; i < m; i++) {
+        triplets.push_back({i, i, 4.0});
+        if (i > 0) triplets.push_back({i, i - 1, -1.0});
+        if (i + 1 < m) triplets.push_back({i, i + 1, -1.0});
+    }
+    SparseMatrix sparse = SparseMatrix::FromTriplets(m, m, triplets);
+    std::vector<double> sparseConstants(m, 1.0);
+    MatrixFile::Write(path, sparse, sparseConstants);
+    file.Open(path);
+    SparseMatrix sparseView = file.Sparse();
+    auto sparseFromFile = solver.Solve(file);
+    auto sparseInMemory = solver.Solve(sparse, sparseConstants);
+    maxDiff = 0.0;
+    for (int i = 0; i < m; i++) {
+        maxDiff = std::max(maxDiff, std::abs(sparseFromFile.values[i] - sparseInMemory.values[i]));
+    }
+    std::cout << "CSR " << m << "x" << m << ": " << file.NonZeros() << " não nulos, visão "
+              << (sparseView.IsView() ? "sem cópia" : "copiada") << ", checksum "
+              << (file.Verify() == MatrixFile::Status::SUCCESS ? "ok" : "falhou")
+              << ", diferença " << maxDiff << std::endl;
+    sparseView = SparseMatrix();
+    file.Close();
+    
+    // Um byte alterado nos dados só aparece em Verify(); no cabeçalho, já em Open()
+    auto corrupt = [&](std::streamoff offset) {
+        std::fstream raw(path, std::ios::in | std::ios::out | std::ios::binary);
+        raw.seekg(offset);
+        char byte = static_cast<char>(raw.get());
+        raw.seekp(offset);
+        raw.put(static_cast<char>(byte ^ 0x10));
+    };
+    corrupt(4096);
+    MatrixFile::Status status = file.Open(path);
+    std::cout << "Dados corrompidos: Open " << (status == MatrixFile::Status::SUCCESS ? "ok" : "falhou")
+              << ", Verify " << (file.Verify() == MatrixFile::Status::CHECKSUM_MISMATCH ? "detectou" : "não detectou")
+              << std::endl;
+    file.Close();
+    corrupt(30);
+    std::cout << "Cabeçalho corrompido: "
+              << (file.Open(path) == MatrixFile::Status::CHECKSUM_MISMATCH ? "detectado" : "não detectado") << std::endl;
+    std::remove(path.c_str());
+    
+    // Nome fora do ASCII (no Windows, CreateFileW com o caminho em UTF-16)
+    const std::filesystem::path accented = std::filesystem::u8path(u8"matriz_coeficientes_ção.bin");
+    written = MatrixFile::Write(accented, matrix, constants) == MatrixFile::Status::SUCCESS;
+    opened = file.Open(accented) == MatrixFile::Status::SUCCESS && file.Verify() == MatrixFile::Status::SUCCESS;
+    std::cout << "Caminho com acentos: " << (written && opened ? "gravado e aberto" : "falha") << std::endl;
+    file.Close();
+    std::filesystem::remove(accented);
+}
+
+void testMatrixReader() {
+    std::cout << "\n=== Leitura de Matrix Market e CSV ===" << std::endl;
+    
+    auto describe = [](const MatrixReader::Result& result) {
+        std::ostringstream out;
+        out << "linha " << result.line << ", coluna " << result.column << ": " << result.message;
+        return out.str();
+    };
+    
+    // Coordinate simétrica: a metade superior é espelhada no CSR
+    auto symmetric = MatrixReader::ParseMatrixMarket(
+        "%%MatrixMarket matrix coordinate real symmetric\n% comentário\n3 3 4\n1 1 4\n2 1 -1\n3 3 2.5e0\n3 2 -1\n");
+    std::cout << "Coordinate simétrica: " << symmetric.sparse.NonZeros() << " não nulos, a(1,2) = "
+              << symmetric.sparse.At(0, 1) << ", a(3,3) = " << symmetric.sparse.At(2, 2) << std::endl;
+    
+    // Array em ordem de colunas
+    auto array = MatrixReader::ParseMatrixMarket("%%MatrixMarket matrix array real general\n2 2\n1\n3\n2\n4\n");
+    std::cout << "Array 2x2: [" << array.dense(0, 0) << " " << array.dense(0, 1) << "; "
+              << array.dense(1, 0) << " " << array.dense(1, 1) << "]" << std::endl;
+    
+    // CSV com cabeçalho e CSV com ';' e vírgula decimal
+    auto csv = MatrixReader::ParseDelimited("x,y,b\n2,1,3\n1,3,5\n", nullptr, 0, true);
+    auto decimal = MatrixReader::ParseDelimited("2;1,5\n0,5;4\n");
+    std::cout << "CSV: " << csv.dense.Rows() << "x" << csv.dense.Cols() << ", ';' com vírgula decimal: a(1,2) = "
+              << decimal.dense(0, 1) << std::endl;
+    
+    // Erros com linha e coluna
+    auto token = MatrixReader::ParseMatrixMarket("%%MatrixMarket matrix coordinate real general\n2 2 2\n1 1 1.0\n2 2 1.x\n");
+    auto range = MatrixReader::ParseMatrixMarket("%%MatrixMarket matrix coordinate real general\n2 2 1\n3 1 1.0\n");
+    auto fields = MatrixReader::ParseDelimited("1,2,3\n4,5\n");
+    std::cout << "Token inválido: " << describe(token) << std::endl;
+    std::cout << "Índice fora: " << describe(range) << std::endl;
+    std::cout << "Campos: " << describe(fields) << std::endl;
+    
+    // Sinal depois de '+' e valores não finitos são tokens inválidos
+    auto sign = MatrixReader::ParseDelimited("1,+-1\n2,3\n");
+    auto nonFinite = MatrixReader::ParseDelimited("1,2\nnan,3\n");
+    auto infinite = MatrixReader::ParseMatrixMarket("%%MatrixMarket matrix coordinate real general\n2 2 1\n1 1 inf\n");
+    auto malformed = [](const MatrixReader::Result& result) {
+        return result.status == MatrixReader::Status::MALFORMED_TOKEN ? "token inválido" : "aceito";
+    };
+    std::cout << "Sinal \"+-1\": " << malformed(sign) << " (" << describe(sign) << ")" << std::endl;
+    std::cout << "nan e inf: " << malformed(nonFinite) << " (" << describe(nonFinite) << "), "
+              << malformed(infinite) << " (" << describe(infinite) << ")" << std::endl;
+    
+    // Arquivo grande em várias partes: o resultado com o pool é o mesmo
+    const int n = 100000;
+    std::ostringstream text;
+    text << "%%MatrixMarket matrix coordinate real general\n" << n << " " << n << " " << 3 * n - 2 << "\n";
+    for (int i = 1; i <= n; i++) {
+        text << i << " " << i << " 4.25\n";
+        if (i > 1) text << i << " " << i - 1 << " -1\n";
+        if (i < n) text << i << " " << i + 1 << " -1.5\n";
+    }
+    ThreadPool pool(4);
+    auto sequential = MatrixReader::ParseMatrixMarket(text.str());
+    auto parallel = MatrixReader::ParseMatrixMarket(text.str(), &pool);
+    bool same = parallel.status == MatrixReader::Status::SUCCESS &&
+                parallel.sparse.RowPointers() == sequential.sparse.RowPointers() &&
+                parallel.sparse.ColumnIndices() == sequential.sparse.ColumnIndices() &&
+                parallel.sparse.Values() == sequential.sparse.Values();
+    std::string broken = text.str();
+    const std::size_t position = broken.find('\n', broken.size() * 3 / 4) + 1;
+    const long long brokenLine = 1 + std::count(broken.begin(), broken.begin() + position, '\n');
+    broken.insert(position, "7 7 abc\n");
+    auto late = MatrixReader::ParseMatrixMarket(broken, &pool);
+    std::cout << "Em partes (" << text.str().size() / (1024 * 1024) << " MiB): " << (same ? "igual à leitura sequencial" : "diferente")
+              << ", erro na linha " << (late.line == brokenLine ? "certa" : "errada") << std::endl;
+    
+    // Importar e resolver pelo arquivo
+    const std::string path = "test_matrix_reader.mtx";
+    {
+        std::ofstream file(path);
+        file << "%%MatrixMarket matrix coordinate real general\n3 3 5\n1 1 2\n2 2 3\n3 3 4\n1 3 1\n3 1 1\n";
+    }
+    auto read = MatrixReader::Read(path);
+    LinearSolver solver;
+    auto solution = solver.Solve(read.sparse, {3.0, 3.0, 5.0});
+    std::cout << "Arquivo .mtx resolvido: x = (" << solution.values[0] << ", " << solution.values[1] << ", "
+              << solution.values[2] << ")" << std::endl;
+    std::remove(path.c_str());
+}
+
+void testInputModel() {
+    std::cout << "\n=== Modelo de entrada com células sujas ===" << std::endl;
+    
+    InputModel model(3);
+    InputModel::Snapshot snapshot;
+    model.TakeSnapshot(snapshot);
+    std::cout << "Primeira cópia: " << (snapshot.full ? "completa" : "parcial")
+              << ", " << snapshot.size << "x" << snapshot.size << std::endl;
+    
+    // Uma célula editada: só ela é copiada
+    bool changed = model.SetText(1, 2, "2.5");
+    model.TakeSnapshot(snapshot);
+    std::cout << "Uma edição: " << (changed ? "mudou" : "igual") << ", " << snapshot.changes.size()
+              << " alteração(ões), a(2,3) = " << snapshot.matrix[1][2] << ", completa: "
+              << (snapshot.full ? "sim" : "não") << std::endl;
+    
+    // Mesmo texto de novo: nada muda e a versão fica
+    const auto version = model.Version();
+    changed = model.SetText(1, 2, " +2.50");
+    std::cout << "Mesmo valor: " << (changed ? "mudou" : "igual") << ", versão "
+              << (model.Version() == version ? "mantida" : "alterada") << std::endl;
+    
+    // Campos vazios ou inválidos deixam o sistema incompleto
+    model.SetText(0, 0, "");
+    model.SetText(2, InputModel::CONSTANT, "1.x");
+    model.TakeSnapshot(snapshot);
+    std::cout << "Vazia e inválida: " << snapshot.incompleteCells << " incompleta(s), "
+              << snapshot.changes.size() << " alteração(ões)" << std::endl;
+    
+    // Sinal depois de '+' e valores não finitos são inválidos, como em _tcstod
+    InputModel strict(1);
+    strict.SetText(0, 0, "+-1");
+    strict.SetText(0, InputModel::CONSTANT, "inf");
+    double parsed = 0.0;
+    const bool nanRejected = InputModel::Parse("nan", parsed) == InputModel::CellState::INVALID;
+    InputModel::Snapshot strictSnapshot;
+    strict.TakeSnapshot(strictSnapshot);
+    std::cout << "\"+-1\", \"inf\" e \"nan\": " << strictSnapshot.incompleteCells << " incompleta(s), nan "
+              << (nanRejected ? "inválido" : "aceito") << std::endl;
+    
+    // Texto largo (TCHAR = wchar_t) e correção das células
+    model.SetText(0, 0, L"4");
+    model.SetText(2, InputModel::CONSTANT, L"-1e-3");
+    model.TakeSnapshot(snapshot);
+    std::cout << "Texto largo: a(1,1) = " << snapshot.matrix[0][0] << ", b3 = " << snapshot.constants[2]
+              << ", completo: " << (snapshot.Complete() ? "sim" : "não") << std::endl;
+    
+    // Outro consumidor recebe cópia completa e igual
+    InputModel::Snapshot other;
+    model.TakeSnapshot(other);
+    std::cout << "Outro consumidor: " << (other.full ? "completa" : "parcial") << ", "
+              << (other.matrix == snapshot.matrix && other.constants == snapshot.constants ? "igual" : "diferente")
+              << std::endl;
+    
+    // Novo tamanho: cópia completa
+    model.Resize(4);
+    model.TakeSnapshot(snapshot);
+    std::cout << "Novo tamanho: " << (snapshot.full ? "completa" : "parcial") << ", " << snapshot.size
+              << "x" << snapshot.size << std::endl;
+}
+
+// κ₁ exato pelas colunas da inversa (n resoluções)
+double ExactCondition(const DenseMatrix& matrix) {
+    const int n = matrix.Rows();
+    LinearSolver solver;
+    solver.SetAlgorithm(LinearSolver::Algorithm::CLASSIC);
+    solver.SetConditionEstimation(false);
+    double normOne = 0.0;
+    double inverseNorm = 0.0;
+    for (int j = 0; j < n; j++) {
+        std::vector<double> unit(n, 0.0);
+        unit[j] = 1.0;
+        auto column = solver.Solve(matrix, unit);
+        double columnNorm = 0.0;
+        double matrixColumn = 0.0;
+        for (int i = 0; i < n; i++) {
+            columnNorm += std::abs(column.values[i]);
+            matrixColumn += std::abs(matrix(i, j));
+        }
+        inverseNorm = std::max(inverseNorm, columnNorm);
+        normOne = std::max(normOne, matrixColumn);
+    }
+    return normOne * inverseNorm;
+}
+
+void testConditionEstimate() {
+    std::cout << "\n=== Estimativa do número de condição ===" << std::endl;
+    
+    struct Case { const char* name; int n; int kind; LinearSolver::Algorithm algorithm; };
+    const Case cases[] = {
+        {"Fixo 6x6", 6, 0, LinearSolver::Algorithm::AUTOMATIC},
+        {"Clássica 60x60", 60, 0, LinearSolver::Algorithm::CLASSIC},
+        {"LU em blocos 60x60", 60, 0, LinearSolver::Algorithm::BLOCKED},
+        {"Precisão mista 60x60", 60, 0, LinearSolver::Algorithm::MIXED_PRECISION},
+        {"Cholesky 60x60", 60, 1, LinearSolver::Algorithm::AUTOMATIC},
+        {"LDLᵀ 60x60", 60, 2, LinearSolver::Algorithm::AUTOMATIC},
+        {"Banda 2/1 80x80", 80, 3, LinearSolver::Algorithm::AUTOMATIC},
+        {"Tridiagonal 80x80", 80, 4, LinearSolver::Algorithm::AUTOMATIC},
+    };
+    
+    for (const Case& test : cases) {
+        const int n = test.n;
+        DenseMatrix matrix(n, n);
+        for (int i = 0; i < n; i++) {
+            for (int j = 0; j < n; j++) {
+                double value = 0.0;
+                switch (test.kind) {
+                    case 0: value = (i == j ? 3.0 : 0.0) + std::sin(0.37 * i + 0.91 * j * j); break;
+                    case 1: value = (i == j ? 2.0 : 0.0) + 1.0 / (1.0 + std::abs(i - j)); break;
+                    case 2: value = (i == j ? (i % 2 ? 1.5 : -2.0) : 0.0) + std::cos(0.5 * (i + j)) / n; break;
+                    case 3: value = (j - i >= -2 && j - i <= 1) ? (i == j ? 3.0 : std::sin(1.0 + i + 2 * j)) : 0.0; break;
+                    default: value = (i == j) ? 2.5 : (std::abs(i - j) == 1 ? -1.0 - 0.2 * std::sin(i + j) : 0.0); break;
+                }
+                matrix(i, j) = value;
+            }
+        }
+        
+        LinearSolver solver;
+        solver.SetAlgorithm(test.algorithm);
+        auto result = solver.Solve(matrix, std::vector<double>(n, 1.0));
+        const double exact = ExactCondition(matrix);
+        std::cout << test.name << ": estimativa " << std::scientific << std::setprecision(3) << result.conditionEstimate
+                  << ", exato " << exact << std::fixed << std::setprecision(3)
+                  << " (razão " << result.conditionEstimate / exact << ")" << std::endl;
+    }
+    
+    // Hilbert 10x10: resolvida, mas sinalizada como mal condicionada
+    const int size = 10;
+    DenseMatrix hilbert(size, size);
+    std::vector<double> constants(size, 0.0);
+    for (int i = 0; i < size; i++) {
+        for (int j = 0; j < size; j++) {
+            hilbert(i, j) = 1.0 / (i + j + 1);
+            constants[i] += hilbert(i, j);
+        }
+    }
+    LinearSolver solver;
+    auto result = solver.Solve(hilbert, constants);
+    std::cout << "Hilbert 10x10: " << (result.illConditioned ? "mal condicionada" : "bem condicionada")
+              << ", κ₁ ≈ " << std::scientific << std::setprecision(2) << result.conditionEstimate << std::fixed
+              << ", x[0] = " << std::setprecision(4) << result.values[0] << std::endl;
+    
+    // Duas linhas quase iguais em escala grande: o refinamento salva a verificação
+    // em 1e6; em 1e8 a falha vem com o motivo em vez de um CALCULATION_ERROR mudo
+    const int n = 40;
+    for (double scale : {1e6, 1e8}) {
+        DenseMatrix matrix(n, n);
+        std::vector<double> rhs(n, 0.0);
+        for (int i = 0; i < n; i++) {
+            for (int j = 0; j < n; j++) {
+                matrix(i, j) = scale * ((i == j ? 3.0 : 0.0) + std::sin(0.37 * i + 0.91 * j * j));
+            }
+        }
+        for (int j = 0; j < n; j++) {
+            matrix(n - 1, j) = matrix(0, j) + 1e-8 * scale * std::cos(1.0 + j);
+        }
+        for (int i = 0; i < n; i++) {
+            for (int j = 0; j < n; j++) {
+                rhs[i] += matrix(i, j);
+            }
+        }
+        solver.SetAlgorithm(LinearSolver::Algorithm::CLASSIC);
+        auto nearSingular = solver.Solve(matrix, rhs);
+        std::cout << "Quase singular (escala " << std::scientific << std::setprecision(0) << scale << std::fixed << "): ";
+        if (nearSingular.hasSolution) {
+            std::cout << "resolvida com " << nearSingular.iterations << " passo(s) de refinamento" << std::endl;
+        } else {
+            std::cout << nearSingular.diagnostics << std::endl;
+        }
+    }
+}
+
 int main() {
     std::cout << "Testando LinearSolver..." << std::endl;
     
+    const char* simdNames[] = {"escalar", "SSE2", "AVX2+FMA", "AVX-512"};
+    std::cout << "Kernels SIMD ativos: " << simdNames[static_cast<int>(SimdKernels().level)] << std::endl;
+    
     // Teste 1: Sistema 2x2 com solução única
     testCase("Sistema 2x2 - Solução única",
         {{2, 3}, {1, -1}},
@@ -76,5 +1509,74 @@ int main() {
         {{1, 0}, {0, 1}},
         {5, 3});
     
+    // Teste 6: LU em blocos (inclui painel final incompleto)
+    testBlockedLU(301);
+    
+    // Teste 7: Fatoração reutilizável
+    testFactorization();
+    
+    // Teste 8: Várias colunas de constantes
+    testSolveMany();
+    
+    // Teste 9: Lote de sistemas pequenos
+    testBatch();
+    
+    // Teste 10: Caminho de tamanho fixo
+    testFixedSizes();
+    
+    // Teste 11: Sistemas esparsos
+    testSparse(30);
+    
+    // Teste 12: Gradiente conjugado precondicionado
+    testConjugateGradient(50);
+    
+    // Teste 13: Métodos iterativos não simétricos
+    testNonsymmetricIterative(50);
+    
+    // Teste 14: Cholesky e LDLᵀ para matrizes simétricas
+    testSymmetric(101);
+    
+    // Teste 15: Sistemas em banda e tridiagonais
+    testBand(500);
+    
+    // Teste 16: Lote de sistemas tridiagonais
+    testTridiagonalBatch();
+    
+    // Teste 17: LU em float com refinamento iterativo
+    testMixedPrecision(300);
+    
+    // Teste 18: Mesmo workspace em sistemas de tamanhos e tipos diferentes
+    testWorkspace();
+    
+    // Teste 19: Posto, pivôs e determinante como subprodutos da fatoração
+    testDiagnostics();
+    
+    // Teste 20: Número de condição estimado com os fatores
+    testConditionEstimate();
+    
+    // Teste 21: Edições de células com correções de posto 1
+    testRankOneUpdates();
+    
+    // Teste 22: Cache de soluções e fatorações
+    testSolutionCache();
+    
+    // Teste 23: Eliminação exata para sistemas inteiros
+    testExact();
+    
+    // Teste 24: Sistemas racionais exatos por eliminação modular
+    testMultiModular();
+    
+    // Teste 25: LU fora da memória, interrompida e retomada
+    testOutOfCore();
+    
+    // Teste 26: Formato binário mapeado em memória
+    testMatrixFile();
+    
+    // Teste 27: Leitura paralela de Matrix Market e CSV
+    testMatrixReader();
+    
+    // Teste 28: Modelo de entrada com células sujas
+    testInputModel();
+    
     return 0;
 }